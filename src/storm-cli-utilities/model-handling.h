@@ -6,6 +6,7 @@
 #include "storm/utility/file.h"
 #include "storm/utility/storm-version.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/dd.h"
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
@@ -31,6 +32,7 @@
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 #include "storm/settings/modules/JaniExportSettings.h"
 
@@ -100,13 +102,22 @@ namespace storm {
             auto coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
 
             SymbolicInput output = input;
+            bool jitKeepsConstants = coreSettings.getEngine() == storm::settings::modules::CoreSettings::Engine::Sparse && buildSettings.isJitSet() && storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isCacheSet();
 
             // Substitute constant definitions in symbolic input.
             std::string constantDefinitionString = ioSettings.getConstantDefinitionString();
             std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
             if (output.model) {
                 constantDefinitions = output.model.get().parseConstantDefinitions(constantDefinitionString);
-                output.model = output.model.get().preprocess(constantDefinitions);
+                
+                // If the JIT-based builder caches its builders, the constants that do not influence the state space
+                // are kept as parameters of the cached builder. As this is decided on the JANI model, the constants
+                // are only substituted after the conversion below.
+                if (jitKeepsConstants) {
+                    output.model = output.model.get().defineUndefinedConstants(constantDefinitions);
+                } else {
+                    output.model = output.model.get().preprocess(constantDefinitions);
+                }
             }
             if (!output.properties.empty()) {
                 output.properties = storm::api::substituteConstantsInProperties(output.properties, constantDefinitions);
@@ -134,6 +145,11 @@ namespace storm {
                     }
                 }
             }
+            
+            if (output.model && jitKeepsConstants) {
+                storm::jani::Model const& janiModel = output.model.get().asJaniModel();
+                output.model = janiModel.substituteConstants(janiModel.getNonStructuralConstants());
+            }
 
             return output;
         }
@@ -173,7 +189,30 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& input) {
-            return storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), storm::settings::getModule<storm::settings::modules::BuildSettings>().isBuildFullModelSet());
+            auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            boost::optional<std::vector<std::string>> metaVariableOrder;
+            if (buildSettings.isDdVariableOrderImportSet()) {
+                metaVariableOrder = storm::utility::dd::importMetaVariableOrder(buildSettings.getDdVariableOrderImportFilename());
+            }
+            
+            auto model = storm::api::buildSymbolicModel<DdType, ValueType>(input.model.get(), createFormulasToRespect(input.properties), buildSettings.isBuildFullModelSet(), metaVariableOrder);
+            
+            storm::dd::DdManager<DdType>& manager = model->getManager();
+            if (buildSettings.isDdReorderingSet()) {
+                if (manager.supportsDynamicReordering()) {
+                    uint64_t nodeCountBefore = model->getTransitionMatrix().getNodeCount();
+                    storm::utility::Stopwatch reorderingWatch(true);
+                    manager.triggerReordering();
+                    reorderingWatch.stop();
+                    STORM_PRINT("Reordered DD variables in " << reorderingWatch << " (transition matrix: " << nodeCountBefore << " -> " << model->getTransitionMatrix().getNodeCount() << " nodes)." << std::endl);
+                } else {
+                    STORM_LOG_WARN("Ignoring request to reorder the DD variables, because the DD library does not support reordering. An order exported by a run using CUDD can be imported instead.");
+                }
+            }
+            if (buildSettings.isDdVariableOrderExportSet()) {
+                manager.exportMetaVariableOrder(buildSettings.getDdVariableOrderExportFilename());
+            }
+            return model;
         }
 
         template <typename ValueType>
@@ -198,6 +237,8 @@ namespace storm {
                 result = storm::api::buildExplicitModel<ValueType>(ioSettings.getTransitionFilename(), ioSettings.getLabelingFilename(), ioSettings.isStateRewardsSet() ? boost::optional<std::string>(ioSettings.getStateRewardsFilename()) : boost::none, ioSettings.isTransitionRewardsSet() ? boost::optional<std::string>(ioSettings.getTransitionRewardsFilename()) : boost::none, ioSettings.isChoiceLabelingSet() ? boost::optional<std::string>(ioSettings.getChoiceLabelingFilename()) : boost::none);
             } else if (ioSettings.isExplicitDRNSet()) {
                 result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename());
+            } else if (ioSettings.isExplicitBinarySet()) {
+                result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
             } else {
                 STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
                 result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -217,7 +258,7 @@ namespace storm {
                 } else if (engine == storm::settings::modules::CoreSettings::Engine::Sparse) {
                     result = buildModelSparse<ValueType>(input, buildSettings);
                 }
-            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+            } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
                 STORM_LOG_THROW(engine == storm::settings::modules::CoreSettings::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings);
             }
@@ -250,7 +291,7 @@ namespace storm {
             }
 
             STORM_LOG_INFO("Performing bisimulation minimization...");
-            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType, bisimulationSettings.isSignatureRefinementSet());
         }
 
         template <typename ValueType>
@@ -281,6 +322,10 @@ namespace storm {
                 storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), input.model ? input.model.get().getParameterNames() : std::vector<std::string>());
             }
 
+            if (ioSettings.isExportBinarySet()) {
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBinaryFilename());
+            }
+
             if (ioSettings.isExportDotSet()) {
                 storm::api::exportSparseModelAsDot(model, ioSettings.getExportDotFilename());
             }
@@ -508,17 +553,24 @@ namespace storm {
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
+            
+            // The properties of an MDP share the results of the graph-based precomputations. Announcing them first allows
+            // expected reward properties with the same target states and optimization direction to be computed together.
+            auto precomputationCache = storm::api::createPrecomputationCache<ValueType>(sparseModel);
+            for (auto const& property : input.properties) {
+                storm::api::announceTask<ValueType>(sparseModel, storm::api::createTask<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula()->isInitialFormula()), precomputationCache);
+            }
             verifyProperties<ValueType>(input.properties,
-                                        [&sparseModel] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                                        [&sparseModel, &precomputationCache] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
                                             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task);
+                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task, precomputationCache);
 
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
                                             if (filterForInitialStates) {
                                                 filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
                                             } else {
-                                                filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(states, false));
+                                                filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(states, false), precomputationCache);
                                             }
                                             if (result && filter) {
                                                 result->filter(filter->asQualitativeCheckResult());
@@ -573,6 +625,11 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueType, double>::value, void>::type verifySymbolicModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
+            // Interval iteration is only implemented for the sparse min/max solvers. Some executables do not register
+            // the min/max settings, so they can not select it.
+            bool intervalIteration = storm::settings::hasModule<storm::settings::modules::MinMaxEquationSolverSettings>() && storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getMinMaxEquationSolvingMethod() == storm::solver::MinMaxMethod::IntervalIteration;
+            STORM_LOG_THROW(!intervalIteration || !model->isOfType(storm::models::ModelType::Mdp), storm::exceptions::InvalidSettingsException, "Interval iteration ('--" << storm::settings::modules::MinMaxEquationSolverSettings::moduleName << ":method ii') is not available in the hybrid and dd engines. Please select a different min/max method or use the sparse engine.");
+            
             bool hybrid = coreSettings.getEngine() == storm::settings::modules::CoreSettings::Engine::Hybrid;
             if (hybrid) {
                 verifyWithHybridEngine<DdType, ValueType>(model, input);
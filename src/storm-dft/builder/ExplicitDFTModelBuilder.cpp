@@ -331,8 +331,8 @@ namespace storm {
                 STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
                 // Remove it from the list of not explored states
                 statesNotExplored.erase(itFind);
-                STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
-                STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
+                STORM_LOG_ASSERT(stateStorage.findState(currentState->status()), "State is not contained in state storage.");
+                STORM_LOG_ASSERT(stateStorage.findState(currentState->status()).get() == currentId, "Ids of states do not coincide.");
 
                 // Get concrete state if necessary
                 if (currentState->isPseudoState()) {
@@ -451,9 +451,8 @@ namespace storm {
             if (mergeFailedStates) {
                 modelComponents.stateLabeling.addLabelToState("failed", failedStateId);
             }
-            for (auto const& stateIdPair : stateStorage.stateToId) {
-                storm::storage::BitVector state = stateIdPair.first;
-                size_t stateId = matrixBuilder.getRemapping(stateIdPair.second);
+            stateStorage.forEachState([&] (storm::storage::BitVector const& state, StateType storedId) {
+                size_t stateId = matrixBuilder.getRemapping(storedId);
                 if (!mergeFailedStates && labelOpts.buildFailLabel && dft.hasFailed(state, *stateGenerationInfo)) {
                     modelComponents.stateLabeling.addLabelToState("failed", stateId);
                 }
@@ -467,7 +466,7 @@ namespace storm {
                         modelComponents.stateLabeling.addLabelToState(element->name() + "_fail", stateId);
                     }
                 }
-            }
+            });
 
             STORM_LOG_TRACE(modelComponents.stateLabeling);
         }
@@ -773,9 +772,10 @@ namespace storm {
                 STORM_LOG_TRACE("State " << (changed ? "changed to " : "did not change") << (changed ? dft.getStateString(state) : ""));
             }
 
-            if (stateStorage.stateToId.contains(state->status())) {
+            boost::optional<StateType> existingStateId = stateStorage.findState(state->status());
+            if (existingStateId) {
                 // State already exists
-                stateId = stateStorage.stateToId.getValue(state->status());
+                stateId = existingStateId.get();
                 STORM_LOG_TRACE("State " << dft.getStateString(state) << " with id " << stateId << " already exists");
                 if (!changed) {
                     // Check if state is pseudo state
@@ -798,7 +798,7 @@ namespace storm {
                 STORM_LOG_ASSERT(state->isPseudoState() == changed, "State type (pseudo/concrete) wrong.");
                 // Create new state
                 state->setId(newIndex++);
-                stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
+                stateId = stateStorage.findOrAddState(state->status(), state->getId());
                 STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
                 // Insert state as not yet explored
                 ExplorationHeuristicPointer nullHeuristic;
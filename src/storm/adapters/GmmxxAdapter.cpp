@@ -19,6 +19,7 @@ namespace storm {
             std::unique_ptr<gmm::csr_matrix<T>> result(new gmm::csr_matrix<T>(matrix.getRowCount(), matrix.getColumnCount()));
             
             // Copy Row Indications
+            matrix.ensureStandardLayout();
             std::copy(matrix.rowIndications.begin(), matrix.rowIndications.end(), result->jc.begin());
             
             // Copy columns and values.
@@ -7,8 +7,10 @@
 #include "storm/settings/modules/JaniExportSettings.h"
 
 #include "storm/utility/DirectEncodingExporter.h"
+#include "storm/utility/BinaryModelExporter.h"
 #include "storm/utility/file.h"
 #include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace api {
@@ -25,6 +27,19 @@ namespace storm {
             storm::utility::closeFile(stream);
         }
         
+        template <typename ValueType>
+        void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models can not be exported in the binary format.");
+        }
+        
+        template <>
+        inline void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& filename) {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream, false, true);
+            storm::exporter::exportSparseModelAsBinary(stream, model);
+            storm::utility::closeFile(stream);
+        }
+        
         template <typename ValueType>
         void exportSparseModelAsDot(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
             std::ofstream stream;
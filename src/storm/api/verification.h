@@ -114,9 +114,12 @@ namespace storm {
         }
         
         template<typename ValueType>
-        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>> const& precomputationCache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+            if (precomputationCache) {
+                modelchecker.setPrecomputationCache(precomputationCache);
+            }
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(task);
             }
@@ -124,7 +127,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&, std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>> const& = nullptr) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MDPs with this data type.");
         }
 
@@ -151,12 +154,49 @@ namespace storm {
         }
                                                                                                                                                                           
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>>>::type createPrecomputationCache(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            if (model->getType() == storm::models::ModelType::Mdp) {
+                return std::make_shared<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>>();
+            }
+            return nullptr;
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>>>::type createPrecomputationCache(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&) {
+            return nullptr;
+        }
+        
+        /*!
+         * Announces that the task will be verified on the given model with the given cache. For MDPs, announced
+         * expected reward queries with the same target states and optimization direction are computed together.
+         */
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, void>::type announceTask(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>> const& precomputationCache) {
+            if (precomputationCache && model->getType() == storm::models::ModelType::Mdp) {
+                storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*model->template as<storm::models::sparse::Mdp<ValueType>>());
+                modelchecker.setPrecomputationCache(precomputationCache);
+                if (modelchecker.canHandle(task)) {
+                    modelchecker.announceTask(task);
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, void>::type announceTask(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&, std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>> const&) {
+            // Intentionally left empty.
+        }
+        
+        /*!
+         * Verifies the task on the given model. For MDPs, the graph-based precomputations are stored in (and taken
+         * from) the given cache, if any, which allows several tasks on the same model to share them.
+         */
+        template<typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>> const& precomputationCache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             if (model->getType() == storm::models::ModelType::Dtmc) {
                 result = verifyWithSparseEngine(model->template as<storm::models::sparse::Dtmc<ValueType>>(), task);
             } else if (model->getType() == storm::models::ModelType::Mdp) {
-                result = verifyWithSparseEngine(model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+                result = verifyWithSparseEngine(model->template as<storm::models::sparse::Mdp<ValueType>>(), task, precomputationCache);
             } else if (model->getType() == storm::models::ModelType::Ctmc) {
                 result = verifyWithSparseEngine(model->template as<storm::models::sparse::Ctmc<ValueType>>(), task);
             } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
@@ -36,7 +36,7 @@ namespace storm {
             return boost::get<storm::expressions::Expression>(labelOrExpression);
         }
         
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), explorationChecks(false), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), explorationChecks(false), compileExpressions(false), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -58,6 +58,7 @@ namespace storm {
             auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
             auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
             explorationChecks = buildSettings.isExplorationChecksSet();
+            compileExpressions = buildSettings.isCompileExpressionsSet();
             showProgress = generalSettings.isVerboseSet();
             showProgressDelay = generalSettings.getShowProgressDelay();
         }
@@ -169,6 +170,10 @@ namespace storm {
             return explorationChecks;
         }
         
+        bool BuilderOptions::isCompileExpressionsSet() const {
+            return compileExpressions;
+        }
+        
         bool BuilderOptions::isShowProgressSet() const {
             return showProgress;
         }
@@ -182,6 +187,11 @@ namespace storm {
             return *this;
         }
         
+        BuilderOptions& BuilderOptions::setCompileExpressions(bool newValue) {
+            compileExpressions = newValue;
+            return *this;
+        }
+        
         BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
             STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
             rewardModelNames.emplace_back(rewardModelName);
@@ -106,6 +106,7 @@ namespace storm {
             bool isBuildAllRewardModelsSet() const;
             bool isBuildAllLabelsSet() const;
             bool isExplorationChecksSet() const;
+            bool isCompileExpressionsSet() const;
             bool isShowProgressSet() const;
             uint64_t getShowProgressDelay() const;
 
@@ -155,6 +156,12 @@ namespace storm {
              * @return this
              */
             BuilderOptions& setExplorationChecks(bool newValue = true);
+            /**
+             * Should the guards and updates be compiled to programs that are evaluated directly on the compressed states?
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setCompileExpressions(bool newValue = true);
             
         private:
             /// A flag that indicates whether all reward models are to be built. In this case, the reward model names are
@@ -189,6 +196,9 @@ namespace storm {
             /// A flag that stores whether exploration checks are to be performed.
             bool explorationChecks;
             
+            /// A flag that stores whether guards and updates are to be compiled instead of being interpreted.
+            bool compileExpressions;
+            
             /// A flag that stores whether the progress of exploration is to be printed.
             bool showProgress;
             
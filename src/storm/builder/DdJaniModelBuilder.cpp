@@ -1,5 +1,6 @@
 #include "storm/builder/DdJaniModelBuilder.h"
 
+#include <functional>
 #include <sstream>
 
 #include <boost/algorithm/string/join.hpp>
@@ -46,18 +47,18 @@ namespace storm {
     namespace builder {
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), metaVariableOrder() {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), metaVariableOrder() {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), metaVariableOrder() {
             if (!formulas.empty()) {
                 for (auto const& formula : formulas) {
                     this->preserveFormula(*formula);
@@ -261,7 +262,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, boost::optional<std::vector<std::string>> const& metaVariableOrder = boost::none) : model(model), automata(), actionInformation(actionInformation), metaVariableOrder(metaVariableOrder) {
                 // Intentionally left empty.
             }
             
@@ -327,25 +328,43 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.markovNondeterminismVariable);
                 }
                 
-                for (auto const& automatonName : this->automata) {
-                    storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
-                    
-                    // Start by creating a meta variable for the location of the automaton.
-                    storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-                    result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-                    result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-                    result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-                    result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-                    
-                    // Add the location variable to the row/column variables.
-                    result.rowMetaVariables.insert(variablePair.first);
-                    result.columnMetaVariables.insert(variablePair.second);
+                // If an order of the meta variables was given, we first create the meta variables of the location
+                // and state variables appearing in it in this order. The remaining ones are created in the order of
+                // declaration.
+                if (metaVariableOrder) {
+                    std::map<std::string, storm::jani::Automaton const*> locationVariableToAutomaton;
+                    std::map<std::string, storm::jani::Variable const*> variables;
+                    for (auto const& automatonName : this->automata) {
+                        locationVariableToAutomaton["l_" + automatonName] = &this->model.getAutomaton(automatonName);
+                    }
+                    for (auto const& variable : this->model.getGlobalVariables()) {
+                        if (!variable.isTransient()) {
+                            variables[variable.getExpressionVariable().getName()] = &variable;
+                        }
+                    }
+                    for (auto const& automaton : this->model.getAutomata()) {
+                        for (auto const& variable : automaton.getVariables()) {
+                            if (!variable.isTransient()) {
+                                variables[variable.getExpressionVariable().getName()] = &variable;
+                            }
+                        }
+                    }
                     
-                    // Add the legal range for the location variables.
-                    result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-                    result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+                    for (auto const& name : metaVariableOrder.get()) {
+                        auto automatonIt = locationVariableToAutomaton.find(name);
+                        if (automatonIt != locationVariableToAutomaton.end()) {
+                            createLocationVariable(*automatonIt->second, result);
+                            continue;
+                        }
+                        auto variableIt = variables.find(name);
+                        if (variableIt != variables.end()) {
+                            createVariable(*variableIt->second, result);
+                        }
+                    }
+                }
+                
+                for (auto const& automatonName : this->automata) {
+                    createLocationVariable(this->model.getAutomaton(automatonName), result);
                 }
                 
                 // Create global variables.
@@ -397,7 +416,35 @@ namespace storm {
                 return result;
             }
             
+            void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+                // Skip the location variable if it was already created.
+                if (result.automatonToLocationDdVariableMap.find(automaton.getName()) != result.automatonToLocationDdVariableMap.end()) {
+                    return;
+                }
+                
+                storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+                result.rowColumnMetaVariablePairs.push_back(variablePair);
+                
+                result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+                result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+                
+                // Add the location variable to the row/column variables.
+                result.rowMetaVariables.insert(variablePair.first);
+                result.columnMetaVariables.insert(variablePair.second);
+                
+                // Add the legal range for the location variables.
+                result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+                result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
+                // Skip the variable if it was already created.
+                if (result.variableToRowMetaVariableMap->find(variable.getExpressionVariable()) != result.variableToRowMetaVariableMap->end()) {
+                    return;
+                }
+                
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
                 } else if (variable.isBoundedIntegerVariable()) {
@@ -453,6 +500,7 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            boost::optional<std::vector<std::string>> metaVariableOrder;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1103,8 +1151,8 @@ namespace storm {
                     }
                     
                     uint64_t numberOfLocalNondeterminismVariables = static_cast<uint64_t>(std::ceil(std::log2(actions.size())));
-                    storm::dd::Bdd<Type> guard = this->variables.manager->getBddZero();
-                    storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Bdd<Type>> guards;
+                    std::vector<storm::dd::Add<Type, ValueType>> encodedTransitions;
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToWritingFragment;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
@@ -1112,10 +1160,10 @@ namespace storm {
                     for (uint64_t actionIndex = 0; actionIndex < actions.size(); ++actionIndex) {
                         ActionDd& action = actions[actionIndex];
 
-                        guard |= action.guard;
+                        guards.push_back(action.guard);
 
                         storm::dd::Add<Type, ValueType> nondeterminismEncoding = encodeIndex(actionIndex, highestLocalNondeterminismVariable, numberOfLocalNondeterminismVariables, this->variables);
-                        transitions += nondeterminismEncoding * action.transitions;
+                        encodedTransitions.push_back(nondeterminismEncoding * action.transitions);
                         
                         joinTransientAssignmentMaps(transientEdgeAssignments, action.transientEdgeAssignments);
                         
@@ -1126,6 +1174,8 @@ namespace storm {
                         addToVariableWritingFragmentMap(variableToWritingFragment, action.variableToWritingFragment);
                         illegalFragment |= action.illegalFragment;
                     }
+                    storm::dd::Bdd<Type> guard = storm::utility::dd::combineBalanced(std::move(guards), this->variables.manager->getBddZero(), [] (storm::dd::Bdd<Type> const& first, storm::dd::Bdd<Type> const& second) { return first || second; });
+                    storm::dd::Add<Type, ValueType> transitions = storm::utility::dd::combineBalanced(std::move(encodedTransitions), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
                     
                     return ActionDd(guard, transitions, transientEdgeAssignments, std::make_pair(lowestLocalNondeterminismVariable, highestLocalNondeterminismVariable + numberOfLocalNondeterminismVariables), variableToWritingFragment, illegalFragment);
                 } else {
@@ -1197,10 +1247,11 @@ namespace storm {
                     }
                     
                     // Now combine the destination DDs to the edge DD.
-                    storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> destinationTransitions;
                     for (auto const& destinationDd : destinationDds) {
-                        transitions += destinationDd.transitions;
+                        destinationTransitions.push_back(destinationDd.transitions);
                     }
+                    storm::dd::Add<Type, ValueType> transitions = storm::utility::dd::combineBalanced(std::move(destinationTransitions), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
                     
                     // Add the source location and the guard.
                     storm::dd::Add<Type, ValueType> sourceLocationAndGuard = this->variables.manager->getEncoding(this->variables.automatonToLocationDdVariableMap.at(automaton.getName()).first, edge.getSourceLocationIndex()).template toAdd<ValueType>() * guard.template toAdd<ValueType>();
@@ -1233,24 +1284,23 @@ namespace storm {
             }
             
             EdgeDd combineMarkovianEdgesToSingleEdge(std::vector<EdgeDd> const& edgeDds) {
-                storm::dd::Bdd<Type> guard = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Bdd<Type>> guards;
+                std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
                 std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToWritingFragment;
 
-                bool overlappingGuards = false;
                 for (auto const& edge : edgeDds) {
                     STORM_LOG_THROW(edge.isMarkovian, storm::exceptions::WrongFormatException, "Can only combine Markovian edges.");
                     
-                    if (!overlappingGuards) {
-                        overlappingGuards |= !(guard && edge.guard).isZero();
-                    }
-                    
-                    guard |= edge.guard;
-                    transitions += edge.transitions;
+                    guards.push_back(edge.guard);
+                    edgeTransitions.push_back(edge.transitions);
                     variableToWritingFragment = joinVariableWritingFragmentMaps(variableToWritingFragment, edge.variableToWritingFragment);
                     joinTransientAssignmentMaps(transientEdgeAssignments, edge.transientEdgeAssignments);
                 }
+                
+                bool overlappingGuards = false;
+                storm::dd::Bdd<Type> guard = combineGuards(std::move(guards), overlappingGuards);
+                storm::dd::Add<Type, ValueType> transitions = storm::utility::dd::combineBalanced(std::move(edgeTransitions), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
 
                 // Currently, we can only combine the transient edge assignments if there is no overlap of the guards of the edges.
                 STORM_LOG_THROW(!overlappingGuards || transientEdgeAssignments.empty(), storm::exceptions::NotSupportedException, "Cannot have transient edge assignments when combining Markovian edges with overlapping guards.");
@@ -1338,26 +1388,29 @@ namespace storm {
                 return result;
             }
 
+            /*!
+             * Computes the disjunction of the given guards and determines whether any two of them overlap. Since the
+             * guards are combined in a tree, every pair of overlapping guards is detected when their subtrees are joined.
+             */
+            storm::dd::Bdd<Type> combineGuards(std::vector<storm::dd::Bdd<Type>>&& guards, bool& overlappingGuards) const {
+                return storm::utility::dd::combineBalanced(std::move(guards), this->variables.manager->getBddZero(), [&overlappingGuards] (storm::dd::Bdd<Type> const& first, storm::dd::Bdd<Type> const& second) {
+                    overlappingGuards |= !(first && second).isZero();
+                    return first || second;
+                });
+            }
+            
             ActionDd combineEdgesToActionDeterministic(std::vector<EdgeDd> const& edgeDds) {
-                storm::dd::Bdd<Type> allGuards = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, ValueType> allTransitions = this->variables.manager->template getAddZero<ValueType>();
-                storm::dd::Bdd<Type> temporary;
+                std::vector<storm::dd::Bdd<Type>> guards;
+                std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
                 
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
                 std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
-                bool overlappingGuards = false;
                 for (auto const& edgeDd : edgeDds) {
                     STORM_LOG_THROW((this->model.getModelType() == storm::jani::ModelType::CTMC) == edgeDd.isMarkovian, storm::exceptions::WrongFormatException, "Unexpected non-Markovian edge in CTMC.");
                     
-                    // Check for overlapping guards.
-                    overlappingGuards = !(edgeDd.guard && allGuards).isZero();
-                    
-                    // Issue a warning if there are overlapping guards in a DTMC.
-                    STORM_LOG_WARN_COND(!overlappingGuards || this->model.getModelType() == storm::jani::ModelType::CTMC, "Guard of an edge in a DTMC overlaps with previous guards.");
-                    
                     // Add the elements of the current edge to the global ones.
-                    allGuards |= edgeDd.guard;
-                    allTransitions += edgeDd.transitions;
+                    guards.push_back(edgeDd.guard);
+                    edgeTransitions.push_back(edgeDd.transitions);
                     
                     // Add the transient variable assignments to the resulting one. This transformation is illegal for
                     // CTMCs for which there is some overlap in edges that have some transient assignment (this needs to
@@ -1367,6 +1420,13 @@ namespace storm {
                     // Keep track of the fragment that is writing global variables.
                     globalVariableToWritingFragment = joinVariableWritingFragmentMaps(globalVariableToWritingFragment, edgeDd.variableToWritingFragment);
                 }
+                
+                bool overlappingGuards = false;
+                storm::dd::Bdd<Type> allGuards = combineGuards(std::move(guards), overlappingGuards);
+                storm::dd::Add<Type, ValueType> allTransitions = storm::utility::dd::combineBalanced(std::move(edgeTransitions), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
+                
+                // Issue a warning if there are overlapping guards in a DTMC.
+                STORM_LOG_WARN_COND(!overlappingGuards || this->model.getModelType() == storm::jani::ModelType::CTMC, "Guards of edges in a DTMC overlap.");
 
                 STORM_LOG_THROW(this->model.getModelType() == storm::jani::ModelType::DTMC || !overlappingGuards || transientEdgeAssignments.empty(), storm::exceptions::NotSupportedException, "Cannot have transient edge assignments when combining Markovian edges with overlapping guards.");
                 
@@ -1407,14 +1467,14 @@ namespace storm {
                 bool addMarkovianFlag = this->model.getModelType() == storm::jani::ModelType::MA;
                 STORM_LOG_ASSERT(addMarkovianFlag || !markovianEdge, "Illegally adding Markovian edge without marker.");
                 
-                storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
                 std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                 
                 storm::dd::Bdd<Type> flagBdd = addMarkovianFlag ? !this->variables.markovMarker : this->variables.manager->getBddOne();
                 storm::dd::Add<Type, ValueType> flag = flagBdd.template toAdd<ValueType>();
                 for (auto const& edge : edges) {
-                    transitions += addMarkovianFlag ? flag * edge.transitions : edge.transitions;
+                    edgeTransitions.push_back(addMarkovianFlag ? flag * edge.transitions : edge.transitions);
                     for (auto const& assignment : edge.transientEdgeAssignments) {
                         addToTransientAssignmentMap(transientEdgeAssignments, assignment.first, addMarkovianFlag ? flag * assignment.second : assignment.second);
                     }
@@ -1422,6 +1482,7 @@ namespace storm {
                         addToVariableWritingFragmentMap(globalVariableToWritingFragment, variableFragment.first, addMarkovianFlag ? flagBdd && variableFragment.second : variableFragment.second);
                     }
                 }
+                storm::dd::Add<Type, ValueType> transitions = storm::utility::dd::combineBalanced(std::move(edgeTransitions), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
                 
                 // Add the Markovian edge (if any).
                 if (markovianEdge) {
@@ -1443,13 +1504,15 @@ namespace storm {
             
             ActionDd combineEdgesToActionNondeterministic(std::vector<EdgeDd> const& nonMarkovianEdges, boost::optional<EdgeDd> const& markovianEdge, uint64_t localNondeterminismVariableOffset) {
                 // Sum all guards, so we can read off the maximal number of nondeterministic choices in any given state.
-                storm::dd::Bdd<Type> allGuards = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, uint_fast64_t> sumOfGuards = this->variables.manager->template getAddZero<uint_fast64_t>();
+                std::vector<storm::dd::Bdd<Type>> guards;
+                std::vector<storm::dd::Add<Type, uint_fast64_t>> guardAdds;
                 for (auto const& edge : nonMarkovianEdges) {
                     STORM_LOG_ASSERT(!edge.isMarkovian, "Unexpected Markovian edge.");
-                    sumOfGuards += edge.guard.template toAdd<uint_fast64_t>();
-                    allGuards |= edge.guard;
+                    guards.push_back(edge.guard);
+                    guardAdds.push_back(edge.guard.template toAdd<uint_fast64_t>());
                 }
+                storm::dd::Bdd<Type> allGuards = storm::utility::dd::combineBalanced(std::move(guards), this->variables.manager->getBddZero(), [] (storm::dd::Bdd<Type> const& first, storm::dd::Bdd<Type> const& second) { return first || second; });
+                storm::dd::Add<Type, uint_fast64_t> sumOfGuards = storm::utility::dd::combineBalanced(std::move(guardAdds), this->variables.manager->template getAddZero<uint_fast64_t>(), std::plus<storm::dd::Add<Type, uint_fast64_t>>());
                 uint_fast64_t maxChoices = sumOfGuards.getMax();
                 STORM_LOG_TRACE("Found " << maxChoices << " non-Markovian local choices.");
                 
@@ -1535,9 +1598,11 @@ namespace storm {
                         }
                         
                         // Add the meta variables that encode the nondeterminisim to the different choices.
+                        std::vector<storm::dd::Add<Type, ValueType>> encodedChoiceDds;
                         for (uint_fast64_t j = 0; j < currentChoices; ++j) {
-                            allEdges += indicesEncodedWithLocalNondeterminismVariables[j].second * choiceDds[j];
+                            encodedChoiceDds.push_back(indicesEncodedWithLocalNondeterminismVariables[j].second * choiceDds[j]);
                         }
+                        allEdges += storm::utility::dd::combineBalanced(std::move(encodedChoiceDds), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
                         
                         // Delete currentChoices out of overlapping DD
                         sumOfGuards = sumOfGuards * (!equalsNumberOfChoicesDd).template toAdd<uint_fast64_t>();
@@ -1638,7 +1703,7 @@ namespace storm {
             ComposerResult<Type, ValueType> buildSystemFromAutomaton(AutomatonDd& automaton) {
                 // If the model is an MDP, we need to encode the nondeterminism using additional variables.
                 if (this->model.getModelType() == storm::jani::ModelType::MDP || this->model.getModelType() == storm::jani::ModelType::LTS) {
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     
                     // First, determine the highest number of nondeterminism variables that is used in any action and make
@@ -1662,14 +1727,15 @@ namespace storm {
                             addToTransientAssignmentMap(transientEdgeAssignments, transientAssignment.first, actionEncoding * missingNondeterminismEncoding * transientAssignment.second);
                         }
                         
-                        result += extendedTransitions;
+                        actionTransitions.push_back(extendedTransitions);
                     }
+                    storm::dd::Add<Type, ValueType> result = storm::utility::dd::combineBalanced(std::move(actionTransitions), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
                     
                     return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
                 } else if (this->model.getModelType() == storm::jani::ModelType::DTMC || this->model.getModelType() == storm::jani::ModelType::CTMC) {
                     // Simply add all actions, but make sure to include the missing global variable identities.
 
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::unordered_set<uint64_t> actionIndices;
@@ -1679,8 +1745,9 @@ namespace storm {
                         illegalFragment |= action.second.illegalFragment;
                         addMissingGlobalVariableIdentities(action.second);
                         addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
-                        result += action.second.transitions;
+                        actionTransitions.push_back(action.second.transitions);
                     }
+                    storm::dd::Add<Type, ValueType> result = storm::utility::dd::combineBalanced(std::move(actionTransitions), this->variables.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
 
                     return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
                 } else {
@@ -1954,7 +2021,7 @@ namespace storm {
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, options.metaVariableOrder);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
@@ -103,6 +103,11 @@ namespace storm {
                 // An optional expression or label whose negation characterizes (a subset of) the terminal states of the
                 // model. If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 boost::optional<storm::expressions::Expression> negatedTerminalStates;
+                
+                // An optional order of meta variables (e.g. one that was exported after reordering the DDs of an earlier
+                // run). If this is set, the meta variables of the state variables appearing in it are created in this
+                // order and before all other state variables.
+                boost::optional<std::vector<std::string>> metaVariableOrder;
             };
                         
             /*!
@@ -1,5 +1,7 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 
+#include <functional>
+
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/models/symbolic/Dtmc.h"
@@ -92,10 +94,10 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
         public:
-            GenerationInformation(storm::prism::Program const& program) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
+            GenerationInformation(storm::prism::Program const& program, boost::optional<std::vector<std::string>> const& metaVariableOrder = boost::none) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
                 
                 // Initializes variables and identity DDs.
-                createMetaVariablesAndIdentities();
+                createMetaVariablesAndIdentities(metaVariableOrder);
                 
                 // Initialize the parameters (if any).
                 ParameterCreator<Type, ValueType> parameterCreator;
@@ -154,8 +156,11 @@ namespace storm {
         private:
             /*!
              * Creates the required meta variables and variable/module identities.
+             *
+             * @param metaVariableOrder If given, the meta variables of the program variables appearing in it are
+             * created first and in this order.
              */
-            void createMetaVariablesAndIdentities() {
+            void createMetaVariablesAndIdentities(boost::optional<std::vector<std::string>> const& metaVariableOrder) {
                 // Add synchronization variables.
                 for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
                     std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -175,41 +180,46 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
+                // If an order of the meta variables was given, we first create the meta variables of the program
+                // variables appearing in it in this order. The remaining ones are created in the order of declaration.
+                if (metaVariableOrder) {
+                    std::map<std::string, storm::prism::IntegerVariable const*> integerVariables;
+                    std::map<std::string, storm::prism::BooleanVariable const*> booleanVariables;
+                    for (auto const& integerVariable : program.getGlobalIntegerVariables()) {
+                        integerVariables[integerVariable.getName()] = &integerVariable;
+                    }
+                    for (auto const& booleanVariable : program.getGlobalBooleanVariables()) {
+                        booleanVariables[booleanVariable.getName()] = &booleanVariable;
+                    }
+                    for (auto const& module : program.getModules()) {
+                        for (auto const& integerVariable : module.getIntegerVariables()) {
+                            integerVariables[integerVariable.getName()] = &integerVariable;
+                        }
+                        for (auto const& booleanVariable : module.getBooleanVariables()) {
+                            booleanVariables[booleanVariable.getName()] = &booleanVariable;
+                        }
+                    }
+                    
+                    for (auto const& name : metaVariableOrder.get()) {
+                        auto integerIt = integerVariables.find(name);
+                        if (integerIt != integerVariables.end()) {
+                            createMetaVariables(*integerIt->second);
+                            continue;
+                        }
+                        auto booleanIt = booleanVariables.find(name);
+                        if (booleanIt != booleanVariables.end()) {
+                            createMetaVariables(*booleanIt->second);
+                        }
+                    }
+                }
+                
                 // Create meta variables for global program variables.
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                    
-                    STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                    
-                    rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                    
-                    columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                    
-                    storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    rowColumnMetaVariablePairs.push_back(variablePair);
-                    
+                    createMetaVariables(integerVariable);
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                    
-                    STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                    
-                    rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                    
-                    columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                    
-                    storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    
-                    rowColumnMetaVariablePairs.push_back(variablePair);
+                    createMetaVariables(booleanVariable);
                     allGlobalVariables.insert(booleanVariable.getExpressionVariable());
                 }
                 
@@ -219,45 +229,75 @@ namespace storm {
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = createMetaVariables(integerVariable);
+                        moduleIdentity &= variableToIdentityMap.at(integerVariable.getExpressionVariable()).toBdd();
                         moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = createMetaVariables(booleanVariable);
+                        moduleIdentity &= variableToIdentityMap.at(booleanVariable.getExpressionVariable()).toBdd();
                         moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
                     }
                     moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
                     moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
                 }
             }
+            
+            /*!
+             * Creates the meta variables and the identity for the given integer variable (if this was not done before).
+             *
+             * @return The row and column meta variable of the variable.
+             */
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> createMetaVariables(storm::prism::IntegerVariable const& integerVariable) {
+                auto rowMetaVariableIt = variableToRowMetaVariableMap->find(integerVariable.getExpressionVariable());
+                if (rowMetaVariableIt != variableToRowMetaVariableMap->end()) {
+                    return std::make_pair(rowMetaVariableIt->second, variableToColumnMetaVariableMap->at(integerVariable.getExpressionVariable()));
+                }
+                
+                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
+                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                
+                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                
+                addMetaVariables(integerVariable.getExpressionVariable(), variablePair);
+                return variablePair;
+            }
+            
+            /*!
+             * Creates the meta variables and the identity for the given boolean variable (if this was not done before).
+             *
+             * @return The row and column meta variable of the variable.
+             */
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> createMetaVariables(storm::prism::BooleanVariable const& booleanVariable) {
+                auto rowMetaVariableIt = variableToRowMetaVariableMap->find(booleanVariable.getExpressionVariable());
+                if (rowMetaVariableIt != variableToRowMetaVariableMap->end()) {
+                    return std::make_pair(rowMetaVariableIt->second, variableToColumnMetaVariableMap->at(booleanVariable.getExpressionVariable()));
+                }
+                
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                
+                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                
+                addMetaVariables(booleanVariable.getExpressionVariable(), variablePair);
+                return variablePair;
+            }
+            
+            /*!
+             * Registers the given freshly created meta variables for the given program variable.
+             */
+            void addMetaVariables(storm::expressions::Variable const& variable, std::pair<storm::expressions::Variable, storm::expressions::Variable> const& variablePair) {
+                rowMetaVariables.insert(variablePair.first);
+                variableToRowMetaVariableMap->emplace(variable, variablePair.first);
+                
+                columnMetaVariables.insert(variablePair.second);
+                variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
+                
+                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
+                variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
+                
+                rowColumnMetaVariablePairs.push_back(variablePair);
+            }
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -540,18 +580,18 @@ namespace storm {
         };
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), metaVariableOrder() {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates(), metaVariableOrder() {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), metaVariableOrder() {
             for (auto const& formula : formulas) {
                 this->preserveFormula(*formula);
             }
@@ -724,12 +764,13 @@ namespace storm {
                 }
                 
                 // Now combine the update DDs to the command DD.
-                storm::dd::Add<Type, ValueType> commandDd = generationInfo.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> weightedUpdateDds;
                 auto updateResultsIt = updateResults.begin();
                 for (auto updateIt = command.getUpdates().begin(), updateIte = command.getUpdates().end(); updateIt != updateIte; ++updateIt, ++updateResultsIt) {
                     storm::dd::Add<Type, ValueType> probabilityDd = generationInfo.rowExpressionAdapter->translateExpression(updateIt->getLikelihoodExpression());
-                    commandDd += updateResultsIt->updateDd * probabilityDd;
+                    weightedUpdateDds.push_back(updateResultsIt->updateDd * probabilityDd);
                 }
+                storm::dd::Add<Type, ValueType> commandDd = storm::utility::dd::combineBalanced(std::move(weightedUpdateDds), generationInfo.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
                 
                 return ActionDecisionDiagram(guard, guard.template toAdd<ValueType>() * commandDd, globalVariablesInSomeUpdate);
             } else {
@@ -819,25 +860,29 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::combineCommandsToActionMarkovChain(GenerationInformation& generationInfo, std::vector<ActionDecisionDiagram>& commandDds) {
-            storm::dd::Bdd<Type> allGuards = generationInfo.manager->getBddZero();
-            storm::dd::Add<Type, ValueType> allCommands = generationInfo.manager->template getAddZero<ValueType>();
-            storm::dd::Bdd<Type> temporary;
-            
             // Make all command DDs assign to the same global variables.
             std::set<storm::expressions::Variable> assignedGlobalVariables = equalizeAssignedGlobalVariables(generationInfo, commandDds);
             
-            // Then combine the commands to the full action DD and multiply missing identities along the way.
-            for (auto& commandDd : commandDds) {
-                // Check for overlapping guards.
-                temporary = commandDd.guardDd && allGuards;
-                
-                // Issue a warning if there are overlapping guards in a non-CTMC model.
-                STORM_LOG_WARN_COND(temporary.isZero() || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC, "Guard of a command overlaps with previous guards.");
-                
-                allGuards |= commandDd.guardDd;
-                allCommands += commandDd.transitionsDd;
+            // Then combine the commands to the full action DD.
+            std::vector<storm::dd::Bdd<Type>> guardDds;
+            std::vector<storm::dd::Add<Type, ValueType>> transitionsDds;
+            for (auto const& commandDd : commandDds) {
+                guardDds.push_back(commandDd.guardDd);
+                transitionsDds.push_back(commandDd.transitionsDd);
             }
             
+            // While combining the guards, we check whether they overlap. Since the guards are combined in a tree, any
+            // pair of overlapping guards is detected when their subtrees are joined.
+            bool overlappingGuards = false;
+            storm::dd::Bdd<Type> allGuards = storm::utility::dd::combineBalanced(std::move(guardDds), generationInfo.manager->getBddZero(), [&overlappingGuards] (storm::dd::Bdd<Type> const& first, storm::dd::Bdd<Type> const& second) {
+                overlappingGuards |= !(first && second).isZero();
+                return first || second;
+            });
+            storm::dd::Add<Type, ValueType> allCommands = storm::utility::dd::combineBalanced(std::move(transitionsDds), generationInfo.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
+            
+            // Issue a warning if there are overlapping guards in a non-CTMC model.
+            STORM_LOG_WARN_COND(!overlappingGuards || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC, "Guards of commands overlap.");
+            
             return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
         }
         
@@ -862,18 +907,20 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::combineCommandsToActionMDP(GenerationInformation& generationInfo, std::vector<ActionDecisionDiagram>& commandDds, uint_fast64_t nondeterminismVariableOffset) {
-            storm::dd::Bdd<Type> allGuards = generationInfo.manager->getBddZero();
             storm::dd::Add<Type, ValueType> allCommands = generationInfo.manager->template getAddZero<ValueType>();
             
             // Make all command DDs assign to the same global variables.
             std::set<storm::expressions::Variable> assignedGlobalVariables = equalizeAssignedGlobalVariables(generationInfo, commandDds);
             
             // Sum all guards, so we can read off the maximal number of nondeterministic choices in any given state.
-            storm::dd::Add<Type, uint_fast64_t> sumOfGuards = generationInfo.manager->template getAddZero<uint_fast64_t>();
+            std::vector<storm::dd::Bdd<Type>> guardDds;
+            std::vector<storm::dd::Add<Type, uint_fast64_t>> guardAdds;
             for (auto const& commandDd : commandDds) {
-                sumOfGuards += commandDd.guardDd.template toAdd<uint_fast64_t>();
-                allGuards |= commandDd.guardDd;
+                guardDds.push_back(commandDd.guardDd);
+                guardAdds.push_back(commandDd.guardDd.template toAdd<uint_fast64_t>());
             }
+            storm::dd::Bdd<Type> allGuards = storm::utility::dd::combineBalanced(std::move(guardDds), generationInfo.manager->getBddZero(), [] (storm::dd::Bdd<Type> const& first, storm::dd::Bdd<Type> const& second) { return first || second; });
+            storm::dd::Add<Type, uint_fast64_t> sumOfGuards = storm::utility::dd::combineBalanced(std::move(guardAdds), generationInfo.manager->template getAddZero<uint_fast64_t>(), std::plus<storm::dd::Add<Type, uint_fast64_t>>());
             uint_fast64_t maxChoices = sumOfGuards.getMax();
             
             STORM_LOG_TRACE("Found " << maxChoices << " local choices.");
@@ -883,9 +930,11 @@ namespace storm {
                 return ActionDecisionDiagram(*generationInfo.manager);
             } else if (maxChoices == 1) {
                 // Sum up all commands.
+                std::vector<storm::dd::Add<Type, ValueType>> transitionsDds;
                 for (auto const& commandDd : commandDds) {
-                    allCommands += commandDd.transitionsDd;
+                    transitionsDds.push_back(commandDd.transitionsDd);
                 }
+                allCommands = storm::utility::dd::combineBalanced(std::move(transitionsDds), allCommands, std::plus<storm::dd::Add<Type, ValueType>>());
                 return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
             } else {
                 // Calculate number of required variables to encode the nondeterminism.
@@ -945,9 +994,11 @@ namespace storm {
                     }
                     
                     // Add the meta variables that encode the nondeterminisim to the different choices.
+                    std::vector<storm::dd::Add<Type, ValueType>> encodedChoiceDds;
                     for (uint_fast64_t j = 0; j < currentChoices; ++j) {
-                        allCommands += encodeChoice(generationInfo, nondeterminismVariableOffset, numberOfBinaryVariables, j) * choiceDds[j];
+                        encodedChoiceDds.push_back(encodeChoice(generationInfo, nondeterminismVariableOffset, numberOfBinaryVariables, j) * choiceDds[j]);
                     }
+                    allCommands += storm::utility::dd::combineBalanced(std::move(encodedChoiceDds), generationInfo.manager->template getAddZero<ValueType>(), std::plus<storm::dd::Add<Type, ValueType>>());
                     
                     // Delete currentChoices out of overlapping DD
                     sumOfGuards = sumOfGuards * (!equalsNumberOfChoicesDd).template toAdd<uint_fast64_t>();
@@ -1342,7 +1393,7 @@ namespace storm {
             
             // Start by initializing the structure used for storing all information needed during the model generation.
             // In particular, this creates the meta variables used to encode the model.
-            GenerationInformation generationInfo(program);
+            GenerationInformation generationInfo(program, options.metaVariableOrder);
             
             SystemResult system = createSystemDecisionDiagram(generationInfo);
             storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
@@ -1,6 +1,9 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <limits>
 #include <map>
+#include <mutex>
+#include <numeric>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -9,6 +12,8 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/BuildSettings.h"
@@ -34,21 +39,25 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/builder.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/UnexpectedException.h"
 
 namespace storm {
     namespace builder {
                         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), compactMatrixLayout(storm::settings::getModule<storm::settings::modules::BuildSettings>().isCompactMatrixLayoutSet()), compactMatrixSimdLevel(storm::settings::getModule<storm::settings::modules::BuildSettings>().getSimdLevel()), explorationThreads(1), treeCompressedStateStorage(storm::settings::getModule<storm::settings::modules::BuildSettings>().isTreeCompressedStateStorageSet()) {
+            if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isParallelExplorationSet()) {
+                explorationThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount();
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(options.treeCompressedStateStorage ? storm::storage::sparse::StateStorage<StateType>(generator->getStateSize(), generator->getModuleBitOffsets()) : storm::storage::sparse::StateStorage<StateType>(generator->getStateSize())) {
             // Intentionally left empty.
         }
         
@@ -87,9 +96,7 @@ namespace storm {
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
             
             // Check, if the state was already registered.
-            std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
-            
-            StateType actualIndex = actualIndexBucketPair.first;
+            StateType actualIndex = stateStorage.findOrAddState(state, newIndex);
             
             if (actualIndex == newIndex) {
                 if (options.explorationOrder == ExplorationOrder::Dfs) {
@@ -157,92 +164,7 @@ namespace storm {
                 
                 generator->load(currentState);
                 storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-                
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-                        
-                        if (markovianStates) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-                        
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-                        
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-                            
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
-                    
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-                    
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        
-                        // add the generated choice information
-                        if (choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                choiceInformationBuilder.addLabel(label, currentRow);
-                            }
-                        }
-                        if (choice.hasOriginData()) {
-                            choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
-                        }
-                        
-                        // If we keep track of the Markovian choices, store whether the current one is Markovian.
-                        if (markovianStates && choice.isMarkovian()) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-                        
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                    }
-                    ++currentRowGroup;
-                }
+                addStateBehavior(currentState, currentIndex, behavior, nullptr, 0, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRow, currentRowGroup);
                 
                 if (generator->getOptions().isShowProgressSet()) {
                     ++numberOfExploredStatesSinceLastMessage;
@@ -286,7 +208,342 @@ namespace storm {
                 this->stateStorage.initialStateIndices = std::move(newInitialStateIndices);
                 
                 // Fix (c).
-                this->stateStorage.stateToId.remap([&remapping] (StateType const& state) { return remapping[state]; } );
+                this->stateStorage.remapStateIndices([&remapping] (StateType const& state) { return remapping[state]; } );
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::canExploreInParallel() const {
+            if (options.explorationThreads <= 1) {
+                return false;
+            }
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                STORM_LOG_WARN("Parallel exploration requires breadth-first exploration order. Falling back to sequential exploration.");
+                return false;
+            }
+            if (!std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN("Parallel exploration is only supported for floating point models. Falling back to sequential exploration.");
+                return false;
+            }
+            return true;
+        }
+        
+        namespace {
+            template <typename ValueType, typename StateType>
+            struct ParallelExplorationResult {
+                // The behavior of the state.
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+                
+                // The indices of the successors that were found in the current level in the order in which they were
+                // requested by the generator.
+                std::vector<StateType> successorsOfLevel;
+                
+                // The states that were added to the map of new states while expanding the state together with their indices.
+                std::vector<std::pair<StateType, CompressedState>> addedStates;
+                
+                // A flag indicating that the map of new states was full during the expansion, so the expansion needs
+                // to be repeated once the map has grown.
+                bool storageFull = false;
+            };
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesParallel(storm::utility::ThreadPool& pool, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
+            STORM_LOG_INFO("Exploring the state space with " << pool.getThreadCount() << " threads.");
+            
+            // Create markovian states bit vector, if required.
+            if (generator->getModelType() == storm::generator::ModelType::MA) {
+                // The bit vector will be resized when the correct size is known.
+                markovianStates = storm::storage::BitVector(1000);
+            }
+            
+            // Every thread needs a generator of its own. Since the tasks are not bound to threads, the generators are
+            // handed out to the tasks.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> availableGenerators = {generator};
+            std::mutex generatorMutex;
+            for (uint64_t index = 1; index < pool.getThreadCount(); ++index) {
+                std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> newGenerator = generator->clone();
+                if (!newGenerator) {
+                    break;
+                }
+                availableGenerators.push_back(newGenerator);
+            }
+            // Up to one task per thread runs at a time, so every thread needs to be able to take a generator.
+            if (availableGenerators.size() < pool.getThreadCount()) {
+                STORM_LOG_WARN("The next-state generator does not support parallel exploration. Falling back to sequential exploration.");
+                buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+                return;
+            }
+            
+            // The states that already have their final index are kept in the state storage only, which the threads
+            // may read while no state is added to it. The states that are found while expanding a level are collected
+            // in the following map and identified by their insertion order (shifted by the number of states known
+            // before the level). Once the level is expanded, they are moved to the state storage with their final
+            // indices, which are stored in newToFinalIndex, and the map is cleared.
+            storm::storage::ConcurrentBitVectorHashMap<StateType> newStates(generator->getStateSize(), 100000);
+            std::vector<StateType> newToFinalIndex;
+            StateType const unassignedIndex = std::numeric_limits<StateType>::max();
+            
+            // The states of the current level in the order of their final indices and the results of their expansion.
+            std::vector<CompressedState> currentLevel;
+            std::vector<ParallelExplorationResult<ValueType, StateType>> results(1);
+            
+            // Creates a callback for the given result that looks up the states in the state storage and assigns
+            // temporary indices to the new ones.
+            auto createStateToIdCallback = [this, &newStates] (ParallelExplorationResult<ValueType, StateType>& result, StateType levelOffset) {
+                return std::function<StateType (CompressedState const&)>([this, &newStates, &result, levelOffset] (CompressedState const& state) {
+                    boost::optional<StateType> knownIndex = this->stateStorage.findState(state);
+                    if (knownIndex) {
+                        return knownIndex.get();
+                    }
+                    
+                    boost::optional<std::pair<StateType, bool>> indexAddedPair = newStates.findOrAdd(state);
+                    if (!indexAddedPair) {
+                        // The index is irrelevant, since the expansion is going to be repeated anyway.
+                        result.storageFull = true;
+                        return static_cast<StateType>(0);
+                    }
+                    StateType index = levelOffset + indexAddedPair.get().first;
+                    result.successorsOfLevel.push_back(index);
+                    if (indexAddedPair.get().second) {
+                        result.addedStates.emplace_back(index, state);
+                    }
+                    return index;
+                });
+            };
+            
+            // Let the generator create all initial states. Since this happens sequentially, we can grow the map
+            // whenever it is full.
+            while (true) {
+                results.front().successorsOfLevel.clear();
+                results.front().storageFull = false;
+                this->stateStorage.initialStateIndices = generator->getInitialStates(createStateToIdCallback(results.front(), 0));
+                if (!results.front().storageFull) {
+                    break;
+                }
+                newStates.increaseSize();
+            }
+            
+            uint_fast64_t currentRowGroup = 0;
+            uint_fast64_t currentRow = 0;
+            StateType numberOfStates = 0;
+            StateType levelOffset = 0;
+            std::vector<CompressedState> statesOfLevel;
+            
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            
+            while (true) {
+                // Assign the final indices to the states that were found in the current level, in the order in which
+                // the sequential exploration requests them: level by level, state by state and within each state in
+                // the order of the calls to the callback.
+                newToFinalIndex.assign(newStates.size(), unassignedIndex);
+                statesOfLevel.resize(newStates.size());
+                for (auto& result : results) {
+                    for (auto& indexStatePair : result.addedStates) {
+                        statesOfLevel[indexStatePair.first - levelOffset] = std::move(indexStatePair.second);
+                    }
+                    result.addedStates.clear();
+                }
+                newStates.clear();
+                
+                std::vector<CompressedState> nextLevel;
+                for (auto const& result : results) {
+                    for (auto const& index : result.successorsOfLevel) {
+                        StateType& finalIndex = newToFinalIndex[index - levelOffset];
+                        if (finalIndex == unassignedIndex) {
+                            finalIndex = numberOfStates;
+                            this->stateStorage.findOrAddState(statesOfLevel[index - levelOffset], numberOfStates);
+                            nextLevel.push_back(std::move(statesOfLevel[index - levelOffset]));
+                            ++numberOfStates;
+                        }
+                    }
+                }
+                
+                if (currentLevel.empty()) {
+                    // The initial states were found before the first level was explored, so their indices need to be fixed.
+                    for (auto& initialStateIndex : this->stateStorage.initialStateIndices) {
+                        initialStateIndex = newToFinalIndex[initialStateIndex];
+                    }
+                }
+                
+                // Now that the final indices are known, we can add the behavior of the current level to the matrices.
+                for (uint64_t index = 0; index < currentLevel.size(); ++index) {
+                    StateType currentIndex = static_cast<StateType>(currentRowGroup);
+                    if (currentIndex % 100000 == 0) {
+                        STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+                    }
+                    addStateBehavior(currentLevel[index], currentIndex, results[index].behavior, &newToFinalIndex, levelOffset, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRow, currentRowGroup);
+                }
+                
+                if (generator->getOptions().isShowProgressSet()) {
+                    auto now = std::chrono::high_resolution_clock::now();
+                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                    if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                        std::cout << "Explored " << currentRowGroup << " states in " << durationSinceStart << " seconds (" << nextLevel.size() << " states in the next level)." << std::endl;
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                    }
+                }
+                
+                if (nextLevel.empty()) {
+                    break;
+                }
+                
+                // Expand all states of the next level in parallel. If the map of new states becomes full, the
+                // expansions that failed are repeated after growing the map.
+                currentLevel = std::move(nextLevel);
+                levelOffset = numberOfStates;
+                results = std::vector<ParallelExplorationResult<ValueType, StateType>>(currentLevel.size());
+                std::vector<uint64_t> pendingStates(currentLevel.size());
+                std::iota(pendingStates.begin(), pendingStates.end(), 0);
+                
+                while (!pendingStates.empty()) {
+                    std::vector<uint_fast8_t> failed(pendingStates.size(), 0);
+                    pool.parallelFor(pendingStates.size(), [] (uint64_t index) { return index; }, [&] (uint64_t begin, uint64_t end) {
+                        std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> localGenerator;
+                        {
+                            std::lock_guard<std::mutex> lock(generatorMutex);
+                            STORM_LOG_THROW(!availableGenerators.empty(), storm::exceptions::UnexpectedException, "No next-state generator is available for the exploration task.");
+                            localGenerator = availableGenerators.back();
+                            availableGenerators.pop_back();
+                        }
+                        
+                        for (uint64_t pendingIndex = begin; pendingIndex < end; ++pendingIndex) {
+                            uint64_t index = pendingStates[pendingIndex];
+                            ParallelExplorationResult<ValueType, StateType>& result = results[index];
+                            result.successorsOfLevel.clear();
+                            result.storageFull = false;
+                            localGenerator->load(currentLevel[index]);
+                            result.behavior = localGenerator->expand(createStateToIdCallback(result, levelOffset));
+                            if (result.storageFull) {
+                                failed[pendingIndex] = 1;
+                            }
+                        }
+                        
+                        std::lock_guard<std::mutex> lock(generatorMutex);
+                        availableGenerators.push_back(localGenerator);
+                    }, 16);
+                    
+                    std::vector<uint64_t> failedStates;
+                    for (uint64_t pendingIndex = 0; pendingIndex < pendingStates.size(); ++pendingIndex) {
+                        if (failed[pendingIndex]) {
+                            failedStates.push_back(pendingStates[pendingIndex]);
+                        }
+                    }
+                    if (!failedStates.empty()) {
+                        newStates.increaseSize();
+                    }
+                    pendingStates = std::move(failedStates);
+                }
+            }
+            
+            if (markovianStates) {
+                // Since we now know the correct size, cut the bit vector to the correct length.
+                markovianStates->resize(currentRowGroup, false);
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(CompressedState const& currentState, StateType currentIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* columnRemapping, StateType remappingOffset, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup) {
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                    }
+                    
+                    if (markovianStates) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+                    
+                    transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+                    
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+                        
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+                
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+                
+                // Now add all choices.
+                for (auto const& choice : behavior) {
+                    
+                    // add the generated choice information
+                    if (choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            choiceInformationBuilder.addLabel(label, currentRow);
+                        }
+                    }
+                    if (choice.hasOriginData()) {
+                        choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
+                    }
+                    
+                    // If we keep track of the Markovian choices, store whether the current one is Markovian.
+                    if (markovianStates && choice.isMarkovian()) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    // Add the probabilistic behavior to the matrix.
+                    if (columnRemapping) {
+                        // Since the distribution is sorted by the original indices, we need to sort the entries again.
+                        std::vector<std::pair<StateType, ValueType>> entries;
+                        entries.reserve(choice.size());
+                        for (auto const& stateProbabilityPair : choice) {
+                            StateType column = stateProbabilityPair.first < remappingOffset ? stateProbabilityPair.first : (*columnRemapping)[stateProbabilityPair.first - remappingOffset];
+                            entries.emplace_back(column, stateProbabilityPair.second);
+                        }
+                        std::sort(entries.begin(), entries.end(), [] (std::pair<StateType, ValueType> const& first, std::pair<StateType, ValueType> const& second) { return first.first < second.first; });
+                        for (auto const& stateProbabilityPair : entries) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    } else {
+                        for (auto const& stateProbabilityPair : choice) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    }
+                    
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                }
+                ++currentRowGroup;
             }
         }
         
@@ -306,11 +563,32 @@ namespace storm {
             ChoiceInformationBuilder choiceInformationBuilder;
             boost::optional<storm::storage::BitVector> markovianStates;
             
-            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+            if (canExploreInParallel()) {
+                storm::utility::ThreadPool pool(options.explorationThreads);
+                buildMatricesParallel(pool, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+            } else {
+                buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+            }
+            
+            STORM_LOG_INFO("Storing the " << stateStorage.getNumberOfStates() << " states used " << stateStorage.getSizeInMemory() << " bytes (" << (stateStorage.getNumberOfStates() > 0 ? static_cast<double>(stateStorage.getSizeInMemory()) / stateStorage.getNumberOfStates() : 0.0) << " bytes per state" << (stateStorage.isTreeCompressed() ? ", tree-compressed" : "") << ").");
             
             // Initialize the model components with the obtained information.
             storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
             
+            if (options.compactMatrixLayout) {
+                storm::storage::SparseMatrix<ValueType>& matrix = modelComponents.transitionMatrix;
+                if (storm::storage::SparseMatrix<ValueType>::isCompactLayoutSupported()) {
+                    uint64_t standardSize = (matrix.getRowCount() + 1) * sizeof(typename storm::storage::SparseMatrix<ValueType>::index_type) + matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>);
+                    uint64_t compactSize = storm::storage::CompactSparseMatrix<ValueType>::getSizeInMemory(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount());
+                    STORM_LOG_INFO("Requesting the compact layout for the transition matrix and the matrices derived from it, which would use " << compactSize << " instead of " << standardSize << " bytes for the transition matrix (" << (storm::storage::CompactSparseMatrix<ValueType>::fitsNarrowColumnIndices(matrix.getColumnCount()) ? "32" : "64") << "-bit column indices).");
+                    matrix.requestCompactLayout(options.compactMatrixSimdLevel);
+                    storm::storage::kernels::SimdLevel simdLevel = std::min(options.compactMatrixSimdLevel, storm::storage::kernels::getSupportedSimdLevel());
+                    STORM_LOG_INFO_COND(simdLevel == storm::storage::kernels::SimdLevel::None, "Using " << simdLevel << " kernels for the compact layout. Their results may differ from the ones of the scalar kernels in the last bits (use '--simd none' to enforce the scalar kernels).");
+                } else {
+                    STORM_LOG_WARN("The compact matrix layout is only available for floating point models. Using the standard layout.");
+                }
+            }
+            
             // Now finalize all reward models.
             for (auto& rewardModelBuilder : rewardModelBuilders) {
                 modelComponents.rewardModels.emplace(rewardModelBuilder.getName(), rewardModelBuilder.build(modelComponents.transitionMatrix.getRowCount(), modelComponents.transitionMatrix.getColumnCount(), modelComponents.transitionMatrix.getRowGroupCount()));
@@ -321,9 +599,9 @@ namespace storm {
             // If requested, build the state valuations and choice origins
             if (generator->getOptions().isBuildStateValuationsSet()) {
                 std::vector<storm::expressions::SimpleValuation> valuations(modelComponents.transitionMatrix.getRowGroupCount());
-                for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
-                    valuations[bitVectorIndexPair.second] = generator->toValuation(bitVectorIndexPair.first);
-                }
+                stateStorage.forEachState([&] (storm::storage::BitVector const& state, StateType stateIndex) {
+                    valuations[stateIndex] = generator->toValuation(state);
+                });
                 modelComponents.stateValuations = storm::storage::sparse::StateValuations(std::move(valuations));
             }
             if (generator->getOptions().isBuildChoiceOriginsSet()) {
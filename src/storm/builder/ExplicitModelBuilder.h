@@ -35,6 +35,7 @@
 namespace storm {
     namespace utility {
         template<typename ValueType> class ConstantsComparator;
+        class ThreadPool;
     }
     
     namespace builder {
@@ -58,6 +59,20 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // A flag indicating whether the compact layout is to be requested for the built transition matrix.
+                bool compactMatrixLayout;
+                
+                // The vector instruction set extension the kernels of the compact layout may use.
+                storm::storage::kernels::SimdLevel compactMatrixSimdLevel;
+                
+                // The number of threads that explore the state space. If it is larger than one, the state space is
+                // explored in parallel (if possible).
+                uint64_t explorationThreads;
+                
+                // A flag indicating whether the explored states are stored in a tree-compressed map, which splits
+                // them into the variables of the individual modules and stores every distinct part only once.
+                bool treeCompressedStateStorage;
             };
             
             /*!
@@ -112,6 +127,39 @@ namespace storm {
              */
             void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
             
+            /*!
+             * Builds the transition matrix and the transition reward matrix by exploring the state space with several
+             * threads. The states are explored level by level (in breadth-first order). Afterwards, the states of each
+             * level are renumbered in the order in which the sequential exploration would have found them, so the
+             * result is the same as the one of buildMatrices.
+             *
+             * @param pool The pool of threads to use.
+             * @param transitionMatrixBuilder The builder of the transition matrix.
+             * @param rewardModelBuilders The builders for the selected reward models.
+             * @param choiceInformationBuilder The builder for the requested information of the choices
+             * @param markovianChoices is set to a bit vector storing whether a choice is markovian (is only set if the model type requires this information).
+             */
+            void buildMatricesParallel(storm::utility::ThreadPool& pool, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
+            
+            /*!
+             * Retrieves whether the state space can be explored in parallel (see buildMatricesParallel).
+             */
+            bool canExploreInParallel() const;
+            
+            /*!
+             * Adds the behavior of the given state to the matrices and the other components of the model.
+             *
+             * @param currentState The state whose behavior to add.
+             * @param currentIndex The index of the state.
+             * @param behavior The behavior of the state.
+             * @param columnRemapping If given, the target states of the behavior whose index is at least the given offset
+             * are replaced by their entries in this vector (shifted by the offset).
+             * @param remappingOffset The first index that is remapped.
+             * @param currentRow The first row of the state. This is increased by the number of added rows.
+             * @param currentRowGroup The row group of the state. This is increased by one.
+             */
+            void addStateBehavior(CompressedState const& currentState, StateType currentIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::vector<StateType> const* columnRemapping, StateType remappingOffset, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup);
+            
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
              *
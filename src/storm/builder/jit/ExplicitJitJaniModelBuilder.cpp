@@ -3,6 +3,9 @@
 #include <iostream>
 #include <cstdio>
 #include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
 #include <errno.h>
 
 #include "storm/solver/SmtSolver.h"
@@ -37,6 +40,7 @@
 
 
 #include "storm/utility/OsDetection.h"
+#include "storm/utility/storm-version.h"
 #include "storm-config.h"
 
 namespace storm {
@@ -44,6 +48,7 @@ namespace storm {
         namespace jit {
             
             static const std::string JIT_VARIABLE_EXTENSION = "_jit_";
+            static const std::string JIT_CONSTANT_EXTENSION = "_jit_constant_";
             
 #ifdef LINUX
             static const std::string DYLIB_EXTENSION = ".so";
@@ -56,7 +61,7 @@ namespace storm {
 #endif
             
             template <typename ValueType, typename RewardModelType>
-            ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::ExplicitJitJaniModelBuilder(storm::jani::Model const& model, storm::builder::BuilderOptions const& options) : options(options), model(model.substituteConstants()), modelComponentsBuilder(model.getModelType()) {
+            ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::ExplicitJitJaniModelBuilder(storm::jani::Model const& model, storm::builder::BuilderOptions const& options) : options(options), model(model), modelComponentsBuilder(model.getModelType()) {
                 
                 // Load all options from the settings module.
                 storm::settings::modules::JitBuilderSettings const& settings = storm::settings::getModule<storm::settings::modules::JitBuilderSettings>();
@@ -101,6 +106,23 @@ namespace storm {
                     carlIncludeDirectory = STORM_CARL_INCLUDE_DIR;
                 }
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isCacheSet()) {
+                    if (settings.isCacheDirectorySet()) {
+                        cacheDirectory = boost::filesystem::path(settings.getCacheDirectory());
+                    } else {
+                        cacheDirectory = boost::filesystem::temp_directory_path() / "storm-jit-cache";
+                    }
+                }
+                
+                // Substitute the constants of the model. If the builder is cached, we keep the constants that do not
+                // influence the structure of the builder, so the cached builder can be reused for other values of them.
+                if (cacheDirectory && std::is_same<double, ValueType>::value) {
+                    runtimeConstants = this->model.getNonStructuralConstants();
+                }
+                this->model = this->model.substituteConstants(runtimeConstants);
+                for (auto const& constant : runtimeConstants) {
+                    variableToName[constant] = constant.getName() + JIT_CONSTANT_EXTENSION;
+                }
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -477,15 +499,21 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
-                
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                boost::filesystem::path dynamicLibraryPath;
+                if (cacheDirectory) {
+                    // (2-4) Retrieve the shared library from the cache or compile it into the cache.
+                    dynamicLibraryPath = retrieveCachedSharedLibrary(source);
+                } else {
+                    // (2) Write the source code to a temporary file.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    
+                    // (3) Compile the source code to a shared library.
+                    dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (4) Remove the source code of the shared library we just compiled.
+                    boost::filesystem::remove(temporarySourceFile);
+                }
                 
                 // (5) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
@@ -506,8 +534,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (7) Delete the shared library unless it is cached.
+                if (!cacheDirectory) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -563,6 +593,7 @@ namespace storm {
                 if (std::is_same<storm::RationalFunction, ValueType>::value) {
                     generateParameters(modelData);
                 }
+                generateConstants(modelData);
                 
                 // Generate non-trivial model-information.
                 generateVariables(modelData);
@@ -1610,6 +1641,28 @@ namespace storm {
                 }
                 modelData["parameters"] = cpptempl::make_data(parameters);
             }
+            
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::generateConstants(cpptempl::data_map& modelData) {
+                cpptempl::data_list integerConstants;
+                cpptempl::data_list realConstants;
+                for (auto const& constant : model.getConstants()) {
+                    if (runtimeConstants.find(constant.getExpressionVariable()) != runtimeConstants.end()) {
+                        cpptempl::data_map constantData;
+                        constantData["name"] = getVariableName(constant.getExpressionVariable());
+                        if (constant.isRealConstant()) {
+                            realConstants.push_back(constantData);
+                        } else {
+                            constantData["type"] = constant.isBooleanConstant() ? "bool" : "int64_t";
+                            integerConstants.push_back(constantData);
+                        }
+                    }
+                }
+                cpptempl::data_map constants;
+                constants["integer"] = cpptempl::make_data(integerConstants);
+                constants["real"] = cpptempl::make_data(realConstants);
+                modelData["constants"] = constants;
+            }
 
             template <typename ValueType, typename RewardModelType>
             std::string const& ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getVariableName(storm::expressions::Variable const& variable) const {
@@ -1705,6 +1758,19 @@ namespace storm {
                             typedef storm::RationalFunction ValueType;
                             {% endif %}
                             
+                            // Constants whose values are set when loading the builder.
+                            {% for constant in constants.integer %}static {$constant.type} {$constant.name};
+                            {% endfor %}
+                            {% for constant in constants.real %}static double {$constant.name};
+                            {% endfor %}
+                            
+                            void initialize_constants(std::vector<int64_t> const& integerConstants, std::vector<double> const& realConstants) {
+                                {% for constant in constants.integer %}{$constant.name} = static_cast<{$constant.type}>(integerConstants[{$loop.index} - 1]);
+                                {% endfor %}
+                                {% for constant in constants.real %}{$constant.name} = realConstants[{$loop.index} - 1];
+                                {% endfor %}
+                            }
+                            
                             struct StateType {
                                 // Boolean variables.
                                 {% for variable in nontransient_variables.boolean %}bool {$variable.name} : 1;
@@ -2447,6 +2513,7 @@ namespace storm {
                             };
                             
                             BOOST_DLL_ALIAS(storm::builder::jit::JitBuilder::create, create_builder)
+                            BOOST_DLL_ALIAS(storm::builder::jit::initialize_constants, initialize_constants)
                             {% if parametric %}
                             BOOST_DLL_ALIAS(storm::builder::jit::initialize_parameters, initialize_parameters)
                             {% endif %}
@@ -2476,6 +2543,48 @@ namespace storm {
                 return dynamicLibraryPath;
             }
             
+            template <typename ValueType, typename RewardModelType>
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::retrieveCachedSharedLibrary(std::string const& source) {
+                // Since the library depends on everything that goes into the compiler invocation, we put all of it into
+                // the cached source file. The file name is then determined by the hash of its content.
+                std::stringstream contentStream;
+                contentStream << "// " << storm::utility::StormVersion::longVersionString() << std::endl;
+                contentStream << "// " << compiler << " " << compilerFlags << " -I" << stormIncludeDirectory << " -I" << sparseppIncludeDirectory << " -I" << boostIncludeDirectory << " -I" << carlIncludeDirectory << std::endl;
+                contentStream << source;
+                std::string content = contentStream.str();
+                
+                std::stringstream keyStream;
+                keyStream << std::hex << std::setfill('0') << std::setw(16) << std::hash<std::string>()(content);
+                boost::filesystem::path cachedSourceFile = cacheDirectory.get() / (keyStream.str() + ".cpp");
+                boost::filesystem::path cachedLibraryFile = cacheDirectory.get() / (keyStream.str() + DYLIB_EXTENSION);
+                
+                // If there is a cached library, we compare the full content to rule out hash collisions.
+                if (boost::filesystem::exists(cachedLibraryFile) && boost::filesystem::exists(cachedSourceFile)) {
+                    std::ifstream in(cachedSourceFile.native());
+                    std::string cachedContent((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                    if (cachedContent == content) {
+                        STORM_LOG_INFO("Using cached builder " << cachedLibraryFile << ".");
+                        return cachedLibraryFile;
+                    }
+                }
+                
+                // Otherwise, we compile the source code under a unique name and only then move the library to its place
+                // in the cache. This way, concurrent runs never load a library that is only partially written.
+                boost::filesystem::create_directories(cacheDirectory.get());
+                boost::filesystem::path temporarySourceFile = cacheDirectory.get() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.cpp");
+                std::ofstream out(temporarySourceFile.native());
+                out << content;
+                out.close();
+                
+                boost::filesystem::path temporaryLibraryFile = compileToSharedLibrary(temporarySourceFile);
+                STORM_LOG_TRACE("Successfully compiled shared library.");
+                boost::filesystem::rename(temporaryLibraryFile, cachedLibraryFile);
+                boost::filesystem::rename(temporarySourceFile, cachedSourceFile);
+                STORM_LOG_INFO("Stored builder in cache as " << cachedLibraryFile << ".");
+                
+                return cachedLibraryFile;
+            }
+            
             template<typename RationalFunctionType, typename TP = typename RationalFunctionType::PolyType, carl::EnableIf<carl::needs_cache<TP>> = carl::dummy>
             RationalFunctionType convertVariableToPolynomial(carl::Variable const& variable, std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache) {
                 return RationalFunctionType(typename RationalFunctionType::PolyType(typename RationalFunctionType::PolyType::PolyType(variable), cache));
@@ -2505,6 +2614,31 @@ namespace storm {
             template <typename ValueType, typename RewardModelType>
             void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::createBuilder(boost::filesystem::path const& dynamicLibraryPath) {
                 jitBuilderCreateFunction = boost::dll::import_alias<typename ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::CreateFunctionType>(dynamicLibraryPath, "create_builder");
+                
+                // Set the values of the constants that were not compiled into the builder. This needs to happen after
+                // loading the create function (which keeps the library loaded) and before creating the builder.
+                if (!runtimeConstants.empty()) {
+                    typedef void (InitializeConstantsFunctionType)(std::vector<int64_t> const&, std::vector<double> const&);
+                    typedef boost::function<InitializeConstantsFunctionType> ImportInitializeConstantsFunctionType;
+                    
+                    std::vector<int64_t> integerConstants;
+                    std::vector<double> realConstants;
+                    for (auto const& constant : model.getConstants()) {
+                        if (runtimeConstants.find(constant.getExpressionVariable()) != runtimeConstants.end()) {
+                            if (constant.isRealConstant()) {
+                                realConstants.push_back(constant.getExpression().evaluateAsDouble());
+                            } else if (constant.isBooleanConstant()) {
+                                integerConstants.push_back(constant.getExpression().evaluateAsBool() ? 1 : 0);
+                            } else {
+                                integerConstants.push_back(constant.getExpression().evaluateAsInt());
+                            }
+                        }
+                    }
+                    
+                    ImportInitializeConstantsFunctionType initializeConstantsFunction = boost::dll::import_alias<InitializeConstantsFunctionType>(dynamicLibraryPath, "initialize_constants");
+                    initializeConstantsFunction(integerConstants, realConstants);
+                }
+                
                 builder = std::unique_ptr<JitModelBuilderInterface<IndexType, ValueType>>(jitBuilderCreateFunction(modelComponentsBuilder));
                 
                 if (std::is_same<storm::RationalFunction, ValueType>::value) {
@@ -104,6 +104,7 @@ namespace storm {
                 void generateLabels(cpptempl::data_map& modelData);
                 void generateTerminalExpressions(cpptempl::data_map& modelData);
                 void generateParameters(cpptempl::data_map& modelData);
+                void generateConstants(cpptempl::data_map& modelData);
                 
                 // Functions related to the generation of edge data.
                 void generateEdges(cpptempl::data_map& modelData);
@@ -140,6 +141,12 @@ namespace storm {
                  * binary file.
                  */
                 boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile);
+                
+                /*!
+                 * Retrieves the shared library for the provided source code from the cache. If it is not cached yet,
+                 * the source code is compiled and the resulting library is put into the cache.
+                 */
+                boost::filesystem::path retrieveCachedSharedLibrary(std::string const& source);
 
                 /*!
                  * Loads the given shared library and creates the builder from it.
@@ -195,6 +202,12 @@ namespace storm {
                 /// The include directory of sparsepp.
                 std::string sparseppIncludeDirectory;
                 
+                /// The directory in which compiled builders are cached (if caching is enabled).
+                boost::optional<boost::filesystem::path> cacheDirectory;
+                
+                /// The constants whose values are not compiled into the builder, but passed when loading it.
+                std::set<storm::expressions::Variable> runtimeConstants;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache;
             };
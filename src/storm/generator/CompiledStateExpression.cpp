@@ -0,0 +1,107 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            // The relative precision up to which two values are considered equal. This is the precision that ExprTk
+            // uses, so compiled expressions yield the same results as the ones evaluated by ExprTk.
+            double const EQUALITY_PRECISION = 1e-10;
+
+            inline bool isEqual(double first, double second) {
+                return std::abs(first - second) <= std::max(1.0, std::max(std::abs(first), std::abs(second))) * EQUALITY_PRECISION;
+            }
+        }
+
+        CompiledStateExpression::Instruction::Instruction(OpCode opCode, uint32_t target, uint32_t first, uint32_t second) : opCode(opCode), target(target), first(first), second(second), bitOffset(0), bitWidth(0), value(0) {
+            // Intentionally left empty.
+        }
+
+        CompiledStateExpression::CompiledStateExpression() : registers(1) {
+            // Intentionally left empty.
+        }
+
+        double CompiledStateExpression::apply(OpCode opCode, double first, double second) {
+            switch (opCode) {
+                case OpCode::Not: return first == 0 ? 1 : 0;
+                case OpCode::Negate: return -first;
+                case OpCode::Floor: return std::floor(first);
+                case OpCode::Ceil: return std::ceil(first);
+                case OpCode::Plus: return first + second;
+                case OpCode::Minus: return first - second;
+                case OpCode::Times: return first * second;
+                case OpCode::Divide: return first / second;
+                case OpCode::Min: return std::min(first, second);
+                case OpCode::Max: return std::max(first, second);
+                case OpCode::Power: return std::pow(first, second);
+                case OpCode::Equal: return isEqual(first, second) ? 1 : 0;
+                case OpCode::NotEqual: return isEqual(first, second) ? 0 : 1;
+                case OpCode::Less: return first < second ? 1 : 0;
+                case OpCode::LessOrEqual: return first <= second ? 1 : 0;
+                case OpCode::Greater: return first > second ? 1 : 0;
+                case OpCode::GreaterOrEqual: return first >= second ? 1 : 0;
+                case OpCode::Xor: return (first == 0) != (second == 0) ? 1 : 0;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Illegal operation in compiled expression.");
+            }
+        }
+
+        double CompiledStateExpression::evaluate(CompressedState const& state) const {
+            double* r = registers.data();
+            uint64_t const numberOfInstructions = instructions.size();
+            for (uint64_t pc = 0; pc < numberOfInstructions; ++pc) {
+                Instruction const& instruction = instructions[pc];
+                switch (instruction.opCode) {
+                    case OpCode::LoadConstant:
+                        r[instruction.target] = instruction.value;
+                        break;
+                    case OpCode::LoadBoolean:
+                        r[instruction.target] = state.get(instruction.bitOffset) ? 1 : 0;
+                        break;
+                    case OpCode::LoadInteger:
+                        r[instruction.target] = instruction.bitWidth == 0 ? instruction.value : static_cast<double>(state.getAsInt(instruction.bitOffset, instruction.bitWidth)) + instruction.value;
+                        break;
+                    case OpCode::JumpIfZero:
+                        if (r[instruction.target] == 0) {
+                            pc = instruction.first - 1;
+                        }
+                        break;
+                    case OpCode::JumpIfNonZero:
+                        if (r[instruction.target] != 0) {
+                            pc = instruction.first - 1;
+                        }
+                        break;
+                    case OpCode::Jump:
+                        pc = instruction.first - 1;
+                        break;
+                    default:
+                        r[instruction.target] = apply(instruction.opCode, r[instruction.first], r[instruction.second]);
+                }
+            }
+            return r[0];
+        }
+
+        bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+            return evaluate(state) == 1;
+        }
+
+        int_fast64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+            return static_cast<int_fast64_t>(evaluate(state));
+        }
+
+        bool CompiledStateExpression::isConstant() const {
+            return instructions.size() == 1 && instructions.front().opCode == OpCode::LoadConstant;
+        }
+
+        uint64_t CompiledStateExpression::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+    namespace generator {
+
+        class StateExpressionCompiler;
+
+        /*!
+         * An expression that was compiled to a flat, register-based program by the state expression compiler. The
+         * program reads the values of the variables directly from the compressed state, so evaluating it neither
+         * requires unpacking the state into an evaluator nor walking the expression tree.
+         *
+         * All values are represented as doubles, which matches the semantics of the ExprTk-based evaluator. Since the
+         * program keeps its registers as scratch space, an object of this class must not be evaluated by several
+         * threads at the same time.
+         */
+        class CompiledStateExpression {
+        public:
+            friend class StateExpressionCompiler;
+
+            CompiledStateExpression();
+
+            /*!
+             * Evaluates the expression in the given state.
+             */
+            double evaluate(CompressedState const& state) const;
+
+            /*!
+             * Evaluates the expression in the given state and interprets the result as a boolean.
+             */
+            bool evaluateAsBool(CompressedState const& state) const;
+
+            /*!
+             * Evaluates the expression in the given state and interprets the result as an integer.
+             */
+            int_fast64_t evaluateAsInt(CompressedState const& state) const;
+
+            /*!
+             * Retrieves whether the expression does not depend on the state, i.e. whether it was folded to a constant.
+             */
+            bool isConstant() const;
+
+            /*!
+             * Retrieves the number of instructions of the program.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+        private:
+            enum class OpCode : uint8_t {
+                LoadConstant, LoadBoolean, LoadInteger, Not, Negate, Floor, Ceil, Plus, Minus, Times, Divide, Min, Max, Power,
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual, Xor, JumpIfZero, JumpIfNonZero, Jump
+            };
+
+            struct Instruction {
+                Instruction(OpCode opCode, uint32_t target, uint32_t first = 0, uint32_t second = 0);
+
+                // The operation to perform.
+                OpCode opCode;
+
+                // The register that receives the result. For jumps, this is the register holding the condition.
+                uint32_t target;
+
+                // The registers holding the operands. For jumps, the first operand is the index of the instruction to
+                // jump to.
+                uint32_t first;
+                uint32_t second;
+
+                // The bit offset and width of a variable that is to be loaded from the state.
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+
+                // The loaded constant or the offset that is to be added to a loaded integer variable.
+                double value;
+            };
+
+            /*!
+             * Applies the given (non-jump) operation to the given operands.
+             */
+            static double apply(OpCode opCode, double first, double second);
+
+            // The instructions of the program.
+            std::vector<Instruction> instructions;
+
+            // The registers that are used during the evaluation. The result is always stored in the first register.
+            mutable std::vector<double> registers;
+        };
+
+    }
+}
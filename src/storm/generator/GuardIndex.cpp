@@ -0,0 +1,178 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/BaseExpression.h"
+#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            // The maximal bit width of a variable by which items are indexed. This bounds the size of the index.
+            uint64_t const MAXIMAL_BIT_WIDTH = 16;
+            
+            // The index may hold this many entries (including one per indexed value) per item, but at least the
+            // minimal number below. Otherwise, the items are scanned linearly.
+            uint64_t const MAXIMAL_INDEX_ENTRIES_PER_ITEM = 16;
+            uint64_t const MINIMAL_INDEX_ENTRY_BUDGET = 4096;
+
+            // A structure storing where the value of a variable is stored in the compressed state.
+            struct VariablePosition {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int_fast64_t lowerBound;
+            };
+
+            storm::expressions::Variable const& getVariable(storm::expressions::Expression const& expression) {
+                return expression.getBaseExpression().asVariableExpression().getVariable();
+            }
+
+            /*!
+             * Gathers the values to which the conjuncts of the given expression fix variables.
+             */
+            void gatherFixedValues(storm::expressions::Expression const& expression, std::map<storm::expressions::Variable, int_fast64_t>& fixedValues) {
+                if (expression.isVariable()) {
+                    if (expression.hasBooleanType()) {
+                        fixedValues.emplace(getVariable(expression), 1);
+                    }
+                } else if (expression.isFunctionApplication()) {
+                    storm::expressions::OperatorType operatorType = expression.getOperator();
+                    if (operatorType == storm::expressions::OperatorType::And) {
+                        gatherFixedValues(expression.getOperand(0), fixedValues);
+                        gatherFixedValues(expression.getOperand(1), fixedValues);
+                    } else if (operatorType == storm::expressions::OperatorType::Not) {
+                        storm::expressions::Expression operand = expression.getOperand(0);
+                        if (operand.isVariable()) {
+                            fixedValues.emplace(getVariable(operand), 0);
+                        }
+                    } else if (operatorType == storm::expressions::OperatorType::Equal) {
+                        storm::expressions::Expression first = expression.getOperand(0);
+                        storm::expressions::Expression second = expression.getOperand(1);
+                        if (first.isLiteral() && second.isVariable()) {
+                            std::swap(first, second);
+                        }
+                        if (first.isVariable() && second.isLiteral()) {
+                            if (first.hasBooleanType()) {
+                                fixedValues.emplace(getVariable(first), second.evaluateAsBool() ? 1 : 0);
+                            } else if (first.hasIntegerType() && second.hasIntegerType()) {
+                                fixedValues.emplace(getVariable(first), second.evaluateAsInt());
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        GuardIndex::GuardIndex() : bitOffset(0), bitWidth(0), candidatesByValue(1) {
+            // Intentionally left empty.
+        }
+
+        GuardIndex::GuardIndex(std::vector<uint64_t> const& items, std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation) : bitOffset(0), bitWidth(0) {
+            STORM_LOG_ASSERT(items.size() == guards.size(), "Mismatching number of items and guards.");
+
+            std::map<storm::expressions::Variable, VariablePosition> positions;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                positions[booleanVariable.variable] = {booleanVariable.bitOffset, 1, 0};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                if (integerVariable.bitWidth <= MAXIMAL_BIT_WIDTH) {
+                    positions[integerVariable.variable] = {integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+                }
+            }
+
+            // Determine the state variable that is fixed by the most guards.
+            std::vector<std::map<storm::expressions::Variable, int_fast64_t>> fixedValues(guards.size());
+            std::map<storm::expressions::Variable, uint64_t> numberOfFixingGuards;
+            for (uint64_t i = 0; i < guards.size(); ++i) {
+                gatherFixedValues(guards[i], fixedValues[i]);
+                for (auto const& variableValuePair : fixedValues[i]) {
+                    if (positions.find(variableValuePair.first) != positions.end()) {
+                        ++numberOfFixingGuards[variableValuePair.first];
+                    }
+                }
+            }
+
+            auto bestIt = numberOfFixingGuards.end();
+            for (auto it = numberOfFixingGuards.begin(); it != numberOfFixingGuards.end(); ++it) {
+                if (bestIt == numberOfFixingGuards.end() || it->second > bestIt->second) {
+                    bestIt = it;
+                }
+            }
+
+            // If no guard fixes a variable (or there is nothing to choose from), all items are always candidates.
+            if (bestIt == numberOfFixingGuards.end() || guards.size() < 2) {
+                candidatesByValue.push_back(items);
+                return;
+            }
+
+            storm::expressions::Variable const& variable = bestIt->first;
+            VariablePosition const& position = positions.at(variable);
+            uint64_t numberOfValues = 1ull << position.bitWidth;
+            
+            // Determine the values to which the guards fix the variable. The guards that do not fix it are candidates
+            // for every value. Guards fixing the variable to a value outside of its range can never be satisfied.
+            std::vector<uint64_t> unfixedItems;
+            std::set<uint64_t> fixedPackedValues;
+            uint64_t numberOfFixingItems = 0;
+            for (uint64_t i = 0; i < guards.size(); ++i) {
+                auto fixedValueIt = fixedValues[i].find(variable);
+                if (fixedValueIt == fixedValues[i].end()) {
+                    unfixedItems.push_back(items[i]);
+                } else {
+                    int_fast64_t packedValue = fixedValueIt->second - position.lowerBound;
+                    if (packedValue >= 0 && static_cast<uint64_t>(packedValue) < numberOfValues) {
+                        fixedPackedValues.insert(static_cast<uint64_t>(packedValue));
+                        ++numberOfFixingItems;
+                    }
+                }
+            }
+            
+            // Only the values up to the largest fixed one get candidates of their own, all larger values share the
+            // unfixed items.
+            uint64_t numberOfIndexedValues = fixedPackedValues.empty() ? 0 : *fixedPackedValues.rbegin() + 1;
+            
+            // If most items remain candidates on average or the index would be too large (e.g. because many guards
+            // do not fix a wide variable and are therefore copied to the candidates of every value), the index does
+            // not pay off and we scan all items.
+            bool selective = !fixedPackedValues.empty() && 2 * (unfixedItems.size() * fixedPackedValues.size() + numberOfFixingItems) <= guards.size() * fixedPackedValues.size();
+            uint64_t indexEntries = numberOfIndexedValues * (unfixedItems.size() + 1) + numberOfFixingItems;
+            uint64_t entryBudget = std::max(MINIMAL_INDEX_ENTRY_BUDGET, MAXIMAL_INDEX_ENTRIES_PER_ITEM * guards.size());
+            if (!selective || indexEntries > entryBudget) {
+                STORM_LOG_TRACE("Not indexing " << guards.size() << " guards by variable '" << variable.getName() << "' (" << unfixedItems.size() << " guards do not fix it, the index would need " << indexEntries << " entries).");
+                candidatesByValue.push_back(items);
+                return;
+            }
+            
+            bitOffset = position.bitOffset;
+            bitWidth = position.bitWidth;
+            candidatesByValue.resize(numberOfIndexedValues + 1);
+            for (uint64_t i = 0; i < guards.size(); ++i) {
+                auto fixedValueIt = fixedValues[i].find(variable);
+                if (fixedValueIt == fixedValues[i].end()) {
+                    for (auto& candidates : candidatesByValue) {
+                        candidates.push_back(items[i]);
+                    }
+                } else {
+                    int_fast64_t packedValue = fixedValueIt->second - position.lowerBound;
+                    if (packedValue >= 0 && static_cast<uint64_t>(packedValue) < numberOfIndexedValues) {
+                        candidatesByValue[packedValue].push_back(items[i]);
+                    }
+                }
+            }
+            
+            STORM_LOG_TRACE("Indexed " << guards.size() << " guards by variable '" << variable.getName() << "', which is fixed by " << bestIt->second << " of them.");
+        }
+
+        bool GuardIndex::isDiscriminating() const {
+            return bitWidth != 0;
+        }
+
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace generator {
+
+        struct VariableInformation;
+
+        /*!
+         * An index over a set of items (e.g. commands or edges) that quickly retrieves the items whose guards can be
+         * satisfied in a given state. For this, the guards are searched for conjuncts that fix a state variable to a
+         * constant value (like a program counter). The index then maps each value of the variable that is fixed by
+         * the most guards to the items whose guards are compatible with this value.
+         *
+         * Note that the guards of the retrieved items still need to be evaluated, as only a single conjunct is
+         * considered for the index. If the index would barely discriminate the items or grow too large (relative to
+         * the number of items), no variable is indexed and all items are candidates in every state.
+         */
+        class GuardIndex {
+        public:
+            /*!
+             * Creates an empty index.
+             */
+            GuardIndex();
+
+            /*!
+             * Creates an index over the given items.
+             *
+             * @param items The items to index.
+             * @param guards The guards of the items.
+             * @param variableInformation The information about how the variables are packed within the states.
+             */
+            GuardIndex(std::vector<uint64_t> const& items, std::vector<storm::expressions::Expression> const& guards, VariableInformation const& variableInformation);
+
+            /*!
+             * Retrieves the items whose guards may be satisfied in the given state. The items are returned in the
+             * order in which they were given when constructing the index.
+             */
+            std::vector<uint64_t> const& getCandidates(CompressedState const& state) const {
+                if (bitWidth == 0) {
+                    return candidatesByValue.front();
+                }
+                uint64_t value = state.getAsInt(bitOffset, bitWidth);
+                return value + 1 < candidatesByValue.size() ? candidatesByValue[value] : candidatesByValue.back();
+            }
+
+            /*!
+             * Retrieves whether the index actually discriminates the items by the value of some variable.
+             */
+            bool isDiscriminating() const;
+
+        private:
+            // The position of the variable by which the items are indexed. If the bit width is zero, the items are not
+            // indexed and all items are candidates in every state.
+            uint64_t bitOffset;
+            uint64_t bitWidth;
+
+            // The candidate items for each (packed) value of the variable up to the largest value that is fixed by a
+            // guard. The last entry holds the candidates of all larger values, i.e. the items not fixing the variable.
+            std::vector<std::vector<uint64_t>> candidatesByValue;
+        };
+
+    }
+}
@@ -50,6 +50,7 @@ namespace storm {
             // Now we are ready to initialize the variable information.
             this->checkValid();
             this->variableInformation = VariableInformation(model, this->parallelAutomata);
+            this->buildGuardIndices();
             
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(model.getManager());
@@ -522,7 +523,8 @@ namespace storm {
 
                     auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
                     if (edgesIt != nonsychingEdges.second.end()) {
-                        for (auto const& edge : edgesIt->second) {
+                        for (uint64_t edgeIndex : edgesIt->second.index.getCandidates(state)) {
+                            storm::jani::Edge const* edge = edgesIt->second.edges[edgeIndex];
                             if (!this->evaluator->asBool(edge->getGuard())) {
                                 continue;
                             }
@@ -546,7 +548,8 @@ namespace storm {
                         bool atLeastOneEdge = false;
                         auto edgesIt = automatonAndEdges.second.find(locations[automatonIndex]);
                         if (edgesIt != automatonAndEdges.second.end()) {
-                            for (auto const& edge : edgesIt->second) {
+                            for (uint64_t edgeIndex : edgesIt->second.index.getCandidates(state)) {
+                                storm::jani::Edge const* edge = edgesIt->second.edges[edgeIndex];
                                 if (!this->evaluator->asBool(edge->getGuard())) {
                                     continue;
                                 }
@@ -715,7 +718,7 @@ namespace storm {
                 
                 LocationsAndEdges locationsAndEdges;
                 for (auto const& edge : automaton.getEdges()) {
-                    locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(&edge);
+                    locationsAndEdges[edge.getSourceLocationIndex()].edges.emplace_back(&edge);
                 }
                 
                 AutomataAndEdges automataAndEdges;
@@ -735,7 +738,7 @@ namespace storm {
                     LocationsAndEdges locationsAndEdges;
                     for (auto const& edge : parallelAutomata.back().get().getEdges()) {
                         if (edge.getActionIndex() == storm::jani::Model::SILENT_ACTION_INDEX) {
-                            locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(&edge);
+                            locationsAndEdges[edge.getSourceLocationIndex()].edges.emplace_back(&edge);
                         }
                     }
 
@@ -759,7 +762,7 @@ namespace storm {
                             uint64_t actionIndex = this->model.getActionIndex(element);
                             for (auto const& edge : parallelAutomata[automatonIndex].get().getEdges()) {
                                 if (edge.getActionIndex() == actionIndex) {
-                                    locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(&edge);
+                                    locationsAndEdges[edge.getSourceLocationIndex()].edges.emplace_back(&edge);
                                 }
                             }
                             if (locationsAndEdges.empty()) {
@@ -780,6 +783,24 @@ namespace storm {
             STORM_LOG_TRACE("Number of synchronizations: " << this->edges.size() << ".");
         }
         
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+            for (auto& outputAndEdges : this->edges) {
+                for (auto& automatonAndEdges : outputAndEdges.second) {
+                    for (auto& locationAndEdges : automatonAndEdges.second) {
+                        IndexedEdgeSet& edgeSet = locationAndEdges.second;
+                        std::vector<uint64_t> edgeIndices;
+                        std::vector<storm::expressions::Expression> guards;
+                        for (uint64_t edgeIndex = 0; edgeIndex < edgeSet.edges.size(); ++edgeIndex) {
+                            edgeIndices.push_back(edgeIndex);
+                            guards.push_back(edgeSet.edges[edgeIndex]->getGuard());
+                        }
+                        edgeSet.index = GuardIndex(edgeIndices, guards, this->variableInformation);
+                    }
+                }
+            }
+        }
+        
         template<typename ValueType, typename StateType>
         void JaniNextStateGenerator<ValueType, StateType>::checkValid() const {
             // If the program still contains undefined constants and we are not in a parametric setting, assemble an appropriate error message.
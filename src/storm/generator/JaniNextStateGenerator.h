@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/OrderedAssignments.h"
@@ -80,7 +81,14 @@ namespace storm {
             Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state, StateToIdCallback stateToIdCallback);
             
             typedef std::vector<storm::jani::Edge const*> EdgeSet;
-            typedef std::unordered_map<uint64_t, EdgeSet> LocationsAndEdges;
+            
+            // The edges leaving a location together with an index over their positions in the edge set.
+            struct IndexedEdgeSet {
+                EdgeSet edges;
+                GuardIndex index;
+            };
+            
+            typedef std::unordered_map<uint64_t, IndexedEdgeSet> LocationsAndEdges;
             typedef std::vector<std::pair<uint64_t, LocationsAndEdges>> AutomataAndEdges;
             typedef std::pair<boost::optional<uint64_t>, AutomataAndEdges> OutputAndEdges;
 
@@ -110,6 +118,11 @@ namespace storm {
              */
             void createSynchronizationInformation();
             
+            /*!
+             * Builds the indices that are used to retrieve the edges of a location that may be enabled in a state.
+             */
+            void buildGuardIndices();
+            
             /*!
              * Checks the underlying model for validity for this next-state generator.
              */
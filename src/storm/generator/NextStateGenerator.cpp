@@ -35,6 +35,11 @@ namespace storm {
             return variableInformation.getTotalBitOffset(true);
         }
         
+        template<typename ValueType, typename StateType>
+        std::vector<uint64_t> NextStateGenerator<ValueType, StateType>::getModuleBitOffsets() const {
+            return std::vector<uint64_t>(variableInformation.moduleBitOffsets.begin(), variableInformation.moduleBitOffsets.end());
+        }
+        
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
             // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
@@ -74,17 +79,16 @@ namespace storm {
                 result.addLabel(label.first);
             }
             
-            storm::storage::BitVectorHashMap<StateType> const& states = stateStorage.stateToId;
-            for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+            stateStorage.forEachState([&] (storm::storage::BitVector const& state, StateType stateIndex) {
+                unpackStateIntoEvaluator(state, variableInformation, *this->evaluator);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
                     if (evaluator->asBool(label.second)) {
-                        result.addLabelToState(label.first, stateIndexPair.second);
+                        result.addLabelToState(label.first, stateIndex);
                     }
                 }
-            }
+            });
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
@@ -155,6 +159,11 @@ namespace storm {
             STORM_LOG_ERROR_COND(!options.isBuildChoiceOriginsSet(), "Generating choice origins is not supported for the considered model format.");
             return nullptr;
         }
+        
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+            return nullptr;
+        }
 
         template class NextStateGenerator<double>;
 
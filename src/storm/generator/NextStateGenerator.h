@@ -47,6 +47,12 @@ namespace storm {
             virtual ~NextStateGenerator() = default;
             
             uint64_t getStateSize() const;
+            
+            /*!
+             * Retrieves the bit offsets at which the variables of the individual modules (or automata) start in the
+             * compressed states.
+             */
+            std::vector<uint64_t> getModuleBitOffsets() const;
             virtual ModelType getModelType() const = 0;
             virtual bool isDeterministicModel() const = 0;
             virtual bool isDiscreteTimeModel() const = 0;
@@ -67,6 +73,14 @@ namespace storm {
             
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
             
+            /*!
+             * Creates a generator that behaves like this one, but does not share any mutable state (like the evaluator)
+             * with it. This way, the two generators can be used by different threads at the same time.
+             *
+             * @return The new generator or null if this generator cannot be cloned.
+             */
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+            
         protected:
             /*!
              * Creates the state labeling for the given states using the provided labels and expressions.
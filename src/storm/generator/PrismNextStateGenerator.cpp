@@ -3,6 +3,8 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
+#include "storm/generator/StateExpressionCompiler.h"
+
 #include "storm/models/sparse/StateLabeling.h"
 
 #include "storm/storage/expressions/SimpleValuation.h"
@@ -36,6 +38,11 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
             
+            if (this->options.isCompileExpressionsSet()) {
+                compileExpressions();
+            }
+            buildGuardIndices();
+            
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -110,6 +117,94 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            uint64_t numberOfCommands = 0;
+            uint64_t numberOfUpdates = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    numberOfCommands = std::max<uint64_t>(numberOfCommands, command.getGlobalIndex() + 1);
+                    for (auto const& update : command.getUpdates()) {
+                        numberOfUpdates = std::max<uint64_t>(numberOfUpdates, update.getGlobalIndex() + 1);
+                    }
+                }
+            }
+            
+            // Guards and assignments are evaluated by the evaluator with doubles for all value types, so compiling them
+            // does not change the results. Likelihoods are only compiled if they are to be computed as doubles anyway.
+            bool compileLikelihoods = std::is_same<ValueType, double>::value;
+            compiledGuards.resize(numberOfCommands);
+            compiledAssignments.resize(numberOfUpdates);
+            if (compileLikelihoods) {
+                compiledLikelihoods.resize(numberOfUpdates);
+            }
+            
+            StateExpressionCompiler compiler(this->variableInformation);
+            uint64_t numberOfInstructions = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    compiledGuards[command.getGlobalIndex()] = compiler.compile(command.getGuardExpression());
+                    numberOfInstructions += compiledGuards[command.getGlobalIndex()].getNumberOfInstructions();
+                    for (auto const& update : command.getUpdates()) {
+                        if (compileLikelihoods) {
+                            compiledLikelihoods[update.getGlobalIndex()] = compiler.compile(update.getLikelihoodExpression());
+                            numberOfInstructions += compiledLikelihoods[update.getGlobalIndex()].getNumberOfInstructions();
+                        }
+                        std::vector<CompiledStateExpression>& assignments = compiledAssignments[update.getGlobalIndex()];
+                        for (auto const& assignment : update.getAssignments()) {
+                            assignments.push_back(compiler.compile(assignment.getExpression()));
+                            numberOfInstructions += assignments.back().getNumberOfInstructions();
+                        }
+                    }
+                }
+            }
+            STORM_LOG_DEBUG("Compiled guards and updates of " << numberOfCommands << " commands to " << numberOfInstructions << " instructions.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+            for (auto const& module : program.getModules()) {
+                std::vector<uint64_t> unlabeledCommands;
+                std::vector<storm::expressions::Expression> unlabeledGuards;
+                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                    storm::prism::Command const& command = module.getCommand(j);
+                    if (!command.isLabeled()) {
+                        unlabeledCommands.push_back(j);
+                        unlabeledGuards.push_back(command.getGuardExpression());
+                    }
+                }
+                unlabeledCommandIndices.emplace_back(unlabeledCommands, unlabeledGuards, this->variableInformation);
+                
+                std::map<uint_fast64_t, GuardIndex> moduleLabeledCommandIndices;
+                for (uint_fast64_t actionIndex : module.getSynchronizingActionIndices()) {
+                    std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+                    std::vector<uint64_t> labeledCommands(commandIndices.begin(), commandIndices.end());
+                    std::vector<storm::expressions::Expression> labeledGuards;
+                    for (uint_fast64_t commandIndex : labeledCommands) {
+                        labeledGuards.push_back(module.getCommand(commandIndex).getGuardExpression());
+                    }
+                    moduleLabeledCommandIndices.emplace(actionIndex, GuardIndex(labeledCommands, labeledGuards, this->variableInformation));
+                }
+                labeledCommandIndices.push_back(std::move(moduleLabeledCommandIndices));
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isEnabled(storm::prism::Command const& command) const {
+            if (!compiledGuards.empty()) {
+                return compiledGuards[command.getGlobalIndex()].evaluateAsBool(*this->state);
+            }
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+        
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::getLikelihood(storm::prism::Update const& update) const {
+            if (!compiledLikelihoods.empty()) {
+                return storm::utility::convertNumber<ValueType>(compiledLikelihoods[update.getGlobalIndex()].evaluate(*this->state));
+            }
+            return this->evaluator->asRational(update.getLikelihoodExpression());
+        }
+        
         template<typename ValueType, typename StateType>
         ModelType PrismNextStateGenerator<ValueType, StateType>::getModelType() const {
             switch (program.getModelType()) {
@@ -300,13 +395,23 @@ namespace storm {
             auto assignmentIt = update.getAssignments().begin();
             auto assignmentIte = update.getAssignments().end();
             
+            // If the expressions were compiled, they are evaluated in the currently loaded state (and not in the given
+            // one, to which the updates of other commands may already have been applied).
+            std::vector<CompiledStateExpression> const* compiledExpressions = compiledAssignments.empty() ? nullptr : &compiledAssignments[update.getGlobalIndex()];
+            auto compiledIt = compiledExpressions ? compiledExpressions->begin() : std::vector<CompiledStateExpression>::const_iterator();
+            
             // Iterate over all boolean assignments and carry them out.
             auto boolIt = this->variableInformation.booleanVariables.begin();
             for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                if (compiledExpressions) {
+                    newState.set(boolIt->bitOffset, compiledIt->evaluateAsBool(*this->state));
+                    ++compiledIt;
+                } else {
+                    newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                }
             }
             
             // Iterate over all integer assignments and carry them out.
@@ -315,7 +420,13 @@ namespace storm {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue;
+                if (compiledExpressions) {
+                    assignedValue = compiledIt->evaluateAsInt(*this->state);
+                    ++compiledIt;
+                } else {
+                    assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                }
                 if (this->options.isExplorationChecksSet()) {
                     STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
                     STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
@@ -353,10 +464,11 @@ namespace storm {
                 
                 std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
                 
-                // Look up commands by their indices and add them if the guard evaluates to true in the given state.
-                for (uint_fast64_t commandIndex : commandIndices) {
+                // Look up the commands that may be enabled in the given state and add them if the guard evaluates to
+                // true.
+                for (uint_fast64_t commandIndex : labeledCommandIndices[i].at(actionIndex).getCandidates(*this->state)) {
                     storm::prism::Command const& command = module.getCommand(commandIndex);
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isEnabled(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -382,15 +494,12 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
                 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                // Iterate over all unlabeled commands that may be enabled in the given state.
+                for (uint_fast64_t j : unlabeledCommandIndices[i].getCandidates(state)) {
                     storm::prism::Command const& command = module.getCommand(j);
                     
-                    // Only consider unlabeled commands.
-                    if (command.isLabeled()) continue;
-                    
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isEnabled(command)) {
                         continue;
                     }
                     
@@ -408,7 +517,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = getLikelihood(update);
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -476,7 +585,7 @@ namespace storm {
                                 storm::prism::Update const& update = command.getUpdate(j);
                                 
                                 for (auto const& stateProbabilityPair : *currentTargetStates) {
-                                    ValueType probability = stateProbabilityPair.second * this->evaluator->asRational(update.getLikelihoodExpression());
+                                    ValueType probability = stateProbabilityPair.second * getLikelihood(update);
 
                                     if (!storm::utility::isZero<ValueType>(probability)) {
                                         // Compute the new state under the current update and add it to the set of new target states.
@@ -639,6 +748,13 @@ namespace storm {
             
             return std::make_shared<storm::storage::sparse::PrismChoiceOrigins>(std::make_shared<storm::prism::Program>(program), std::move(identifiers), std::move(identifierToCommandSetMapping));
         }
+        
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+            // The program was already preprocessed, so we can use it directly. Copying it also copies all expressions,
+            // so the compiled expressions of the new generator are not shared with this one.
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(program, this->options, false));
+        }
 
                 
         template class PrismNextStateGenerator<double>;
@@ -4,6 +4,8 @@
 #include <boost/container/flat_set.hpp>
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 
@@ -32,6 +34,8 @@ namespace storm {
 
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
         private:
             void checkValid() const;
 
@@ -51,6 +55,26 @@ namespace storm {
              */
             CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
             
+            /*!
+             * Compiles the guards and updates of the program, so they can be evaluated directly on the compressed states.
+             */
+            void compileExpressions();
+            
+            /*!
+             * Builds the indices that are used to retrieve the commands of the modules that may be enabled in a state.
+             */
+            void buildGuardIndices();
+            
+            /*!
+             * Retrieves whether the given command is enabled in the state that is currently loaded.
+             */
+            bool isEnabled(storm::prism::Command const& command) const;
+            
+            /*!
+             * Evaluates the likelihood of the given update in the state that is currently loaded.
+             */
+            ValueType getLikelihood(storm::prism::Update const& update) const;
+            
             /*!
              * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
              * modules.
@@ -93,6 +117,24 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // For each module, an index over the (local) indices of its unlabeled commands.
+            std::vector<GuardIndex> unlabeledCommandIndices;
+            
+            // For each module, an index over the (local) indices of its commands with a given action index.
+            std::vector<std::map<uint_fast64_t, GuardIndex>> labeledCommandIndices;
+            
+            // The compiled guards, indexed by the global indices of the commands. This is empty if the expressions are
+            // not compiled.
+            std::vector<CompiledStateExpression> compiledGuards;
+            
+            // The compiled assignment expressions, indexed by the global indices of the updates. The expressions of an
+            // update are stored in the order of its assignments.
+            std::vector<std::vector<CompiledStateExpression>> compiledAssignments;
+            
+            // The compiled likelihoods, indexed by the global indices of the updates. These are only compiled if the
+            // value type is double, as the compiled expressions are evaluated with doubles.
+            std::vector<CompiledStateExpression> compiledLikelihoods;
         };
         
     }
@@ -0,0 +1,213 @@
+#include "storm/generator/StateExpressionCompiler.h"
+
+#include <algorithm>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace generator {
+
+        StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation) : numberOfRegisters(1) {
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                variableLocations[locationVariable.variable] = {false, locationVariable.bitOffset, locationVariable.bitWidth, 0};
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableLocations[booleanVariable.variable] = {true, booleanVariable.bitOffset, 1, 0};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableLocations[integerVariable.variable] = {false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+            }
+        }
+
+        CompiledStateExpression StateExpressionCompiler::compile(storm::expressions::Expression const& expression) {
+            program = CompiledStateExpression();
+            numberOfRegisters = 1;
+
+            translateIntoRegister(expression.getBaseExpression(), 0);
+            program.registers.resize(numberOfRegisters);
+
+            CompiledStateExpression result;
+            std::swap(result, program);
+            return result;
+        }
+
+        StateExpressionCompiler::ConstantOrNone StateExpressionCompiler::translate(storm::expressions::BaseExpression const& expression, uint32_t targetRegister) {
+            return boost::any_cast<ConstantOrNone>(expression.accept(*this, targetRegister));
+        }
+
+        void StateExpressionCompiler::translateIntoRegister(storm::expressions::BaseExpression const& expression, uint32_t targetRegister) {
+            loadIfConstant(translate(expression, targetRegister), targetRegister);
+        }
+
+        void StateExpressionCompiler::loadIfConstant(ConstantOrNone const& constant, uint32_t targetRegister) {
+            if (constant) {
+                Instruction instruction(OpCode::LoadConstant, targetRegister);
+                instruction.value = constant.get();
+                emit(instruction);
+            }
+        }
+
+        StateExpressionCompiler::ConstantOrNone StateExpressionCompiler::translateOperation(OpCode opCode, storm::expressions::BaseExpression const& first, storm::expressions::BaseExpression const* second, uint32_t targetRegister) {
+            // The second operand only uses registers above the one of the first operand, so the order in which constant
+            // operands are loaded does not matter.
+            ConstantOrNone firstResult = translate(first, targetRegister);
+            ConstantOrNone secondResult = second ? translate(*second, targetRegister + 1) : ConstantOrNone(0.0);
+            if (firstResult && secondResult) {
+                return CompiledStateExpression::apply(opCode, firstResult.get(), secondResult.get());
+            }
+
+            loadIfConstant(firstResult, targetRegister);
+            if (second) {
+                loadIfConstant(secondResult, targetRegister + 1);
+            }
+            emit(Instruction(opCode, targetRegister, targetRegister, targetRegister + 1));
+            return boost::none;
+        }
+
+        uint64_t StateExpressionCompiler::emit(Instruction const& instruction) {
+            numberOfRegisters = std::max(numberOfRegisters, instruction.target + 2);
+            program.instructions.push_back(instruction);
+            return program.instructions.size() - 1;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+
+            ConstantOrNone condition = translate(*expression.getCondition(), targetRegister);
+            if (condition) {
+                return translate(condition.get() != 0 ? *expression.getThenExpression() : *expression.getElseExpression(), targetRegister);
+            }
+
+            uint64_t jumpToElse = emit(Instruction(OpCode::JumpIfZero, targetRegister));
+            translateIntoRegister(*expression.getThenExpression(), targetRegister);
+            uint64_t jumpToEnd = emit(Instruction(OpCode::Jump, targetRegister));
+            program.instructions[jumpToElse].first = program.instructions.size();
+            translateIntoRegister(*expression.getElseExpression(), targetRegister);
+            program.instructions[jumpToEnd].first = program.instructions.size();
+            return ConstantOrNone();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+
+            switch (expression.getOperatorType()) {
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies: {
+                    bool isAnd = expression.getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And;
+                    bool isImplies = expression.getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies;
+
+                    // Determine the value of the first operand that decides the result without looking at the second.
+                    // For implications, we negate the first operand and treat it like a disjunction.
+                    ConstantOrNone first = translate(*expression.getFirstOperand(), targetRegister);
+                    if (first) {
+                        bool firstValue = (first.get() != 0) != isImplies;
+                        if (firstValue != isAnd) {
+                            return ConstantOrNone(firstValue ? 1.0 : 0.0);
+                        }
+                        return translate(*expression.getSecondOperand(), targetRegister);
+                    }
+
+                    if (isImplies) {
+                        emit(Instruction(OpCode::Not, targetRegister, targetRegister));
+                    }
+                    uint64_t jumpToEnd = emit(Instruction(isAnd ? OpCode::JumpIfZero : OpCode::JumpIfNonZero, targetRegister));
+                    translateIntoRegister(*expression.getSecondOperand(), targetRegister);
+                    program.instructions[jumpToEnd].first = program.instructions.size();
+                    return ConstantOrNone();
+                }
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+                    return translateOperation(OpCode::Xor, *expression.getFirstOperand(), expression.getSecondOperand().get(), targetRegister);
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+                    return translateOperation(OpCode::Equal, *expression.getFirstOperand(), expression.getSecondOperand().get(), targetRegister);
+            }
+            STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Cannot compile expression " << expression << ".");
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+
+            OpCode opCode;
+            switch (expression.getOperatorType()) {
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: opCode = OpCode::Plus; break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: opCode = OpCode::Minus; break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: opCode = OpCode::Times; break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: opCode = OpCode::Divide; break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: opCode = OpCode::Min; break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: opCode = OpCode::Max; break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: opCode = OpCode::Power; break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Cannot compile expression " << expression << ".");
+            }
+            return translateOperation(opCode, *expression.getFirstOperand(), expression.getSecondOperand().get(), targetRegister);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+
+            OpCode opCode;
+            switch (expression.getRelationType()) {
+                case storm::expressions::BinaryRelationExpression::RelationType::Equal: opCode = OpCode::Equal; break;
+                case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: opCode = OpCode::NotEqual; break;
+                case storm::expressions::BinaryRelationExpression::RelationType::Less: opCode = OpCode::Less; break;
+                case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: opCode = OpCode::LessOrEqual; break;
+                case storm::expressions::BinaryRelationExpression::RelationType::Greater: opCode = OpCode::Greater; break;
+                case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: opCode = OpCode::GreaterOrEqual; break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Cannot compile expression " << expression << ".");
+            }
+            return translateOperation(opCode, *expression.getFirstOperand(), expression.getSecondOperand().get(), targetRegister);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::VariableExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+
+            auto locationIt = variableLocations.find(expression.getVariable());
+            STORM_LOG_THROW(locationIt != variableLocations.end(), storm::exceptions::InvalidArgumentException, "Cannot compile expression referring to variable '" << expression.getVariableName() << "', because it is not a state variable.");
+            VariableLocation const& location = locationIt->second;
+
+            Instruction instruction(location.isBoolean ? OpCode::LoadBoolean : OpCode::LoadInteger, targetRegister);
+            instruction.bitOffset = location.bitOffset;
+            instruction.bitWidth = location.bitWidth;
+            instruction.value = static_cast<double>(location.lowerBound);
+            emit(instruction);
+            return ConstantOrNone();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            return translateOperation(OpCode::Not, *expression.getOperand(), nullptr, targetRegister);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+
+            OpCode opCode;
+            switch (expression.getOperatorType()) {
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: opCode = OpCode::Negate; break;
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: opCode = OpCode::Floor; break;
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: opCode = OpCode::Ceil; break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Cannot compile expression " << expression << ".");
+            }
+            return translateOperation(opCode, *expression.getOperand(), nullptr, targetRegister);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) {
+            return ConstantOrNone(expression.getValue() ? 1.0 : 0.0);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) {
+            return ConstantOrNone(static_cast<double>(expression.getValue()));
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) {
+            return ConstantOrNone(expression.getValueAsDouble());
+        }
+
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace expressions {
+        class BaseExpression;
+    }
+
+    namespace generator {
+
+        struct VariableInformation;
+
+        /*!
+         * Compiles expressions over the variables of a model into programs that can be evaluated directly on the
+         * compressed states of the model. Subexpressions that do not depend on the state are folded to constants and
+         * conjunctions, disjunctions, implications and if-then-else expressions only evaluate the operands that are
+         * needed to determine the result.
+         */
+        class StateExpressionCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            /*!
+             * Creates a compiler for expressions over the variables described by the given variable information.
+             */
+            StateExpressionCompiler(VariableInformation const& variableInformation);
+
+            /*!
+             * Compiles the given expression. All variables appearing in the expression need to be variables of the
+             * compressed state.
+             *
+             * @param expression The expression to compile.
+             * @return The compiled expression.
+             */
+            CompiledStateExpression compile(storm::expressions::Expression const& expression);
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) override;
+
+        private:
+            typedef CompiledStateExpression::OpCode OpCode;
+            typedef CompiledStateExpression::Instruction Instruction;
+            typedef boost::optional<double> ConstantOrNone;
+
+            // A structure storing where the value of a variable is stored in the compressed state.
+            struct VariableLocation {
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int_fast64_t lowerBound;
+            };
+
+            /*!
+             * Translates the given expression such that its value is stored in the given register. Registers with a
+             * higher index may be used as temporary storage. If the expression is a constant, no code is emitted and
+             * the constant is returned instead.
+             */
+            ConstantOrNone translate(storm::expressions::BaseExpression const& expression, uint32_t targetRegister);
+
+            /*!
+             * Translates the given expression such that its value is stored in the given register, even if it is a
+             * constant.
+             */
+            void translateIntoRegister(storm::expressions::BaseExpression const& expression, uint32_t targetRegister);
+
+            /*!
+             * Emits a constant load unless the given value is none.
+             */
+            void loadIfConstant(ConstantOrNone const& constant, uint32_t targetRegister);
+
+            /*!
+             * Translates an operation with up to two operands. If all operands are constants, the operation is folded.
+             */
+            ConstantOrNone translateOperation(OpCode opCode, storm::expressions::BaseExpression const& first, storm::expressions::BaseExpression const* second, uint32_t targetRegister);
+
+            /*!
+             * Emits the given instruction and returns its index.
+             */
+            uint64_t emit(Instruction const& instruction);
+
+            // The locations of all variables of the compressed state.
+            std::unordered_map<storm::expressions::Variable, VariableLocation> variableLocations;
+
+            // The program that is currently being compiled.
+            CompiledStateExpression program;
+
+            // The number of registers the current program needs.
+            uint32_t numberOfRegisters;
+        };
+
+    }
+}
@@ -42,6 +42,7 @@ namespace storm {
                 totalBitOffset += bitwidth;
             }
             for (auto const& module : program.getModules()) {
+                moduleBitOffsets.push_back(totalBitOffset);
                 for (auto const& booleanVariable : module.getBooleanVariables()) {
                     booleanVariables.emplace_back(booleanVariable.getExpressionVariable(), totalBitOffset);
                     ++totalBitOffset;
@@ -91,6 +92,7 @@ namespace storm {
         }
         
         void VariableInformation::createVariablesForAutomaton(storm::jani::Automaton const& automaton) {
+            moduleBitOffsets.push_back(totalBitOffset);
             uint_fast64_t bitwidth = static_cast<uint_fast64_t>(std::ceil(std::log2(automaton.getNumberOfLocations())));
             locationVariables.emplace_back(automaton.getLocationExpressionVariable(), automaton.getNumberOfLocations() - 1, totalBitOffset, bitwidth);
             totalBitOffset += bitwidth;
@@ -92,6 +92,9 @@ namespace storm {
             /// The integer variables.
             std::vector<IntegerVariableInformation> integerVariables;
             
+            /// The bit offsets at which the variables of the individual modules (or automata) start.
+            std::vector<uint_fast64_t> moduleBitOffsets;
+            
         private:
             /*!
              * Sorts the variables to establish a known ordering.
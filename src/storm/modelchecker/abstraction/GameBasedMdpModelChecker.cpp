@@ -233,6 +233,54 @@ namespace storm {
             return result;
         }
         
+        template<storm::dd::DdType Type, typename ValueType>
+        boost::optional<QuantitativeResult<Type, ValueType>> mapQuantitativeResultToGame(storm::abstraction::MenuGame<Type, ValueType> const& game, QuantitativeResult<Type, ValueType> const& previousResult) {
+            // Refining the abstraction only adds predicates, so the state variables of the previous abstraction are a
+            // subset of the current ones and every state of the refined game inherits the value of the abstract state
+            // it was split from. This only works if the previous result does not refer to any variable that is not a
+            // state variable of the current game.
+            std::set<storm::expressions::Variable> const& rowVariables = game.getRowVariables();
+            for (auto const& variable : previousResult.values.getContainedMetaVariables()) {
+                if (rowVariables.find(variable) == rowVariables.end()) {
+                    STORM_LOG_TRACE("Not reusing quantitative result, because the state encoding changed.");
+                    return boost::none;
+                }
+            }
+            
+            QuantitativeResult<Type, ValueType> result;
+            result.initialStatesRange = previousResult.initialStatesRange;
+            result.values = previousResult.values * game.getReachableStates().template toAdd<ValueType>();
+            
+            // Player 1 choices are encoded by the command index, which is stable across refinements. However, a
+            // choice may no longer be enabled in some of the refined states, so we restrict the strategy to the
+            // legal choices of the current game.
+            std::set<storm::expressions::Variable> const& player1Variables = game.getPlayer1Variables();
+            storm::dd::Bdd<Type> legalPlayer1Choices = game.getReachableStates() && !game.getIllegalPlayer1Mask();
+            bool player1StrategyMappable = true;
+            for (auto const& variable : previousResult.player1Strategy.getContainedMetaVariables()) {
+                if (rowVariables.find(variable) == rowVariables.end() && player1Variables.find(variable) == player1Variables.end()) {
+                    player1StrategyMappable = false;
+                    break;
+                }
+            }
+            if (player1StrategyMappable) {
+                result.player1Strategy = previousResult.player1Strategy && legalPlayer1Choices;
+            } else {
+                result.player1Strategy = game.getManager().getBddZero();
+            }
+            
+            // The solver only replaces a choice of the strategy if it strictly improves the value. States whose
+            // previous choice was dropped therefore get an arbitrary legal choice, so that the strategy is defined
+            // for every state that has one.
+            storm::dd::Bdd<Type> statesWithoutChoice = game.getReachableStates() && !result.player1Strategy.existsAbstract(player1Variables);
+            result.player1Strategy |= (statesWithoutChoice && legalPlayer1Choices).existsAbstractRepresentative(player1Variables);
+            
+            // The player 2 choices are enumerated anew for every abstraction, so the previous strategy is meaningless.
+            result.player2Strategy = game.getManager().getBddZero();
+            
+            return result;
+        }
+        
         template<storm::dd::DdType Type, typename ValueType>
         QuantitativeResult<Type, ValueType> solveMaybeStates(storm::OptimizationDirection const& player1Direction, storm::OptimizationDirection const& player2Direction, storm::abstraction::MenuGame<Type, ValueType> const& game, storm::dd::Bdd<Type> const& maybeStates, storm::dd::Bdd<Type> const& prob1States, boost::optional<QuantitativeResult<Type, ValueType>> const& startInfo = boost::none) {
             
@@ -429,7 +477,12 @@ namespace storm {
                     QuantitativeResultMinMax<Type, ValueType> quantitativeResult;
                     
                     // (7) Solve the min values and check whether we can give the answer already.
-                    quantitativeResult.min = computeQuantitativeResult(player1Direction, storm::OptimizationDirection::Minimize, game, qualitativeResult, initialStatesAdd, maybeMin, reuseQuantitativeResults ? previousMinQuantitativeResult : boost::none);
+                    // The lower bounds can only increase over refinements, so the previous ones are a valid starting point.
+                    boost::optional<QuantitativeResult<Type, ValueType>> minStartInfo;
+                    if (reuseQuantitativeResults && previousMinQuantitativeResult) {
+                        minStartInfo = mapQuantitativeResultToGame(game, previousMinQuantitativeResult.get());
+                    }
+                    quantitativeResult.min = computeQuantitativeResult(player1Direction, storm::OptimizationDirection::Minimize, game, qualitativeResult, initialStatesAdd, maybeMin, minStartInfo);
                     previousMinQuantitativeResult = quantitativeResult.min;
                     result = checkForResultAfterQuantitativeCheck<ValueType>(checkTask, storm::OptimizationDirection::Minimize, quantitativeResult.min.initialStatesRange);
                     if (result) {
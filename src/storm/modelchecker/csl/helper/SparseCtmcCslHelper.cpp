@@ -18,6 +18,7 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/numerical.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -27,6 +28,176 @@
 namespace storm {
     namespace modelchecker {
         namespace helper {
+            namespace {
+                // The expected number of jumps above which the time horizon of a transient analysis is split into segments.
+                const double MINIMAL_SEGMENT_LAMBDA = 1000;
+                
+                // A function that performs one step of the uniformized CTMC, i.e. result = P * x.
+                template<typename ValueType>
+                using UniformizedStepFunction = std::function<void (std::vector<ValueType>& x, std::vector<ValueType>& result)>;
+                
+                /*!
+                 * Performs the iterations of one Fox-Glynn window for the given lambda. If the iterates change so little
+                 * that the remaining iterations cannot move the result by more than the given accuracy, these iterations
+                 * are skipped and their weight is attributed to the current vector.
+                 *
+                 * Since the uniformized matrix is stochastic, the difference between consecutive iterates does not grow.
+                 * Hence, if it is delta, the iterate j steps ahead differs by at most j * delta from the current one.
+                 *
+                 * @param remainingLambda The expected number of jumps in the windows that follow this one.
+                 * @return True iff the iterates became stationary before any of them contributed to the result and they
+                 * are not going to change by more than the accuracy within this window and the following ones. In this
+                 * case, the result is the current iterate and the following windows can be skipped.
+                 */
+                template<typename ValueType, bool useMixedPoissonProbabilities>
+                bool performUniformizationWindow(UniformizedStepFunction<ValueType> const& step, ValueType lambda, ValueType uniformizationRate, ValueType accuracy, ValueType remainingLambda, std::vector<ValueType>& values, std::vector<ValueType>& result) {
+                    // Use Fox-Glynn to get the truncation points and the weights.
+                    std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(lambda, 1e+300, accuracy);
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << std::get<0>(foxGlynnResult) << ", right=" << std::get<1>(foxGlynnResult));
+                    uint_fast64_t left = std::get<0>(foxGlynnResult);
+                    uint_fast64_t right = std::get<1>(foxGlynnResult);
+                    std::vector<ValueType>& weights = std::get<3>(foxGlynnResult);
+                    
+                    // Scale the weights so they add up to one.
+                    for (auto& element : weights) {
+                        element /= std::get<2>(foxGlynnResult);
+                    }
+                    
+                    // If the cumulative reward is to be computed, we need to adjust the weights.
+                    if (useMixedPoissonProbabilities) {
+                        ValueType sum = storm::utility::zero<ValueType>();
+                        for (auto& element : weights) {
+                            sum += element;
+                            element = (1 - sum) / uniformizationRate;
+                        }
+                    }
+                    
+                    // Below the left truncation point, the (mixed) poisson probabilities are approximated by zero (one
+                    // over the uniformization rate, respectively).
+                    auto getWeight = [&] (uint_fast64_t iteration) -> ValueType {
+                        if (iteration < left) {
+                            return useMixedPoissonProbabilities ? storm::utility::one<ValueType>() / uniformizationRate : storm::utility::zero<ValueType>();
+                        }
+                        return weights[iteration - left];
+                    };
+                    
+                    result = values;
+                    storm::utility::vector::scaleVectorInPlace(result, getWeight(0));
+                    
+                    // The weight of the iterations that have not contributed to the result yet.
+                    ValueType remainingWeight = storm::utility::zero<ValueType>();
+                    for (uint_fast64_t iteration = 1; iteration <= right; ++iteration) {
+                        remainingWeight += getWeight(iteration);
+                    }
+                    
+                    // The step function only needs to write the entries it changes.
+                    std::vector<ValueType> newValues = values;
+                    for (uint_fast64_t iteration = 1; iteration <= right; ++iteration) {
+                        step(values, newValues);
+                        ValueType maximalDifference = storm::utility::zero<ValueType>();
+                        for (uint_fast64_t state = 0; state < values.size(); ++state) {
+                            maximalDifference = std::max(maximalDifference, storm::utility::abs<ValueType>(newValues[state] - values[state]));
+                        }
+                        std::swap(values, newValues);
+                        
+                        // Replacing the iterates iteration, ..., right by the current one introduces an error of at most
+                        // (right - iteration) * maximalDifference for each unit of the remaining weight.
+                        ValueType windowError = maximalDifference * storm::utility::convertNumber<ValueType>(right - iteration) * remainingWeight;
+                        if (windowError <= accuracy) {
+                            STORM_LOG_DEBUG("Iterates became stationary after " << iteration << " of " << right << " iterations.");
+                            if (!useMixedPoissonProbabilities && iteration <= left && windowError + maximalDifference * remainingLambda <= accuracy) {
+                                result = values;
+                                return true;
+                            }
+                            storm::utility::vector::addScaledVector(result, values, remainingWeight);
+                            return false;
+                        }
+                        
+                        ValueType weight = getWeight(iteration);
+                        if (!storm::utility::isZero(weight)) {
+                            storm::utility::vector::addScaledVector(result, values, weight);
+                            remainingWeight -= weight;
+                        }
+                    }
+                    return false;
+                }
+                
+                /*!
+                 * Computes the transient probabilities (or the mixed poisson sums, respectively) for the given time bound
+                 * where the steps of the uniformized CTMC are performed by the given function.
+                 *
+                 * Long time horizons are split into segments of increasing length that are processed one after another.
+                 * This way, the first segments are short and once the iterates become stationary at the beginning of a
+                 * (long) segment, all remaining time can be skipped.
+                 */
+                template<typename ValueType, bool useMixedPoissonProbabilities>
+                std::vector<ValueType> computeTransientProbabilitiesWithStepFunction(UniformizedStepFunction<ValueType> const& step, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values) {
+                    ValueType lambda = timeBound * uniformizationRate;
+                    
+                    // If no time can pass, the current values are the result.
+                    if (storm::utility::isZero(lambda)) {
+                        return values;
+                    }
+                    
+                    ValueType accuracy = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
+                    
+                    // Determine the segments. Since the mixed poisson probabilities do not compose, they are computed in one window.
+                    std::vector<ValueType> segments;
+                    if (!useMixedPoissonProbabilities && lambda > 2 * MINIMAL_SEGMENT_LAMBDA) {
+                        ValueType segment = MINIMAL_SEGMENT_LAMBDA;
+                        ValueType remaining = lambda;
+                        while (remaining >= 2 * segment) {
+                            segments.push_back(segment);
+                            remaining -= segment;
+                            segment *= 2;
+                        }
+                        segments.push_back(remaining);
+                        
+                        // The error is distributed over the segments, but Fox-Glynn does not support arbitrarily small errors.
+                        if (accuracy / segments.size() < 1e-10) {
+                            segments.clear();
+                        }
+                    }
+                    if (segments.empty()) {
+                        segments.push_back(lambda);
+                    }
+                    STORM_LOG_DEBUG("Splitting the transient analysis for lambda=" << lambda << " into " << segments.size() << " segment(s).");
+                    
+                    std::vector<ValueType> result;
+                    ValueType remainingLambda = lambda;
+                    for (uint64_t segment = 0; segment < segments.size(); ++segment) {
+                        if (segment > 0) {
+                            std::swap(values, result);
+                        }
+                        remainingLambda -= segments[segment];
+                        if (performUniformizationWindow<ValueType, useMixedPoissonProbabilities>(step, segments[segment], uniformizationRate, accuracy / segments.size(), std::max(remainingLambda, storm::utility::zero<ValueType>()), values, result)) {
+                            if (segment + 1 < segments.size()) {
+                                STORM_LOG_INFO("Reached steady state, skipping the transient analysis for the remaining " << (segments.size() - segment - 1) << " segment(s).");
+                            }
+                            break;
+                        }
+                    }
+                    
+                    return result;
+                }
+                
+                /*!
+                 * Performs one step of the uniformized CTMC for the given range of states on the fly, i.e. without
+                 * materializing the uniformized matrix. Only the entries of the maybe states are written.
+                 */
+                template<typename ValueType>
+                void performUniformizedStep(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& exitRates, ValueType uniformizationRate, std::vector<ValueType> const& x, std::vector<ValueType>& result, uint64_t startState, uint64_t endState) {
+                    for (uint64_t state = maybeStates.getNextSetIndex(startState); state < endState; state = maybeStates.getNextSetIndex(state + 1)) {
+                        // The uniformized matrix has the entries R(s, s') / q and an additional self-loop of 1 - E(s) / q.
+                        ValueType rateSum = -exitRates[state] * x[state];
+                        for (auto const& entry : rateMatrix.getRow(state)) {
+                            rateSum += entry.getValue() * x[entry.getColumn()];
+                        }
+                        result[state] = x[state] + rateSum / uniformizationRate;
+                    }
+                }
+            }
+            
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
                 
@@ -68,22 +239,11 @@ namespace storm {
                             uniformizationRate *= 1.02;
                             STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                             
-                            // Compute the uniformized matrix.
-                            storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
-                            
-                            // Compute the vector that is to be added as a compensation for removing the absorbing states.
-                            std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
-                            for (auto& element : b) {
-                                element /= uniformizationRate;
-                            }
-                            
-                            // Finally compute the transient probabilities.
-                            std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
-                            std::vector<ValueType> subresult = computeTransientProbabilities(uniformizedMatrix, &b, upperBound, uniformizationRate, values, linearEquationSolverFactory);
-                            result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
-                            
-                            storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresult);
-                            storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                            // Compute the transient probabilities. The psi states keep their value of one and thereby
+                            // act as absorbing states.
+                            std::vector<ValueType> values(numberOfStates, storm::utility::zero<ValueType>());
+                            storm::utility::vector::setVectorValues(values, psiStates, storm::utility::one<ValueType>());
+                            result = computeTransientProbabilities(rateMatrix, statesWithProbabilityGreater0NonPsi, exitRates, static_cast<ValueType>(upperBound), uniformizationRate, std::move(values));
                         } else if (upperBound == storm::utility::infinity<ValueType>()) {
                             // In this case, the interval is of the form [t, inf] with t != 0.
                             
@@ -93,8 +253,7 @@ namespace storm {
                             
                             // Determine the set of states that must be considered further.
                             storm::storage::BitVector relevantStates = statesWithProbabilityGreater0 & phiStates;
-                            std::vector<ValueType> subResult(relevantStates.getNumberOfSetBits());
-                            storm::utility::vector::selectVectorValues(subResult, relevantStates, result);
+                            storm::utility::vector::setVectorValues(result, ~relevantStates, storm::utility::zero<ValueType>());
                             
                             ValueType uniformizationRate = 0;
                             for (auto const& state : relevantStates) {
@@ -103,15 +262,8 @@ namespace storm {
                             uniformizationRate *= 1.02;
                             STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                             
-                            // Compute the uniformized matrix.
-                            storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
-                            
                             // Compute the transient probabilities.
-                            subResult = computeTransientProbabilities<ValueType>(uniformizedMatrix, nullptr, lowerBound, uniformizationRate, subResult, linearEquationSolverFactory);
-                            
-                            // Fill in the correct values.
-                            storm::utility::vector::setVectorValues(result, ~relevantStates, storm::utility::zero<ValueType>());
-                            storm::utility::vector::setVectorValues(result, relevantStates, subResult);
+                            result = computeTransientProbabilities(rateMatrix, relevantStates, exitRates, static_cast<ValueType>(lowerBound), uniformizationRate, std::move(result));
                         } else {
                             // In this case, the interval is of the form [t, t'] with t != 0 and t' != inf.
                             
@@ -126,23 +278,14 @@ namespace storm {
                                 uniformizationRate *= 1.02;
                                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                 
-                                // Compute the (first) uniformized matrix.
-                                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
-                                
-                                // Compute the vector that is to be added as a compensation for removing the absorbing states.
-                                std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
-                                for (auto& element : b) {
-                                    element /= uniformizationRate;
-                                }
-                                
                                 // Start by computing the transient probabilities of reaching a psi state in time t' - t.
-                                std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
-                                std::vector<ValueType> subresult = computeTransientProbabilities(uniformizedMatrix, &b, upperBound - lowerBound, uniformizationRate, values, linearEquationSolverFactory);
+                                // The psi states keep their value of one and thereby act as absorbing states.
+                                result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                                storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+                                result = computeTransientProbabilities(rateMatrix, statesWithProbabilityGreater0NonPsi, exitRates, static_cast<ValueType>(upperBound - lowerBound), uniformizationRate, std::move(result));
                                 
                                 storm::storage::BitVector relevantStates = statesWithProbabilityGreater0 & phiStates;
-                                std::vector<ValueType> newSubresult = std::vector<ValueType>(relevantStates.getNumberOfSetBits());
-                                storm::utility::vector::setVectorValues(newSubresult, statesWithProbabilityGreater0NonPsi % relevantStates, subresult);
-                                storm::utility::vector::setVectorValues(newSubresult, psiStates % relevantStates, storm::utility::one<ValueType>());
+                                storm::utility::vector::setVectorValues(result, ~relevantStates, storm::utility::zero<ValueType>());
                                 
                                 // Then compute the transient probabilities of being in such a state after t time units. For this,
                                 // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
@@ -154,18 +297,12 @@ namespace storm {
                                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                 
                                 // Finally, we compute the second set of transient probabilities.
-                                uniformizedMatrix = computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
-                                newSubresult = computeTransientProbabilities<ValueType>(uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, linearEquationSolverFactory);
-                                
-                                // Fill in the correct values.
-                                result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
-                                storm::utility::vector::setVectorValues(result, ~relevantStates, storm::utility::zero<ValueType>());
-                                storm::utility::vector::setVectorValues(result, relevantStates, newSubresult);
+                                result = computeTransientProbabilities(rateMatrix, relevantStates, exitRates, static_cast<ValueType>(lowerBound), uniformizationRate, std::move(result));
                             } else {
                                 // In this case, the interval is of the form [t, t] with t != 0, t != inf.
                                 
-                                std::vector<ValueType> newSubresult = std::vector<ValueType>(statesWithProbabilityGreater0.getNumberOfSetBits());
-                                storm::utility::vector::setVectorValues(newSubresult, psiStates % statesWithProbabilityGreater0, storm::utility::one<ValueType>());
+                                result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+                                storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
                                 
                                 // Then compute the transient probabilities of being in such a state after t time units. For this,
                                 // we must re-uniformize the CTMC, so we need to compute the second uniformized matrix.
@@ -177,13 +314,7 @@ namespace storm {
                                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                                 
                                 // Finally, we compute the second set of transient probabilities.
-                                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0, uniformizationRate, exitRates);
-                                newSubresult = computeTransientProbabilities<ValueType>(uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, linearEquationSolverFactory);
-                                
-                                // Fill in the correct values.
-                                result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
-                                storm::utility::vector::setVectorValues(result, ~statesWithProbabilityGreater0, storm::utility::zero<ValueType>());
-                                storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0, newSubresult);
+                                result = computeTransientProbabilities(rateMatrix, statesWithProbabilityGreater0, exitRates, static_cast<ValueType>(lowerBound), uniformizationRate, std::move(result));
                             }
                         }
                     }
@@ -228,8 +359,7 @@ namespace storm {
                     uniformizationRate *= 1.02;
                     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                     
-                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRateVector);
-                    result = computeTransientProbabilities<ValueType>(uniformizedMatrix, nullptr, timeBound, uniformizationRate, result, linearEquationSolverFactory);
+                    result = computeTransientProbabilities(rateMatrix, storm::storage::BitVector(numberOfStates, true), exitRateVector, static_cast<ValueType>(timeBound), uniformizationRate, std::move(result));
                 }
                 
                 return result;
@@ -262,13 +392,11 @@ namespace storm {
                 uniformizationRate *= 1.02;
                 STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
                 
-                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRateVector);
-                
                 // Compute the total state reward vector.
                 std::vector<ValueType> totalRewardVector = rewardModel.getTotalRewardVector(rateMatrix, exitRateVector);
                 
                 // Finally, compute the transient probabilities.
-                return computeTransientProbabilities<ValueType, true>(uniformizedMatrix, nullptr, timeBound, uniformizationRate, totalRewardVector, linearEquationSolverFactory);
+                return computeTransientProbabilities<ValueType, true>(rateMatrix, storm::storage::BitVector(numberOfStates, true), exitRateVector, static_cast<ValueType>(timeBound), uniformizationRate, std::move(totalRewardVector));
             }
             
             template <typename ValueType, typename RewardModelType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
@@ -618,79 +746,40 @@ namespace storm {
 
             template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory) {
-                
-                ValueType lambda = timeBound * uniformizationRate;
-                
-                // If no time can pass, the current values are the result.
-                if (storm::utility::isZero(lambda)) {
-                    return values;
-                }
-                
-                // Use Fox-Glynn to get the truncation points and the weights.
-                std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(lambda, 1e+300, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0);
-                STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << std::get<0>(foxGlynnResult) << ", right=" << std::get<1>(foxGlynnResult));
-                
-                // Scale the weights so they add up to one.
-                for (auto& element : std::get<3>(foxGlynnResult)) {
-                    element /= std::get<2>(foxGlynnResult);
-                }
-                
-                // If the cumulative reward is to be computed, we need to adjust the weights.
-                if (useMixedPoissonProbabilities) {
-                    ValueType sum = storm::utility::zero<ValueType>();
-                    
-                    for (auto& element : std::get<3>(foxGlynnResult)) {
-                        sum += element;
-                        element = (1 - sum) / uniformizationRate;
-                    }
-                }
-                
                 STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
                 
-                // Initialize result.
-                std::vector<ValueType> result;
-                uint_fast64_t startingIteration = std::get<0>(foxGlynnResult);
-                if (startingIteration == 0) {
-                    result = values;
-                    storm::utility::vector::scaleVectorInPlace(result, std::get<3>(foxGlynnResult)[0]);
-                    ++startingIteration;
-                } else {
-                    if (useMixedPoissonProbabilities) {
-                        result = std::vector<ValueType>(values.size());
-                        std::function<ValueType (ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate] (ValueType const& a) -> ValueType { return a / uniformizationRate; };
-                        storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
-                    } else {
-                        result = std::vector<ValueType>(values.size());
-                    }
-                }
-                
-                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(uniformizedMatrix));
+                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(uniformizedMatrix);
                 solver->setCachingEnabled(true);
                 
-                if (!useMixedPoissonProbabilities && std::get<0>(foxGlynnResult) > 1) {
-                    // Perform the matrix-vector multiplications (without adding).
-                    solver->repeatedMultiply(values, addVector, std::get<0>(foxGlynnResult) - 1);
-                } else if (useMixedPoissonProbabilities) {
-                    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
-                    
-                    // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-                    for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-                        solver->repeatedMultiply(values, nullptr, 1);
-                        storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                UniformizedStepFunction<ValueType> step = [&solver, addVector] (std::vector<ValueType>& x, std::vector<ValueType>& result) {
+                    solver->multiply(x, addVector, result);
+                };
+                return computeTransientProbabilitiesWithStepFunction<ValueType, useMixedPoissonProbabilities>(step, timeBound, uniformizationRate, std::move(values));
+            }
+            
+            template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& exitRates, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values) {
+                STORM_LOG_DEBUG("Starting iterations on the fly with uniformization rate " << uniformizationRate << " for " << maybeStates.getNumberOfSetBits() << " states.");
+                
+                // Remember the values of the states that are not considered, so they are not affected by rounding.
+                storm::storage::BitVector fixedStates = ~maybeStates;
+                std::vector<ValueType> fixedValues(fixedStates.getNumberOfSetBits());
+                storm::utility::vector::selectVectorValues(fixedValues, fixedStates, values);
+                
+                uint64_t numberOfStates = rateMatrix.getRowCount();
+                storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+                UniformizedStepFunction<ValueType> step = [&] (std::vector<ValueType>& x, std::vector<ValueType>& result) {
+                    if (storm::utility::ThreadPool::supportsParallelComputations<ValueType>() && pool.getThreadCount() > 1) {
+                        pool.parallelFor(numberOfStates, [&rateMatrix] (uint64_t state) { return static_cast<uint64_t>(rateMatrix.begin(state) - rateMatrix.begin()) + state; }, [&] (uint64_t startState, uint64_t endState) {
+                            performUniformizedStep(rateMatrix, maybeStates, exitRates, uniformizationRate, x, result, startState, endState);
+                        });
+                    } else {
+                        performUniformizedStep(rateMatrix, maybeStates, exitRates, uniformizationRate, x, result, 0, numberOfStates);
                     }
-                }
-                
-                // For the indices that fall in between the truncation points, we need to perform the matrix-vector
-                // multiplication, scale and add the result.
-                ValueType weight = 0;
-                std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
-                for (uint_fast64_t index = startingIteration; index <= std::get<1>(foxGlynnResult); ++index) {
-                    solver->repeatedMultiply(values, addVector, 1);
-                    
-                    weight = std::get<3>(foxGlynnResult)[index - std::get<0>(foxGlynnResult)];
-                    storm::utility::vector::applyPointwise(result, values, result, addAndScale);
-                }
+                };
+                std::vector<ValueType> result = computeTransientProbabilitiesWithStepFunction<ValueType, useMixedPoissonProbabilities>(step, timeBound, uniformizationRate, std::move(values));
                 
+                storm::utility::vector::setVectorValues(result, fixedStates, fixedValues);
                 return result;
             }
             
@@ -744,6 +833,9 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
+            
+            template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, std::vector<double> const& exitRates, double timeBound, double uniformizationRate, std::vector<double> values);
+            template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities<double, true>(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, storm::solver::LinearEquationSolverFactory<double> const& linearEquationSolverFactory);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound, storm::solver::LinearEquationSolverFactory<storm::RationalNumber> const& linearEquationSolverFactory);
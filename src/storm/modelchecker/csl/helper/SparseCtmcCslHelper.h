@@ -83,6 +83,25 @@ namespace storm {
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, storm::solver::LinearEquationSolverFactory<ValueType> const& linearEquationSolverFactory);
                 
+                /*!
+                 * Computes the transient probabilities for lambda time steps, where the uniformization is applied on the
+                 * fly while multiplying with the rate matrix, i.e. the uniformized matrix is never built. Long time
+                 * horizons are split into segments and the iteration stops early once the values become stationary.
+                 *
+                 * @param rateMatrix The rate matrix of the model.
+                 * @param maybeStates The states whose values are updated. All other states keep their initial value and
+                 * thereby act as absorbing states.
+                 * @param exitRates The exit rates of all states.
+                 * @param timeBound The time bound to use.
+                 * @param uniformizationRate The rate to be used for uniformization.
+                 * @param values A vector mapping each state to an initial probability.
+                 * @param useMixedPoissonProbabilities If set to true, instead of taking the poisson probabilities,  mixed
+                 * poisson probabilities are used.
+                 * @return The vector of transient probabilities.
+                 */
+                template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<ValueType> computeTransientProbabilities(storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& exitRates, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values);
+                
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
                  *
@@ -22,6 +22,7 @@
 #include "storm/utility/numerical.h"
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 #include "storm/solver/LpSolver.h"
 
 #include "storm/exceptions/InvalidStateException.h"
@@ -134,6 +135,203 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded reachability probabilities is unsupported for this value type.");
             }
                 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, double timeBound, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                ValueType precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+                
+                // The fraction of the precision that may be lost by truncating the Poisson distribution.
+                ValueType truncationFraction = storm::utility::convertNumber<ValueType>(0.1);
+                
+                // The fraction of the precision that may be lost by solving the equations of the probabilistic states.
+                ValueType solverFraction = storm::utility::convertNumber<ValueType>(0.1);
+                
+                // The number of times the uniformization rate may be doubled before we give up on reaching the precision.
+                uint64_t const maximalNumberOfRefinements = 10;
+                
+                storm::storage::BitVector markovianNonGoalStates = markovianStates & ~psiStates;
+                storm::storage::BitVector probabilisticNonGoalStates = ~markovianStates & ~psiStates;
+                
+                // The transitions of the probabilistic states do not depend on the uniformization rate.
+                typename storm::storage::SparseMatrix<ValueType> aProbabilistic = transitionMatrix.getSubmatrix(true, probabilisticNonGoalStates, probabilisticNonGoalStates);
+                typename storm::storage::SparseMatrix<ValueType> aProbabilisticToMarkovian = transitionMatrix.getSubmatrix(true, probabilisticNonGoalStates, markovianNonGoalStates);
+                std::vector<ValueType> bProbabilisticFixed = transitionMatrix.getConstrainedRowGroupSumVector(probabilisticNonGoalStates, psiStates);
+                std::vector<ValueType> bProbabilistic(aProbabilistic.getRowCount());
+                
+                // The solution is unique as we assume non-zeno MAs.
+                storm::solver::MinMaxLinearEquationSolverRequirements requirements = minMaxLinearEquationSolverFactory.getRequirements(true, dir);
+                requirements.clearBounds();
+                STORM_LOG_THROW(requirements.empty(), storm::exceptions::UncheckedRequirementException, "Cannot establish requirements for solver.");
+                
+                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = minMaxLinearEquationSolverFactory.create(aProbabilistic);
+                solver->setHasUniqueSolution();
+                solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                solver->setRequirementsChecked();
+                solver->setCachingEnabled(true);
+                
+                // If possible, we adapt the precision of the solver to the number of jumps, as every jump requires solving
+                // the equations of the probabilistic states once.
+                storm::solver::IterativeMinMaxLinearEquationSolver<ValueType>* iterativeSolver = dynamic_cast<storm::solver::IterativeMinMaxLinearEquationSolver<ValueType>*>(solver.get());
+                
+                // Computes the values of the probabilistic states, given that reaching a goal state yields goalValue and
+                // reaching a Markovian non-goal state yields the value in markovianValues.
+                auto solveProbabilisticStates = [&] (ValueType const& goalValue, std::vector<ValueType> const& markovianValues, std::vector<ValueType>& probabilisticValues) {
+                    aProbabilisticToMarkovian.multiplyWithVector(markovianValues, bProbabilistic);
+                    storm::utility::vector::addScaledVector(bProbabilistic, bProbabilisticFixed, goalValue);
+                    solver->solveEquations(dir, probabilisticValues, bProbabilistic);
+                };
+                
+                std::vector<ValueType> vProbabilistic(probabilisticNonGoalStates.getNumberOfSetBits());
+                std::vector<ValueType> vMarkovian(markovianNonGoalStates.getNumberOfSetBits());
+                
+                ValueType uniformizationRate = storm::utility::zero<ValueType>();
+                for (auto state : markovianNonGoalStates) {
+                    uniformizationRate = std::max(uniformizationRate, exitRateVector[state]);
+                }
+                
+                if (markovianNonGoalStates.empty() || timeBound == 0.0) {
+                    // Without Markovian jumps, only the probabilistic states can reach a goal state.
+                    solveProbabilisticStates(storm::utility::one<ValueType>(), vMarkovian, vProbabilistic);
+                } else {
+                    std::vector<ValueType> vProbabilisticTmp(vProbabilistic.size());
+                    std::vector<ValueType> vMarkovianTmp(vMarkovian.size());
+                    std::vector<ValueType> wProbabilistic(vProbabilistic.size());
+                    std::vector<ValueType> wMarkovian(vMarkovian.size());
+                    std::vector<ValueType> wMarkovianTmp(vMarkovian.size());
+                    std::vector<ValueType> boundProbabilistic(vProbabilistic.size());
+                    std::vector<ValueType> boundMarkovian(vMarkovian.size());
+                    
+                    // Every solution of the equations of the probabilistic states may be off by the precision of the solver.
+                    ValueType solverPrecision = storm::utility::zero<ValueType>();
+                    if (!probabilisticNonGoalStates.empty()) {
+                        solverPrecision = iterativeSolver ? iterativeSolver->getPrecision() : storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getPrecision());
+                    }
+                    
+                    auto maximalDifference = [] (std::vector<ValueType> const& first, std::vector<ValueType> const& second) {
+                        ValueType result = storm::utility::zero<ValueType>();
+                        for (uint64_t index = 0; index < first.size(); ++index) {
+                            result = std::max(result, storm::utility::abs<ValueType>(first[index] - second[index]));
+                        }
+                        return result;
+                    };
+                    
+                    uint64_t numberOfRefinements = 0;
+                    while (true) {
+                        // Uniformize the Markovian states with the current rate.
+                        typename storm::storage::SparseMatrix<ValueType> aMarkovian = transitionMatrix.getSubmatrix(true, markovianNonGoalStates, markovianNonGoalStates, true);
+                        typename storm::storage::SparseMatrix<ValueType> aMarkovianToProbabilistic = transitionMatrix.getSubmatrix(true, markovianNonGoalStates, probabilisticNonGoalStates);
+                        std::vector<ValueType> bMarkovianFixed;
+                        bMarkovianFixed.reserve(vMarkovian.size());
+                        uint64_t rowIndex = 0;
+                        for (auto state : markovianNonGoalStates) {
+                            ValueType rateFraction = exitRateVector[state] / uniformizationRate;
+                            for (auto& element : aMarkovian.getRow(rowIndex)) {
+                                if (element.getColumn() == rowIndex) {
+                                    element.setValue(rateFraction * element.getValue() + storm::utility::one<ValueType>() - rateFraction);
+                                } else {
+                                    element.setValue(rateFraction * element.getValue());
+                                }
+                            }
+                            for (auto& element : aMarkovianToProbabilistic.getRow(rowIndex)) {
+                                element.setValue(rateFraction * element.getValue());
+                            }
+                            bMarkovianFixed.push_back(storm::utility::zero<ValueType>());
+                            for (auto const& element : transitionMatrix.getRowGroup(state)) {
+                                if (psiStates.get(element.getColumn())) {
+                                    bMarkovianFixed.back() += rateFraction * element.getValue();
+                                }
+                            }
+                            ++rowIndex;
+                        }
+                        
+                        // Compute the probabilities of the number of Markovian jumps within the time bound.
+                        std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(uniformizationRate * timeBound, 1e+300, truncationFraction * precision);
+                        uint64_t leftTruncationPoint = std::get<0>(foxGlynnResult);
+                        uint64_t numberOfJumps = std::get<1>(foxGlynnResult);
+                        std::vector<ValueType> jumpProbabilities(numberOfJumps + 1, storm::utility::zero<ValueType>());
+                        for (uint64_t jumps = leftTruncationPoint; jumps <= numberOfJumps; ++jumps) {
+                            jumpProbabilities[jumps] = std::get<3>(foxGlynnResult)[jumps - leftTruncationPoint] / std::get<2>(foxGlynnResult);
+                        }
+                        std::vector<ValueType> atLeastJumpsProbabilities(numberOfJumps + 2, storm::utility::zero<ValueType>());
+                        for (uint64_t jumps = numberOfJumps + 1; jumps > 0; --jumps) {
+                            atLeastJumpsProbabilities[jumps - 1] = atLeastJumpsProbabilities[jumps] + jumpProbabilities[jumps - 1];
+                        }
+                        STORM_LOG_INFO("Performing " << numberOfJumps << " iterations (uniformization rate=" << uniformizationRate << ") for time bound " << timeBound << ".");
+                        
+                        if (iterativeSolver && !probabilisticNonGoalStates.empty()) {
+                            solverPrecision = solverFraction * precision / storm::utility::convertNumber<ValueType>(3 * (numberOfJumps + 1));
+                            storm::solver::IterativeMinMaxLinearEquationSolverSettings<ValueType> solverSettings = iterativeSolver->getSettings();
+                            solverSettings.setPrecision(solverPrecision);
+                            solverSettings.setRelativeTerminationCriterion(false);
+                            iterativeSolver->setSettings(solverSettings);
+                        }
+                        
+                        // Compute the values of the best scheduler that only observes the number of Markovian jumps so far.
+                        // Reaching a goal state with the k-th jump contributes the probability that at least k jumps happen
+                        // within the time bound.
+                        std::fill(vMarkovian.begin(), vMarkovian.end(), storm::utility::zero<ValueType>());
+                        std::fill(vProbabilistic.begin(), vProbabilistic.end(), storm::utility::zero<ValueType>());
+                        for (uint64_t jumps = numberOfJumps + 1; jumps > 0; --jumps) {
+                            aMarkovian.multiplyWithVector(vMarkovian, vMarkovianTmp);
+                            aMarkovianToProbabilistic.multiplyWithVector(vProbabilistic, vMarkovian);
+                            storm::utility::vector::addVectors(vMarkovian, vMarkovianTmp, vMarkovian);
+                            storm::utility::vector::addScaledVector(vMarkovian, bMarkovianFixed, atLeastJumpsProbabilities[jumps]);
+                            solveProbabilisticStates(atLeastJumpsProbabilities[jumps - 1], vMarkovian, vProbabilistic);
+                        }
+                        
+                        // Compute the values of the best schedulers that know the total number n of Markovian jumps, i.e.
+                        // the expectation of the n-step bounded reachability probabilities. These step bounded
+                        // probabilities can be computed incrementally.
+                        std::fill(wMarkovian.begin(), wMarkovian.end(), storm::utility::zero<ValueType>());
+                        solveProbabilisticStates(storm::utility::one<ValueType>(), wMarkovian, wProbabilistic);
+                        std::fill(boundMarkovian.begin(), boundMarkovian.end(), storm::utility::zero<ValueType>());
+                        boundProbabilistic = wProbabilistic;
+                        storm::utility::vector::scaleVectorInPlace(boundProbabilistic, jumpProbabilities[0]);
+                        for (uint64_t jumps = 1; jumps <= numberOfJumps; ++jumps) {
+                            aMarkovian.multiplyWithVector(wMarkovian, wMarkovianTmp);
+                            aMarkovianToProbabilistic.multiplyWithVector(wProbabilistic, wMarkovian);
+                            storm::utility::vector::addVectors(wMarkovian, wMarkovianTmp, wMarkovian);
+                            storm::utility::vector::addVectors(wMarkovian, bMarkovianFixed, wMarkovian);
+                            solveProbabilisticStates(storm::utility::one<ValueType>(), wMarkovian, wProbabilistic);
+                            storm::utility::vector::addScaledVector(boundMarkovian, wMarkovian, jumpProbabilities[jumps]);
+                            storm::utility::vector::addScaledVector(boundProbabilistic, wProbabilistic, jumpProbabilities[jumps]);
+                        }
+                        
+                        // The true values lie between the two computed values. As both of them result from numberOfJumps + 1
+                        // solutions of the equations of the probabilistic states, they may additionally be off by the
+                        // accumulated error of the solver. Hence, the error of the returned values is bounded by the gap
+                        // plus three times the accumulated error.
+                        ValueType boundPrecision = (storm::utility::one<ValueType>() - truncationFraction - solverFraction) * precision;
+                        ValueType gap = std::max(maximalDifference(vMarkovian, boundMarkovian), maximalDifference(vProbabilistic, boundProbabilistic));
+                        ValueType solverError = storm::utility::convertNumber<ValueType>(numberOfJumps + 1) * solverPrecision;
+                        ValueType errorBound = gap + storm::utility::convertNumber<ValueType>(3.0) * solverError;
+                        if (errorBound <= (storm::utility::one<ValueType>() - truncationFraction) * precision) {
+                            break;
+                        }
+                        
+                        // A finer uniformization shrinks the gap, but increases the number of jumps and thereby the error of
+                        // the solver. If the gap is already small enough, refining further does not help.
+                        if (gap <= boundPrecision) {
+                            STORM_LOG_WARN("The precision of the min/max equation solver only guarantees an error of " << errorBound << " of the time-bounded reachability probabilities (required: " << precision << "). Consider decreasing the precision of the min/max equation solver.");
+                            break;
+                        }
+                        if (numberOfRefinements == maximalNumberOfRefinements) {
+                            STORM_LOG_WARN("Stopping Unif+ after " << numberOfRefinements << " refinements of the uniformization rate. The error of the time-bounded reachability probabilities may be up to " << errorBound << " (required: " << precision << ").");
+                            break;
+                        }
+                        ++numberOfRefinements;
+                        uniformizationRate *= 2;
+                        STORM_LOG_DEBUG("Bounds are not precise enough, doubling the uniformization rate to " << uniformizationRate << ".");
+                    }
+                }
+                
+                std::vector<ValueType> result(numberOfStates);
+                storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+                storm::utility::vector::setVectorValues(result, probabilisticNonGoalStates, vProbabilistic);
+                storm::utility::vector::setVectorValues(result, markovianNonGoalStates, vMarkovian);
+                return result;
+            }
+            
             template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
             std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory) {
 
@@ -142,6 +340,13 @@ namespace storm {
                 // 'Unpack' the bounds to make them more easily accessible.
                 double lowerBound = boundsPair.first;
                 double upperBound = boundsPair.second;
+                
+                if (storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getMarkovAutomatonBoundedReachabilityMethod() == storm::solver::MaBoundedReachabilityMethod::UnifPlus) {
+                    if (lowerBound == 0.0) {
+                        return computeBoundedUntilProbabilitiesUnifPlus(dir, transitionMatrix, exitRateVector, markovianStates, psiStates, upperBound, minMaxLinearEquationSolverFactory);
+                    }
+                    STORM_LOG_WARN("Unif+ only supports time intervals starting at zero. Falling back to digitization.");
+                }
 
                 // (1) Compute the accuracy we need to achieve the required error bound.
                 ValueType maxExitRate = 0;
@@ -651,6 +856,8 @@ namespace storm {
             template std::vector<double> SparseMarkovAutomatonCslHelper::computeReachabilityTimes(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
             template void SparseMarkovAutomatonCslHelper::computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<double>& markovianNonGoalValues, std::vector<double>& probabilisticNonGoalValues, double delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
+
+            template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, double timeBound, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
             template double SparseMarkovAutomatonCslHelper::computeLraForMaximalEndComponent(OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec, storm::solver::MinMaxLinearEquationSolverFactory<double> const& minMaxLinearEquationSolverFactory);
                 
@@ -44,6 +44,16 @@ namespace storm {
                  template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                  static void computeBoundedReachabilityProbabilities(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates, storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues, std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
                 
+                /*!
+                 * Computes time-bounded reachability probabilities for the time interval [0, timeBound] using
+                 * uniformization (Unif+). The uniformization rate is doubled until the values of the best scheduler that
+                 * only observes the number of Markovian jumps are within the precision of the values of the best
+                 * schedulers that know the total number of jumps. As the former are achievable and the latter are an
+                 * upper (lower) bound for the maximal (minimal) probabilities, the result is guaranteed to be precise.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<ValueType> computeBoundedUntilProbabilitiesUnifPlus(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, double timeBound, storm::solver::MinMaxLinearEquationSolverFactory<ValueType> const& minMaxLinearEquationSolverFactory);
+                
                 /*!
                  * Computes the long-run average value for the given maximal end component of a Markov automaton.
                  *
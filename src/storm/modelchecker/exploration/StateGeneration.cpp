@@ -13,13 +13,13 @@ namespace storm {
                     StateType newIndex = stateStorage.getNumberOfStates();
                     
                     // Check, if the state was already registered.
-                    std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+                    StateType actualIndex = stateStorage.findOrAddState(state, newIndex);
                     
-                    if (actualIndexBucketPair.first == newIndex) {
+                    if (actualIndex == newIndex) {
                         explorationInformation.addUnexploredState(newIndex, state);
                     }
                     
-                    return actualIndexBucketPair.first;
+                    return actualIndex;
                 };
             }
             
@@ -55,34 +55,45 @@ namespace storm {
             void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchievablePoints() {
             
                 //First consider the objectives individually
-                for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size() && !this->maxStepsPerformed(); ++objIndex) {
-                    WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-                    direction[objIndex] = storm::utility::one<GeometryValueType>();
-                    this->performRefinementStep(std::move(direction));
+                for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size() && !this->maxStepsPerformed();) {
+                    std::vector<WeightVector> directions;
+                    for (uint_fast64_t numberOfDirections = this->getNumberOfWeightVectorsPerRound(); objIndex < this->objectives.size() && directions.size() < numberOfDirections; ++objIndex) {
+                        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+                        direction[objIndex] = storm::utility::one<GeometryValueType>();
+                        directions.push_back(std::move(direction));
+                    }
+                    this->performRefinementSteps(std::move(directions));
                 }
                 
                 while(!this->maxStepsPerformed()) {
-                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    // For each halfspace of the underApproximation, get the maximal distance to a vertex of the overApproximation
                     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
                     std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-                    uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    std::vector<std::pair<GeometryValueType, uint_fast64_t>> distanceHalfspacePairs;
+                    distanceHalfspacePairs.reserve(underApproxHalfspaces.size());
                     for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
                         for(auto const& vertex : overApproxVertices) {
-                            GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                            if(distance > farestDistance) {
-                                farestHalfspaceIndex = halfspaceIndex;
-                                farestDistance = distance;
-                            }
+                            farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
                         }
+                        distanceHalfspacePairs.emplace_back(std::move(farestDistance), halfspaceIndex);
                     }
-                    if(farestDistance < storm::utility::convertNumber<GeometryValueType>(storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getPrecision())) {
+                    
+                    // Refine the halfspaces with the largest distances. Ties are broken by the halfspace index to get a deterministic order.
+                    GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>().getPrecision());
+                    uint_fast64_t numberOfDirections = std::min<uint_fast64_t>(this->getNumberOfWeightVectorsPerRound(), distanceHalfspacePairs.size());
+                    auto compare = [] (std::pair<GeometryValueType, uint_fast64_t> const& lhs, std::pair<GeometryValueType, uint_fast64_t> const& rhs) { return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second); };
+                    std::partial_sort(distanceHalfspacePairs.begin(), distanceHalfspacePairs.begin() + numberOfDirections, distanceHalfspacePairs.end(), compare);
+                    if(distanceHalfspacePairs.empty() || distanceHalfspacePairs.front().first < precision) {
                         // Goal precision reached!
                         return;
                     }
-                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-                    WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-                    this->performRefinementStep(std::move(direction));
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(distanceHalfspacePairs.front().first));
+                    std::vector<WeightVector> directions;
+                    for (uint_fast64_t index = 0; index < numberOfDirections && !(distanceHalfspacePairs[index].first < precision); ++index) {
+                        directions.push_back(underApproxHalfspaces[distanceHalfspacePairs[index].second].normalVector());
+                    }
+                    this->performRefinementSteps(std::move(directions));
                 }
                 STORM_LOG_ERROR("Could not reach the desired precision: Exceeded maximum number of refinement steps");
             }
@@ -13,6 +13,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/export.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -24,32 +25,33 @@ namespace storm {
             template <class SparseModelType, typename GeometryValueType>
             SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(SparseMultiObjectivePreprocessorReturnType<SparseModelType>& preprocessorResult) :
                 originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula),
-                preprocessedModel(std::move(*preprocessorResult.preprocessedModel)), objectives(std::move(preprocessorResult.objectives)) {
+                preprocessedModel(std::move(*preprocessorResult.preprocessedModel)), objectives(std::move(preprocessorResult.objectives)),
+                possibleECChoices(preprocessorResult.possibleECChoices), possibleBottomStates(preprocessorResult.possibleBottomStates) {
                 
-                initializeWeightVectorChecker(preprocessedModel, objectives, preprocessorResult.possibleECChoices, preprocessorResult.possibleBottomStates);
+                this->weightVectorChecker = createWeightVectorChecker();
                 this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
                 this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
                 this->underApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createEmptyPolytope();
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::Mdp<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>> SparsePcaaQuery<storm::models::sparse::Mdp<double>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<double>>(preprocessedModel, objectives, possibleECChoices, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::Mdp<storm::RationalNumber>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::Mdp<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>> SparsePcaaQuery<storm::models::sparse::Mdp<storm::RationalNumber>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>>(new SparseMdpPcaaWeightVectorChecker<storm::models::sparse::Mdp<storm::RationalNumber>>(preprocessedModel, objectives, possibleECChoices, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<double>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::MarkovAutomaton<double> const& model, std::vector<Objective<double>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>> SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<double>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<double>>(preprocessedModel, objectives, possibleECChoices, possibleBottomStates));
             }
             
             template<>
-            void SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>, storm::RationalNumber>::initializeWeightVectorChecker(storm::models::sparse::MarkovAutomaton<storm::RationalNumber> const& model, std::vector<Objective<storm::RationalNumber>> const& objectives, storm::storage::BitVector const& possibleECActions, storm::storage::BitVector const& possibleBottomStates) {
-                this->weightVectorChecker = std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>(model, objectives, possibleECActions, possibleBottomStates));
+            std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>> SparsePcaaQuery<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>, storm::RationalNumber>::createWeightVectorChecker() const {
+                return std::unique_ptr<SparsePcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>>(new SparseMaPcaaWeightVectorChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>(preprocessedModel, objectives, possibleECChoices, possibleBottomStates));
             }
             
             
@@ -100,11 +102,19 @@ namespace storm {
                 // Normalize the direction vector so that the entries sum up to one
                 storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
                 weightVectorChecker->check(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                addRefinementStep(std::move(direction), *weightVectorChecker);
+                
+                updateOverApproximation();
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::addRefinementStep(WeightVector&& direction, SparsePcaaWeightVectorChecker<SparseModelType> const& checker) {
+                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
                 RefinementStep step;
-                step.weightVector = direction;
-                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+                step.weightVector = std::move(direction);
+                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
                 // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
                 for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -113,11 +123,64 @@ namespace storm {
                     }
                 }
                 refinementSteps.push_back(std::move(step));
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(std::vector<WeightVector>&& directions) {
+                storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+                if (directions.size() == 1 || pool.getThreadCount() <= 1 || !storm::utility::ThreadPool::supportsParallelComputations<typename SparseModelType::ValueType>()) {
+                    // Without further threads, additional checkers would only cost memory. Exact weight vector checkers are not run
+                    // concurrently as the number representation is not necessarily thread-safe.
+                    for (auto& direction : directions) {
+                        performRefinementStep(std::move(direction));
+                    }
+                    return;
+                }
                 
-                updateOverApproximation();
+                // Normalize the direction vectors and convert them before entering the parallel section, as GeometryValueType is a rational number type.
+                std::vector<std::vector<typename SparseModelType::ValueType>> weightVectors;
+                weightVectors.reserve(directions.size());
+                for (auto& direction : directions) {
+                    storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
+                    weightVectors.push_back(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+                }
+                
+                // The first direction is handled by the main checker, the remaining ones by additional checkers.
+                while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+                    additionalWeightVectorCheckers.push_back(createWeightVectorChecker());
+                }
+                for (auto& checker : additionalWeightVectorCheckers) {
+                    checker->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+                }
+                auto getChecker = [this] (uint64_t index) -> SparsePcaaWeightVectorChecker<SparseModelType>& {
+                    return index == 0 ? *weightVectorChecker : *additionalWeightVectorCheckers[index - 1];
+                };
+                
+                pool.parallelFor(directions.size(), [] (uint64_t index) { return index; }, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        getChecker(index).check(weightVectors[index]);
+                    }
+                }, 1);
+                
+                // Merge the results in the order of the given directions so that the outcome does not depend on the scheduling.
+                for (uint64_t index = 0; index < directions.size(); ++index) {
+                    addRefinementStep(std::move(directions[index]), getChecker(index));
+                    updateOverApproximation();
+                }
                 updateUnderApproximation();
             }
             
+            template <class SparseModelType, typename GeometryValueType>
+            uint_fast64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getNumberOfWeightVectorsPerRound() const {
+                auto const& settings = storm::settings::getModule<storm::settings::modules::MultiObjectiveSettings>();
+                uint_fast64_t result = settings.getNumberOfParallelWeightVectors();
+                if (settings.isMaxStepsSet()) {
+                    uint_fast64_t remainingSteps = settings.getMaxSteps() > this->refinementSteps.size() ? settings.getMaxSteps() - this->refinementSteps.size() : 0;
+                    result = std::min(result, remainingSteps);
+                }
+                return result;
+            }
+            
             template <class SparseModelType, typename GeometryValueType>
             void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
                 storm::storage::geometry::Halfspace<GeometryValueType> h(refinementSteps.back().weightVector, storm::utility::vector::dotProduct(refinementSteps.back().weightVector, refinementSteps.back().upperBoundPoint));
@@ -40,12 +40,9 @@ namespace storm {
             protected:
                 
                 /*
-                 * Initializes the weight vector checker with the provided data from preprocessing
+                 * Creates a weight vector checker for the preprocessed model and objectives of this query
                  */
-                void initializeWeightVectorChecker(SparseModelType const& model,
-                                                   std::vector<Objective<typename SparseModelType::ValueType>> const& objectives,
-                                                   storm::storage::BitVector const& possibleECActions,
-                                                   storm::storage::BitVector const& possibleBottomStates);
+                std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>> createWeightVectorChecker() const;
                 
                 /*
                  * Represents the information obtained in a single iteration of the algorithm
@@ -75,6 +72,25 @@ namespace storm {
                  */
                 void performRefinementStep(WeightVector&& direction);
                 
+                /*
+                 * Refines the current result w.r.t. all the given direction vectors. If requested in the settings and several threads are
+                 * available, the directions are checked concurrently on separate weight vector checkers that share the preprocessed model.
+                 * The obtained points are merged into the approximations in the order of the given directions.
+                 */
+                void performRefinementSteps(std::vector<WeightVector>&& directions);
+                
+                /*
+                 * Stores the results of the given checker (which has been invoked on the given, normalized direction) as a new refinement step.
+                 * The approximations are not updated.
+                 */
+                void addRefinementStep(WeightVector&& direction, SparsePcaaWeightVectorChecker<SparseModelType> const& checker);
+                
+                /*
+                 * Returns the number of weight vectors that may be checked within a single round of refinement steps.
+                 * This also takes the maximal number of refinement steps (as possibly specified in the settings) into account.
+                 */
+                uint_fast64_t getNumberOfWeightVectorsPerRound() const;
+                
                 /*
                  * Updates the overapproximation after a refinement step has been performed
                  *
@@ -106,9 +122,13 @@ namespace storm {
                 
                 SparseModelType preprocessedModel;
                 std::vector<Objective<typename SparseModelType::ValueType>> objectives;
+                storm::storage::BitVector possibleECChoices;
+                storm::storage::BitVector possibleBottomStates;
                 
                 // The corresponding weight vector checker
                 std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+                // Further weight vector checkers that are used to check multiple weight vectors concurrently (created on demand).
+                std::vector<std::unique_ptr<SparsePcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
 
                 //The results in each iteration of the algorithm
                 std::vector<RefinementStep> refinementSteps;
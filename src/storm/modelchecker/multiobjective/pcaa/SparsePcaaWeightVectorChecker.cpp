@@ -219,12 +219,18 @@ namespace storm {
                    std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());
                    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
 
-                   // We compute an estimate for the results of the individual objectives which is obtained from the weighted result and the result of the objectives computed so far.
+                   // We compute an estimate for the results of the individual objectives which is obtained from the weighted result.
                    // Note that weightedResult = Sum_{i=1}^{n} w_i * objectiveResult_i.
-                   std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
-                   ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
-
-                   for (uint_fast64_t const &objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
+                   ValueType sumOfWeights = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
+                   
+                   // The objectives are all checked on the same (deterministic) matrix. We therefore solve them together
+                   // on the states from which a state with reward (for some objective) is reachable. For every other
+                   // objective, such a state either has value zero or reaches its rewards, so this does not change the
+                   // solution of the individual equation systems.
+                   std::vector<uint_fast64_t> consideredObjectives;
+                   std::vector<std::vector<ValueType>> objectiveStateRewards;
+                   storm::storage::BitVector maybeStates(deterministicMatrix.getRowCount(), false);
+                   for (uint_fast64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
                        auto const& obj = objectives[objIndex];
                        if (objectivesWithNoUpperTimeBound.get(objIndex)) {
                            offsetsToUnderApproximation[objIndex] = storm::utility::zero<ValueType>();
@@ -232,12 +238,12 @@ namespace storm {
                            storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, model.getTransitionMatrix().getRowGroupIndices(), discreteActionRewards[objIndex]);
                            storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
                            // As maybestates we pick the states from which a state with reward is reachable
-                           storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
-
+                           maybeStates |= storm::utility::graph::performProbGreater0(deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
+                           
                            // Compute the estimate for this objective
                            if (!storm::utility::isZero(weightVector[objIndex])) {
-                               objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
-                               ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
+                               objectiveResults[objIndex] = weightedResult;
+                               ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeights;
                                if (storm::solver::minimize(obj.formula->getOptimalityType())) {
                                    scalingFactor *= -storm::utility::one<ValueType>();
                                }
@@ -246,42 +252,115 @@ namespace storm {
                            }
                            // Make sure that the objectiveResult is initialized correctly
                            objectiveResults[objIndex].resize(model.getNumberOfStates(), storm::utility::zero<ValueType>());
-
-                           if (!maybeStates.empty()) {
-                               storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(
-                                       true, maybeStates, maybeStates, true);
-                               // Converting the matrix from the fixpoint notation to the form needed for the equation
-                               // system. That is, we go from x = A*x + b to (I-A)x = b.
-                               submatrix.convertToEquationSystem();
-
-                               // Prepare solution vector and rhs of the equation system.
-                               std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates);
-                               std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards, maybeStates);
-
-                               // Now solve the resulting equation system.
-                               std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(submatrix));
-                               if (obj.lowerResultBound) {
-                                   solver->setLowerBound(*obj.lowerResultBound);
+                           
+                           consideredObjectives.push_back(objIndex);
+                           objectiveStateRewards.push_back(deterministicStateRewards);
+                       } else {
+                           objectiveResults[objIndex] = std::vector<ValueType>(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+                       }
+                   }
+                   
+                   if (!maybeStates.empty()) {
+                       bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+                       storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, convertToEquationSystem);
+                       if (convertToEquationSystem) {
+                           // Converting the matrix from the fixpoint notation to the form needed for the equation
+                           // system. That is, we go from x = A*x + b to (I-A)x = b.
+                           submatrix.convertToEquationSystem();
+                       }
+                       
+                       // The objective with the largest weight is solved last. Once all other objectives are known, its
+                       // estimate can be refined to (weightedResult - Sum_{i != j} w_i * objectiveResult_i) / w_j, which is
+                       // (almost) its exact solution. All other objectives are solved together in one block.
+                       boost::optional<uint_fast64_t> refinedObjective;
+                       if (consideredObjectives.size() > 1) {
+                           uint_fast64_t candidate = consideredObjectives.size() - 1;
+                           for (uint_fast64_t i = 0; i + 1 < consideredObjectives.size(); ++i) {
+                               if (weightVector[consideredObjectives[i]] > weightVector[consideredObjectives[candidate]]) {
+                                   candidate = i;
                                }
-                               if (obj.upperResultBound) {
-                                   solver->setUpperBound(*obj.upperResultBound);
+                           }
+                           if (!storm::utility::isZero(weightVector[consideredObjectives[candidate]])) {
+                               refinedObjective = candidate;
+                           }
+                       }
+                       
+                       // Prepare solution vectors and right-hand sides of the equation systems.
+                       std::vector<std::vector<ValueType>> x, b;
+                       boost::optional<ValueType> lowerBound, upperBound;
+                       bool allObjectivesHaveLowerBound = true, allObjectivesHaveUpperBound = true;
+                       for (uint_fast64_t i = 0; i < consideredObjectives.size(); ++i) {
+                           auto const& obj = objectives[consideredObjectives[i]];
+                           if (!refinedObjective || i != refinedObjective.get()) {
+                               x.push_back(storm::utility::vector::filterVector(objectiveResults[consideredObjectives[i]], maybeStates));
+                               b.push_back(storm::utility::vector::filterVector(objectiveStateRewards[i], maybeStates));
+                           }
+                           if (obj.lowerResultBound) {
+                               lowerBound = lowerBound ? storm::utility::min<ValueType>(lowerBound.get(), obj.lowerResultBound.get()) : obj.lowerResultBound.get();
+                           } else {
+                               allObjectivesHaveLowerBound = false;
+                           }
+                           if (obj.upperResultBound) {
+                               upperBound = upperBound ? storm::utility::max<ValueType>(upperBound.get(), obj.upperResultBound.get()) : obj.upperResultBound.get();
+                           } else {
+                               allObjectivesHaveUpperBound = false;
+                           }
+                       }
+                       
+                       // Now solve the resulting equation systems.
+                       std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(std::move(submatrix));
+                       if (allObjectivesHaveLowerBound) {
+                           solver->setLowerBound(lowerBound.get());
+                       }
+                       if (allObjectivesHaveUpperBound) {
+                           solver->setUpperBound(upperBound.get());
+                       }
+                       if (refinedObjective) {
+                           // The solver is used once more for the refined objective, so its data should be kept.
+                           solver->setCachingEnabled(true);
+                       }
+                       solver->solveEquations(x, b);
+                       
+                       // Set the results for the objectives accordingly
+                       auto xIt = x.begin();
+                       for (uint_fast64_t i = 0; i < consideredObjectives.size(); ++i) {
+                           if (!refinedObjective || i != refinedObjective.get()) {
+                               storm::utility::vector::setVectorValues<ValueType>(objectiveResults[consideredObjectives[i]], maybeStates, *xIt);
+                               ++xIt;
+                           }
+                       }
+                       
+                       if (refinedObjective) {
+                           // Update the estimate with the results of the other objectives and solve the remaining system.
+                           std::vector<ValueType> refinedX = storm::utility::vector::filterVector(weightedResult, maybeStates);
+                           xIt = x.begin();
+                           for (uint_fast64_t i = 0; i < consideredObjectives.size(); ++i) {
+                               if (i != refinedObjective.get()) {
+                                   ValueType weight = weightVector[consideredObjectives[i]];
+                                   if (storm::solver::minimize(objectives[consideredObjectives[i]].formula->getOptimalityType())) {
+                                       weight *= -storm::utility::one<ValueType>();
+                                   }
+                                   storm::utility::vector::addScaledVector(refinedX, *xIt, -weight);
+                                   ++xIt;
                                }
-                               solver->solveEquations(x, b);
-
-                               // Set the result for this objective accordingly
-                               storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, x);
                            }
-                           storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
-
-                           // Update the estimate for the next objectives.
-                           if (!storm::utility::isZero(weightVector[objIndex])) {
-                               storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
-                               sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
+                           uint_fast64_t objIndex = consideredObjectives[refinedObjective.get()];
+                           auto const& obj = objectives[objIndex];
+                           ValueType scalingFactor = storm::utility::one<ValueType>() / weightVector[objIndex];
+                           if (storm::solver::minimize(obj.formula->getOptimalityType())) {
+                               scalingFactor *= -storm::utility::one<ValueType>();
                            }
-                       } else {
-                           objectiveResults[objIndex] = std::vector<ValueType>(model.getNumberOfStates(), storm::utility::zero<ValueType>());
+                           storm::utility::vector::scaleVectorInPlace(refinedX, scalingFactor);
+                           storm::utility::vector::clip(refinedX, obj.lowerResultBound, obj.upperResultBound);
+                           
+                           std::vector<ValueType> refinedB = storm::utility::vector::filterVector(objectiveStateRewards[refinedObjective.get()], maybeStates);
+                           solver->solveEquations(refinedX, refinedB);
+                           storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, refinedX);
                        }
                    }
+                   for (auto objIndex : consideredObjectives) {
+                       storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
+                   }
                }
             }
             
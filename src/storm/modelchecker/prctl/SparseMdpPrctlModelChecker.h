@@ -4,6 +4,7 @@
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrecomputationCache.h"
 
 namespace storm {
     namespace modelchecker {
@@ -30,9 +31,35 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
             
+            /*!
+             * Sets the cache for the graph-based precomputations. Model checkers that share a cache reuse each other's
+             * precomputations, so the cache must only be shared among model checkers of the same model.
+             *
+             * @param precomputationCache The cache to use.
+             */
+            void setPrecomputationCache(std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>> const& precomputationCache);
+            
+            /*!
+             * Announces that the given task will be checked later with this precomputation cache. Announced expected
+             * reward queries that share their target states and optimization direction are then computed together.
+             * Announcing tasks is optional and does not change any result.
+             *
+             * @param checkTask The task that will be checked later.
+             */
+            void announceTask(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+            
         private:
+            /*!
+             * Retrieves the backward transitions of the model. They are computed on the first call and then reused
+             * for all subsequent properties that share the precomputation cache.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions();
+            
             // An object that is used for retrieving solvers for systems of linear equations that are the result of nondeterministic choices.
             std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ValueType>> minMaxLinearEquationSolverFactory;
+            
+            // The results of the graph-based precomputations that may be shared among several properties.
+            std::shared_ptr<storm::modelchecker::helper::SparseMdpPrecomputationCache<ValueType>> precomputationCache;
         };
     } // namespace modelchecker
 } // namespace storm
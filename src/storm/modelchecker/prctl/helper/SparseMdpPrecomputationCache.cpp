@@ -0,0 +1,128 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpPrecomputationCache.h"
+
+#include <algorithm>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            
+            template<typename ValueType>
+            SparseMdpPrecomputationCache<ValueType>::SparseMdpPrecomputationCache() = default;
+            
+            template<typename ValueType>
+            SparseMdpPrecomputationCache<ValueType>::~SparseMdpPrecomputationCache() = default;
+            
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& SparseMdpPrecomputationCache<ValueType>::getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                if (!backwardTransitions) {
+                    backwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(transitionMatrix.transpose(true));
+                }
+                return *backwardTransitions;
+            }
+            
+            template<typename ValueType>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> const& SparseMdpPrecomputationCache<ValueType>::getProb01(storm::OptimizationDirection const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                auto key = std::make_tuple(dir, phiStates, psiStates);
+                auto it = prob01Results.find(key);
+                if (it == prob01Results.end()) {
+                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+                    if (storm::solver::minimize(dir)) {
+                        statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+                    } else {
+                        statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+                    }
+                    it = prob01Results.emplace(std::move(key), std::move(statesWithProbability01)).first;
+                } else {
+                    STORM_LOG_DEBUG("Reusing the states with probability 0 and 1 of a previous computation.");
+                }
+                return it->second;
+            }
+            
+            template<typename ValueType>
+            storm::storage::BitVector const& SparseMdpPrecomputationCache<ValueType>::getProb1(storm::OptimizationDirection const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates) {
+                auto key = std::make_pair(dir, targetStates);
+                auto it = prob1Results.find(key);
+                if (it == prob1Results.end()) {
+                    storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
+                    storm::storage::BitVector statesWithProbability1;
+                    if (storm::solver::minimize(dir)) {
+                        statesWithProbability1 = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, trueStates, targetStates);
+                    } else {
+                        statesWithProbability1 = storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, trueStates, targetStates);
+                    }
+                    it = prob1Results.emplace(std::move(key), std::move(statesWithProbability1)).first;
+                } else {
+                    STORM_LOG_DEBUG("Reusing the states with probability 1 of a previous computation.");
+                }
+                return it->second;
+            }
+            
+            template<typename ValueType>
+            storm::storage::MaximalEndComponentDecomposition<ValueType> const& SparseMdpPrecomputationCache<ValueType>::getMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
+                if (!maximalEndComponentDecomposition) {
+                    maximalEndComponentDecomposition = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(transitionMatrix, backwardTransitions);
+                } else {
+                    STORM_LOG_DEBUG("Reusing the maximal end component decomposition of a previous computation.");
+                }
+                return *maximalEndComponentDecomposition;
+            }
+            
+            template<typename ValueType>
+            void SparseMdpPrecomputationCache<ValueType>::announceReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType>&& choiceRewards) {
+                std::vector<std::vector<ValueType>>& announced = announcedReachabilityRewards[std::make_pair(dir, targetStates)];
+                if (std::find(announced.begin(), announced.end(), choiceRewards) == announced.end()) {
+                    announced.push_back(std::move(choiceRewards));
+                }
+            }
+            
+            template<typename ValueType>
+            std::vector<std::vector<ValueType>> SparseMdpPrecomputationCache<ValueType>::takeAnnouncedReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType> const& choiceRewards) {
+                std::vector<std::vector<ValueType>> result;
+                auto it = announcedReachabilityRewards.find(std::make_pair(dir, targetStates));
+                if (it != announcedReachabilityRewards.end() && std::find(it->second.begin(), it->second.end(), choiceRewards) != it->second.end()) {
+                    result = std::move(it->second);
+                    announcedReachabilityRewards.erase(it);
+                }
+                return result;
+            }
+            
+            template<typename ValueType>
+            void SparseMdpPrecomputationCache<ValueType>::storeReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType> const& choiceRewards, std::vector<ValueType>&& values) {
+                reachabilityRewardResults[std::make_pair(dir, targetStates)].emplace_back(choiceRewards, std::move(values));
+            }
+            
+            template<typename ValueType>
+            boost::optional<std::vector<ValueType>> SparseMdpPrecomputationCache<ValueType>::retrieveReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType> const& choiceRewards) {
+                boost::optional<std::vector<ValueType>> result;
+                auto it = reachabilityRewardResults.find(std::make_pair(dir, targetStates));
+                if (it != reachabilityRewardResults.end()) {
+                    auto resultIt = std::find_if(it->second.begin(), it->second.end(), [&choiceRewards] (std::pair<std::vector<ValueType>, std::vector<ValueType>> const& entry) { return entry.first == choiceRewards; });
+                    if (resultIt != it->second.end()) {
+                        STORM_LOG_DEBUG("Reusing the expected rewards that were computed together with a previous query.");
+                        result = std::move(resultIt->second);
+                        it->second.erase(resultIt);
+                        if (it->second.empty()) {
+                            reachabilityRewardResults.erase(it);
+                        }
+                    }
+                }
+                return result;
+            }
+            
+            template class SparseMdpPrecomputationCache<double>;
+            
+#ifdef STORM_HAVE_CARL
+            template class SparseMdpPrecomputationCache<storm::RationalNumber>;
+#endif
+            
+        }
+    }
+}
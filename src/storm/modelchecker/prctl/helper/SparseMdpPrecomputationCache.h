@@ -0,0 +1,98 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+        template <typename ValueType>
+        class SparseMatrix;
+        
+        template <typename ValueType>
+        class MaximalEndComponentDecomposition;
+    }
+    
+    namespace modelchecker {
+        namespace helper {
+            
+            /*!
+             * Stores the results of the graph-based precomputations on an MDP, so that several properties of the same
+             * MDP can share them. The results are keyed by the state sets and the optimization direction they were
+             * computed for. A cache must only be used with one transition matrix.
+             *
+             * Additionally, expected reward queries can be announced before they are checked. The queries that share
+             * their target states and optimization direction (but not their rewards) lead to equation systems that
+             * only differ in their right-hand sides, so they can be solved together once the first of them is checked.
+             */
+            template<typename ValueType>
+            class SparseMdpPrecomputationCache {
+            public:
+                SparseMdpPrecomputationCache();
+                ~SparseMdpPrecomputationCache();
+                
+                /*!
+                 * Retrieves the backward transitions of the given transition matrix.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+                
+                /*!
+                 * Retrieves the states that satisfy phi U psi with minimal (maximal) probability 0 and 1, respectively.
+                 */
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> const& getProb01(storm::OptimizationDirection const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                
+                /*!
+                 * Retrieves the states that reach the target states with probability 1 under some (dir = minimize) or
+                 * all (dir = maximize) schedulers.
+                 */
+                storm::storage::BitVector const& getProb1(storm::OptimizationDirection const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates);
+                
+                /*!
+                 * Retrieves the decomposition of the whole MDP into maximal end components.
+                 */
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const& getMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions);
+                
+                /*!
+                 * Announces that the expected rewards (given as the total rewards of all choices) until reaching the
+                 * target states will be requested for the given optimization direction.
+                 */
+                void announceReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType>&& choiceRewards);
+                
+                /*!
+                 * Retrieves and removes all choice rewards that were announced for the given target states and
+                 * optimization direction, provided that the given choice rewards are among them. Otherwise, nothing is
+                 * removed and the result is empty.
+                 */
+                std::vector<std::vector<ValueType>> takeAnnouncedReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType> const& choiceRewards);
+                
+                /*!
+                 * Stores the expected rewards that were computed for announced choice rewards.
+                 */
+                void storeReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType> const& choiceRewards, std::vector<ValueType>&& values);
+                
+                /*!
+                 * Retrieves and removes the stored expected rewards for the given choice rewards, if there are any.
+                 */
+                boost::optional<std::vector<ValueType>> retrieveReachabilityRewards(storm::OptimizationDirection const& dir, storm::storage::BitVector const& targetStates, std::vector<ValueType> const& choiceRewards);
+                
+            private:
+                std::unique_ptr<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+                std::map<std::tuple<storm::OptimizationDirection, storm::storage::BitVector, storm::storage::BitVector>, std::pair<storm::storage::BitVector, storm::storage::BitVector>> prob01Results;
+                std::map<std::pair<storm::OptimizationDirection, storm::storage::BitVector>, storm::storage::BitVector> prob1Results;
+                std::unique_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType>> maximalEndComponentDecomposition;
+                
+                // The announced choice rewards and the stored results of expected reward queries.
+                std::map<std::pair<storm::OptimizationDirection, storm::storage::BitVector>, std::vector<std::vector<ValueType>>> announcedReachabilityRewards;
+                std::map<std::pair<storm::OptimizationDirection, storm::storage::BitVector>, std::vector<std::pair<std::vector<ValueType>, std::vector<ValueType>>>> reachabilityRewardResults;
+            };
+            
+        }
+    }
+}
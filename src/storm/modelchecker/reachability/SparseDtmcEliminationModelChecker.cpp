@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <random>
 #include <chrono>
+#include <unordered_map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -25,6 +26,7 @@
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 
 #include "storm/utility/stateelimination.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
@@ -840,15 +842,15 @@ namespace storm {
             // When using the hybrid technique, we recursively treat the SCCs up to some size.
             std::vector<storm::storage::sparse::state_type> entryStateQueue;
             STORM_LOG_DEBUG("Eliminating " << subsystem.size() << " states using the hybrid elimination technique." << std::endl);
+            STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::EliminationSettings>().isParallelSccEliminationSet() || storm::utility::ThreadPool::supportsParallelComputations<ValueType>(), "The SCCs are eliminated sequentially, because the value type does not support parallel computations.");
             uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0, storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
             
-            // If the entry states were to be eliminated last, we need to do so now.
-            if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet()) {
-                STORM_LOG_DEBUG("Eliminating " << entryStateQueue.size() << " entry states as a last step.");
-                std::vector<storm::storage::sparse::state_type> sortedStates(entryStateQueue.begin(), entryStateQueue.end());
-                std::shared_ptr<StatePriorityQueue> queuePriorities = std::make_shared<StaticStatePriorityQueue>(sortedStates);
-                performPrioritizedStateElimination(queuePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
-            }
+            // Finally, eliminate the queued entry states. Besides the entry states of the sub-SCCs (if they were to be
+            // eliminated last), these are the entry states of the top level, i.e. the initial states.
+            STORM_LOG_DEBUG("Eliminating " << entryStateQueue.size() << " entry states as a last step.");
+            std::vector<storm::storage::sparse::state_type> sortedStates(entryStateQueue.begin(), entryStateQueue.end());
+            std::shared_ptr<StatePriorityQueue> queuePriorities = std::make_shared<StaticStatePriorityQueue>(sortedStates);
+            performPrioritizedStateElimination(queuePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
             STORM_LOG_DEBUG("Eliminated " << subsystem.size() << " states." << std::endl);
             return maximalDepth;
         }
@@ -919,6 +921,52 @@ namespace storm {
                 performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
                 STORM_LOG_TRACE("Eliminated all trivial SCCs.");
                 
+                // Determines the entry states of the given sub-SCC.
+                auto computeEntryStates = [&] (storm::storage::BitVector const& newSccAsBitVector) {
+                    storm::storage::BitVector entryStates(forwardTransitions.getRowCount());
+                    for (auto const& state : newSccAsBitVector) {
+                        for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                            if (predecessor.getValue() != storm::utility::zero<ValueType>() && !newSccAsBitVector.get(predecessor.getColumn())) {
+                                entryStates.set(state);
+                            }
+                        }
+                    }
+                    return entryStates;
+                };
+                
+                storm::settings::modules::EliminationSettings const& eliminationSettings = storm::settings::getModule<storm::settings::modules::EliminationSettings>();
+                bool eliminateEntryStatesOfSubSccs = eliminateEntryStates || !eliminationSettings.isEliminateEntryStatesLastSet();
+                
+                // If requested, the sub-SCCs that are small enough to be eliminated directly are treated in parallel.
+                if (eliminationSettings.isParallelSccEliminationSet()) {
+                    std::vector<storm::storage::BitVector> leafSccs;
+                    std::vector<storm::storage::BitVector> leafSccEntryStates;
+                    for (auto sccIndex : remainingSccs) {
+                        storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
+                        if (newScc.size() <= maximalSccSize) {
+                            leafSccs.emplace_back(forwardTransitions.getRowCount(), newScc.begin(), newScc.end());
+                            leafSccEntryStates.push_back(computeEntryStates(leafSccs.back()));
+                            remainingSccs.set(sccIndex, false);
+                        }
+                    }
+                    
+                    if (!leafSccs.empty()) {
+                        STORM_LOG_TRACE("Eliminating " << leafSccs.size() << " SCCs on level " << level << " in parallel.");
+                        performParallelSccElimination(matrix, backwardTransitions, values, leafSccs, leafSccEntryStates, initialStates, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                        for (auto const& sccEntryStates : leafSccEntryStates) {
+                            if (eliminateEntryStatesOfSubSccs) {
+                                std::shared_ptr<StatePriorityQueue> naivePriorities = createStatePriorityQueue(sccEntryStates);
+                                performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+                            } else {
+                                for (auto state : sccEntryStates) {
+                                    entryStateQueue.push_back(state);
+                                }
+                            }
+                        }
+                        maximalDepth = std::max(maximalDepth, level + 1);
+                    }
+                }
+                
                 // And then recursively treat the remaining sub-SCCs.
                 STORM_LOG_TRACE("Eliminating " << remainingSccs.getNumberOfSetBits() << " remaining SCCs on level " << level << ".");
                 for (auto sccIndex : remainingSccs) {
@@ -928,17 +976,10 @@ namespace storm {
                     storm::storage::BitVector newSccAsBitVector(forwardTransitions.getRowCount(), newScc.begin(), newScc.end());
                     
                     // Determine the set of entry states of the SCC.
-                    storm::storage::BitVector entryStates(forwardTransitions.getRowCount());
-                    for (auto const& state : newScc) {
-                        for (auto const& predecessor : backwardTransitions.getRow(state)) {
-                            if (predecessor.getValue() != storm::utility::zero<ValueType>() && !newSccAsBitVector.get(predecessor.getColumn())) {
-                                entryStates.set(state);
-                            }
-                        }
-                    }
+                    storm::storage::BitVector entryStates = computeEntryStates(newSccAsBitVector);
                     
                     // Recursively descend in SCC-hierarchy.
-                    uint_fast64_t depth = treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions, eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(), level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                    uint_fast64_t depth = treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions, eliminateEntryStatesOfSubSccs, level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
                     maximalDepth = std::max(maximalDepth, depth);
                 }
             } else {
@@ -965,6 +1006,147 @@ namespace storm {
             return maximalDepth;
         }
         
+        template<typename SparseDtmcModelType>
+        void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performParallelSccElimination(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, std::vector<storm::storage::BitVector> const& sccs, std::vector<storm::storage::BitVector> const& sccEntryStates, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+            // Every SCC is eliminated on a local copy (slice) of the rows it touches. As only the non-entry states of an
+            // SCC are eliminated, this changes only the forward rows of the states of the SCC and the backward entries
+            // whose column is a state of the SCC. Hence, the slices can be worked on independently and be written back
+            // one after another afterwards. The states of the SCC come first in a slice, followed by their successors
+            // outside of the SCC.
+            struct SccSlice {
+                std::vector<storm::storage::sparse::state_type> localToGlobal;
+                uint_fast64_t numberOfSccStates;
+                storm::storage::FlexibleSparseMatrix<ValueType> matrix;
+                storm::storage::FlexibleSparseMatrix<ValueType> backwardTransitions;
+                std::vector<ValueType> values;
+            };
+            std::vector<SccSlice> slices(sccs.size());
+            
+            auto columnLess = [] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a, storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& b) { return a.getColumn() < b.getColumn(); };
+            
+            auto eliminateScc = [&] (uint64_t index) {
+                storm::storage::BitVector const& scc = sccs[index];
+                SccSlice& slice = slices[index];
+                
+                // Build the mapping from the global to the local state indices.
+                std::unordered_map<storm::storage::sparse::state_type, storm::storage::sparse::state_type> globalToLocal;
+                slice.localToGlobal.assign(scc.begin(), scc.end());
+                slice.numberOfSccStates = slice.localToGlobal.size();
+                for (uint_fast64_t localState = 0; localState < slice.numberOfSccStates; ++localState) {
+                    globalToLocal[slice.localToGlobal[localState]] = localState;
+                }
+                for (uint_fast64_t localState = 0; localState < slice.numberOfSccStates; ++localState) {
+                    for (auto const& entry : matrix.getRow(slice.localToGlobal[localState])) {
+                        if (globalToLocal.emplace(entry.getColumn(), slice.localToGlobal.size()).second) {
+                            slice.localToGlobal.push_back(entry.getColumn());
+                        }
+                    }
+                }
+                uint_fast64_t numberOfLocalStates = slice.localToGlobal.size();
+                
+                // Copy the relevant parts of the matrices and the values.
+                slice.matrix = storm::storage::FlexibleSparseMatrix<ValueType>(numberOfLocalStates);
+                slice.backwardTransitions = storm::storage::FlexibleSparseMatrix<ValueType>(numberOfLocalStates);
+                slice.values.reserve(numberOfLocalStates);
+                storm::storage::BitVector localInitialStates(numberOfLocalStates);
+                storm::storage::BitVector localStatesToEliminate(numberOfLocalStates);
+                boost::optional<std::vector<uint_fast64_t>> localDistanceBasedPriorities;
+                if (distanceBasedPriorities) {
+                    localDistanceBasedPriorities = std::vector<uint_fast64_t>(numberOfLocalStates);
+                }
+                for (uint_fast64_t localState = 0; localState < numberOfLocalStates; ++localState) {
+                    storm::storage::sparse::state_type globalState = slice.localToGlobal[localState];
+                    if (localState < slice.numberOfSccStates) {
+                        FlexibleRowType& localRow = slice.matrix.getRow(localState);
+                        for (auto const& entry : matrix.getRow(globalState)) {
+                            localRow.emplace_back(globalToLocal.at(entry.getColumn()), entry.getValue());
+                        }
+                        std::sort(localRow.begin(), localRow.end(), columnLess);
+                        if (!sccEntryStates[index].get(globalState)) {
+                            localStatesToEliminate.set(localState);
+                        }
+                    }
+                    
+                    // As the states of the SCC are mapped in ascending order, the backward rows stay sorted.
+                    FlexibleRowType& localBackwardRow = slice.backwardTransitions.getRow(localState);
+                    for (auto const& entry : backwardTransitions.getRow(globalState)) {
+                        if (scc.get(entry.getColumn())) {
+                            localBackwardRow.emplace_back(globalToLocal.at(entry.getColumn()), entry.getValue());
+                        }
+                    }
+                    
+                    slice.values.push_back(values[globalState]);
+                    localInitialStates.set(localState, initialStates.get(globalState));
+                    if (distanceBasedPriorities) {
+                        localDistanceBasedPriorities.get()[localState] = distanceBasedPriorities.get()[globalState];
+                    }
+                }
+                
+                std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(localDistanceBasedPriorities, slice.matrix, slice.backwardTransitions, slice.values, localStatesToEliminate);
+                performPrioritizedStateElimination(statePriorities, slice.matrix, slice.backwardTransitions, slice.values, localInitialStates, computeResultsForInitialStatesOnly);
+            };
+            
+            std::vector<uint64_t> prefixSizes(sccs.size() + 1, 0);
+            for (uint64_t index = 0; index < sccs.size(); ++index) {
+                prefixSizes[index + 1] = prefixSizes[index] + sccs[index].getNumberOfSetBits();
+            }
+            if (storm::utility::ThreadPool::supportsParallelComputations<ValueType>()) {
+                // Eliminating even a small SCC is expensive, so we do not require a minimal weight of the ranges.
+                storm::utility::ThreadPool::getGlobalPool().parallelFor(sccs.size(), [&prefixSizes] (uint64_t index) { return prefixSizes[index]; }, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        eliminateScc(index);
+                    }
+                }, 1);
+            } else {
+                // The arithmetic of exact and parametric values is not thread-safe, so the slices are treated one by one.
+                for (uint64_t index = 0; index < sccs.size(); ++index) {
+                    eliminateScc(index);
+                }
+            }
+            
+            // Finally, write the slices back in the order of the SCCs.
+            for (uint64_t index = 0; index < sccs.size(); ++index) {
+                storm::storage::BitVector const& scc = sccs[index];
+                SccSlice& slice = slices[index];
+                for (uint_fast64_t localState = 0; localState < slice.localToGlobal.size(); ++localState) {
+                    storm::storage::sparse::state_type globalState = slice.localToGlobal[localState];
+                    if (localState < slice.numberOfSccStates) {
+                        FlexibleRowType& globalRow = matrix.getRow(globalState);
+                        globalRow.clear();
+                        for (auto& entry : slice.matrix.getRow(localState)) {
+                            globalRow.emplace_back(slice.localToGlobal[entry.getColumn()], std::move(entry.getValue()));
+                        }
+                        std::sort(globalRow.begin(), globalRow.end(), columnLess);
+                        values[globalState] = std::move(slice.values[localState]);
+                    }
+                    
+                    // Replace the backward entries of the SCC by the ones of the slice.
+                    FlexibleRowType& globalBackwardRow = backwardTransitions.getRow(globalState);
+                    FlexibleRowType newBackwardRow;
+                    newBackwardRow.reserve(globalBackwardRow.size() + slice.backwardTransitions.getRow(localState).size());
+                    auto globalIt = globalBackwardRow.begin();
+                    for (auto& entry : slice.backwardTransitions.getRow(localState)) {
+                        storm::storage::sparse::state_type predecessor = slice.localToGlobal[entry.getColumn()];
+                        for (; globalIt != globalBackwardRow.end() && globalIt->getColumn() < predecessor; ++globalIt) {
+                            if (!scc.get(globalIt->getColumn())) {
+                                newBackwardRow.push_back(std::move(*globalIt));
+                            }
+                        }
+                        newBackwardRow.emplace_back(predecessor, std::move(entry.getValue()));
+                    }
+                    for (; globalIt != globalBackwardRow.end(); ++globalIt) {
+                        if (!scc.get(globalIt->getColumn())) {
+                            newBackwardRow.push_back(std::move(*globalIt));
+                        }
+                    }
+                    globalBackwardRow = std::move(newBackwardRow);
+                }
+                
+                // Release the memory of the slice.
+                slice = SccSlice();
+            }
+        }
+        
         template<typename SparseDtmcModelType>
         bool SparseDtmcEliminationModelChecker<SparseDtmcModelType>::checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions) {
             for (uint_fast64_t forwardIndex = 0; forwardIndex < transitionMatrix.getRowCount(); ++forwardIndex) {
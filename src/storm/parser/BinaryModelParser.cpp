@@ -0,0 +1,238 @@
+#include "storm/parser/BinaryModelParser.h"
+
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "storm/parser/MappedFile.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Ctmc.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+#include "storm/utility/BinaryModelFormat.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace {
+            /*!
+             * Reads words and arrays from a region of memory whose parts are aligned to eight bytes.
+             */
+            class BinaryReader {
+            public:
+                BinaryReader(char const* data, char const* dataEnd) : position(data), dataEnd(dataEnd) {
+                    // Intentionally left empty.
+                }
+
+                uint64_t readWord() {
+                    return *readArray<uint64_t>(1);
+                }
+
+                /*!
+                 * Retrieves a pointer to the next elements (without copying them) and skips them.
+                 */
+                template<typename T>
+                T const* readArray(uint64_t count) {
+                    static_assert(sizeof(T) == sizeof(uint64_t), "Only arrays of 64-bit words can be read.");
+                    STORM_LOG_THROW(count <= getRemainingBytes() / sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of binary model.");
+                    T const* result = reinterpret_cast<T const*>(position);
+                    position += count * sizeof(T);
+                    return result;
+                }
+
+                std::string readString(uint64_t length) {
+                    STORM_LOG_THROW(length <= getRemainingBytes() && storm::utility::binaryformat::padToWord(length) <= getRemainingBytes(), storm::exceptions::WrongFormatException, "Unexpected end of binary model.");
+                    std::string result(position, length);
+                    position += storm::utility::binaryformat::padToWord(length);
+                    return result;
+                }
+
+                /*!
+                 * Retrieves a reader for the next bytes and skips them (including the padding).
+                 */
+                BinaryReader readSection(uint64_t length) {
+                    STORM_LOG_THROW(length <= getRemainingBytes() && storm::utility::binaryformat::padToWord(length) <= getRemainingBytes(), storm::exceptions::WrongFormatException, "Unexpected end of binary model.");
+                    BinaryReader result(position, position + length);
+                    position += storm::utility::binaryformat::padToWord(length);
+                    return result;
+                }
+
+                bool isAtEnd() const {
+                    return position == dataEnd;
+                }
+
+            private:
+                uint64_t getRemainingBytes() const {
+                    return dataEnd - position;
+                }
+
+                char const* position;
+                char const* dataEnd;
+            };
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> readMatrix(BinaryReader& reader) {
+                typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+
+                uint64_t rowCount = reader.readWord();
+                uint64_t columnCount = reader.readWord();
+                uint64_t entryCount = reader.readWord();
+                uint64_t rowGroupCount = reader.readWord();
+                STORM_LOG_THROW(rowCount < std::numeric_limits<uint64_t>::max() && rowGroupCount < std::numeric_limits<uint64_t>::max(), storm::exceptions::WrongFormatException, "Illegal matrix dimensions.");
+
+                uint64_t const* rowIndicationsBegin = reader.readArray<uint64_t>(rowCount + 1);
+                uint64_t const* columns = reader.readArray<uint64_t>(entryCount);
+                ValueType const* values = reader.readArray<ValueType>(entryCount);
+                STORM_LOG_THROW(rowIndicationsBegin[0] == 0 && rowIndicationsBegin[rowCount] == entryCount, storm::exceptions::WrongFormatException, "Row indications do not match the number of entries.");
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    STORM_LOG_THROW(rowIndicationsBegin[row] <= rowIndicationsBegin[row + 1], storm::exceptions::WrongFormatException, "Row indications are not sorted.");
+                }
+                std::vector<index_type> rowIndications(rowIndicationsBegin, rowIndicationsBegin + rowCount + 1);
+
+                std::vector<storm::storage::MatrixEntry<index_type, ValueType>> columnsAndValues;
+                columnsAndValues.reserve(entryCount);
+                for (uint64_t entry = 0; entry < entryCount; ++entry) {
+                    STORM_LOG_THROW(columns[entry] < columnCount, storm::exceptions::WrongFormatException, "Column " << columns[entry] << " is out of range.");
+                    columnsAndValues.emplace_back(columns[entry], values[entry]);
+                }
+
+                boost::optional<std::vector<index_type>> rowGroupIndices;
+                if (rowGroupCount > 0) {
+                    uint64_t const* rowGroupIndicesBegin = reader.readArray<uint64_t>(rowGroupCount + 1);
+                    STORM_LOG_THROW(rowGroupIndicesBegin[0] == 0 && rowGroupIndicesBegin[rowGroupCount] == rowCount, storm::exceptions::WrongFormatException, "Row groups do not match the number of rows.");
+                    for (uint64_t group = 0; group < rowGroupCount; ++group) {
+                        STORM_LOG_THROW(rowGroupIndicesBegin[group] <= rowGroupIndicesBegin[group + 1], storm::exceptions::WrongFormatException, "Row groups are not sorted.");
+                    }
+                    rowGroupIndices = std::vector<index_type>(rowGroupIndicesBegin, rowGroupIndicesBegin + rowGroupCount + 1);
+                }
+
+                return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> readVector(BinaryReader& reader, uint64_t size) {
+                ValueType const* values = reader.readArray<ValueType>(size);
+                return std::vector<ValueType>(values, values + size);
+            }
+
+            storm::storage::BitVector readBitVector(BinaryReader& reader, uint64_t size) {
+                uint64_t const* buckets = reader.readArray<uint64_t>((size + 63) / 64);
+                storm::storage::BitVector result(size);
+                uint64_t index = 0;
+                for (; index + 64 <= size; index += 64, ++buckets) {
+                    result.setFromInt(index, 64, *buckets);
+                }
+                if (index < size) {
+                    uint64_t numberOfBits = size - index;
+                    result.setFromInt(index, numberOfBits, *buckets & ((1ull << numberOfBits) - 1));
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            struct RewardModelComponents {
+                boost::optional<std::vector<ValueType>> stateRewards;
+                boost::optional<std::vector<ValueType>> stateActionRewards;
+                boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+            };
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryModelParser<ValueType, RewardModelType>::parseModel(std::string const& filename) {
+            STORM_LOG_INFO("Reading from file " << filename);
+            MappedFile file(filename.c_str());
+            return parseModelFromBuffer(file.getData(), file.getDataSize());
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryModelParser<ValueType, RewardModelType>::parseModelFromBuffer(char const* data, std::size_t size) {
+            STORM_LOG_THROW(reinterpret_cast<std::uintptr_t>(data) % sizeof(uint64_t) == 0, storm::exceptions::WrongFormatException, "Binary model is not properly aligned.");
+            BinaryReader reader(data, data + size);
+
+            // Parse and check the header.
+            STORM_LOG_THROW(size >= sizeof(storm::utility::binaryformat::MAGIC) && std::memcmp(data, storm::utility::binaryformat::MAGIC, sizeof(storm::utility::binaryformat::MAGIC)) == 0, storm::exceptions::WrongFormatException, "The file is not a binary model.");
+            reader.readWord();
+            uint64_t version = reader.readWord();
+            STORM_LOG_THROW(version == storm::utility::binaryformat::VERSION, storm::exceptions::WrongFormatException, "Binary models of version " << version << " are not supported (expected version " << storm::utility::binaryformat::VERSION << ").");
+            STORM_LOG_THROW(reader.readWord() == storm::utility::binaryformat::BYTE_ORDER_MARK, storm::exceptions::WrongFormatException, "The binary model was written on a machine with a different byte order.");
+            STORM_LOG_THROW(reader.readWord() == sizeof(ValueType), storm::exceptions::WrongFormatException, "The values of the binary model do not match the value type.");
+            uint64_t typeIndex = reader.readWord();
+            STORM_LOG_THROW(typeIndex <= static_cast<uint64_t>(storm::models::ModelType::MarkovAutomaton), storm::exceptions::WrongFormatException, "Unknown model type.");
+            storm::models::ModelType type = static_cast<storm::models::ModelType>(typeIndex);
+            uint64_t numberOfStates = reader.readWord();
+            uint64_t numberOfChoices = reader.readWord();
+            uint64_t numberOfSections = reader.readWord();
+            STORM_LOG_TRACE("Binary model of type " << type << " with " << numberOfStates << " states, " << numberOfChoices << " choices and " << numberOfSections << " sections.");
+
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents;
+            modelComponents.stateLabeling = storm::models::sparse::StateLabeling(numberOfStates);
+            modelComponents.rateTransitions = type == storm::models::ModelType::Ctmc;
+            std::unordered_map<std::string, RewardModelComponents<ValueType>> rewardModels;
+            bool sawTransitionMatrix = false;
+
+            using storm::utility::binaryformat::SectionType;
+            for (uint64_t section = 0; section < numberOfSections; ++section) {
+                SectionType sectionType = static_cast<SectionType>(reader.readWord());
+                uint64_t nameLength = reader.readWord();
+                uint64_t payloadLength = reader.readWord();
+                std::string name = reader.readString(nameLength);
+                BinaryReader payload = reader.readSection(payloadLength);
+
+                switch (sectionType) {
+                    case SectionType::TransitionMatrix:
+                        modelComponents.transitionMatrix = readMatrix<ValueType>(payload);
+                        sawTransitionMatrix = true;
+                        break;
+                    case SectionType::StateLabel:
+                        modelComponents.stateLabeling.addLabel(name, readBitVector(payload, numberOfStates));
+                        break;
+                    case SectionType::ChoiceLabel:
+                        if (!modelComponents.choiceLabeling) {
+                            modelComponents.choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfChoices);
+                        }
+                        modelComponents.choiceLabeling.get().addLabel(name, readBitVector(payload, numberOfChoices));
+                        break;
+                    case SectionType::StateRewards:
+                        rewardModels[name].stateRewards = readVector<ValueType>(payload, numberOfStates);
+                        break;
+                    case SectionType::StateActionRewards:
+                        rewardModels[name].stateActionRewards = readVector<ValueType>(payload, numberOfChoices);
+                        break;
+                    case SectionType::TransitionRewards:
+                        rewardModels[name].transitionRewards = readMatrix<ValueType>(payload);
+                        break;
+                    case SectionType::ExitRates:
+                        modelComponents.exitRates = readVector<ValueType>(payload, numberOfStates);
+                        break;
+                    case SectionType::MarkovianStates:
+                        modelComponents.markovianStates = readBitVector(payload, numberOfStates);
+                        break;
+                    default:
+                        STORM_LOG_WARN("Skipping section of unknown type " << static_cast<uint64_t>(sectionType) << ".");
+                        continue;
+                }
+                STORM_LOG_THROW(payload.isAtEnd(), storm::exceptions::WrongFormatException, "Section '" << name << "' has an unexpected size.");
+            }
+            STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of the binary model.");
+
+            STORM_LOG_THROW(sawTransitionMatrix, storm::exceptions::WrongFormatException, "The binary model does not contain a transition matrix.");
+            STORM_LOG_THROW(modelComponents.transitionMatrix.getRowCount() == numberOfChoices && modelComponents.transitionMatrix.getColumnCount() == numberOfStates && modelComponents.transitionMatrix.getRowGroupCount() == numberOfStates, storm::exceptions::WrongFormatException, "The dimensions of the transition matrix do not match the model.");
+            STORM_LOG_THROW(type != storm::models::ModelType::MarkovAutomaton || (modelComponents.markovianStates && modelComponents.exitRates), storm::exceptions::WrongFormatException, "Markov automata require Markovian states and exit rates.");
+
+            for (auto& rewardModel : rewardModels) {
+                modelComponents.rewardModels.emplace(rewardModel.first, RewardModelType(std::move(rewardModel.second.stateRewards), std::move(rewardModel.second.stateActionRewards), std::move(rewardModel.second.transitionRewards)));
+            }
+
+            return storm::utility::builder::buildModelFromComponents(type, std::move(modelComponents));
+        }
+
+        // Only models over floating point numbers have a fixed-size binary representation.
+        template class BinaryModelParser<double>;
+
+    } // namespace parser
+} // namespace storm
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * Parser for models in the binary model format (see BinaryModelFormat.h). The file is mapped into memory and
+         * the arrays of the model are copied directly from the mapping, so no values need to be parsed.
+         */
+        template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+        class BinaryModelParser {
+        public:
+
+            /*!
+             * Loads a model in the binary format from a file.
+             *
+             * @param filename The file to be loaded.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& filename);
+
+            /*!
+             * Loads a model in the binary format from the given memory region.
+             *
+             * @param data The beginning of the region. It has to be aligned to eight bytes.
+             * @param size The size of the region in bytes.
+             *
+             * @return A sparse model
+             */
+            static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModelFromBuffer(char const* data, std::size_t size);
+        };
+
+    } // namespace parser
+} // namespace storm
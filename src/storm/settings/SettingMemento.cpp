@@ -1,17 +1,36 @@
 #include "storm/settings/SettingMemento.h"
 
 #include "storm/settings/modules/ModuleSettings.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/ArgumentBase.h"
 
 namespace storm {
     namespace settings {
         SettingMemento::SettingMemento(modules::ModuleSettings& settings, std::string const& longOptionName, bool resetToState) : settings(settings), optionName(longOptionName), resetToState(resetToState) {
-            // Intentionally left empty.
+            Option const& option = settings.getOption(optionName);
+            for (uint_fast64_t argumentIndex = 0; argumentIndex < option.getArgumentCount(); ++argumentIndex) {
+                ArgumentBase const& argument = option.getArgument(argumentIndex);
+                if (argument.getHasBeenSet()) {
+                    argumentValues.push_back(argument.getValueAsString());
+                } else {
+                    argumentValues.push_back(boost::none);
+                }
+            }
         }
         
         /*!
          * Destructs the memento object and resets the value of the option to its original state.
          */
         SettingMemento::~SettingMemento() {
+            Option& option = settings.getOption(optionName);
+            for (uint_fast64_t argumentIndex = 0; argumentIndex < argumentValues.size(); ++argumentIndex) {
+                ArgumentBase& argument = option.getArgument(argumentIndex);
+                if (argumentValues[argumentIndex]) {
+                    argument.setFromStringValue(argumentValues[argumentIndex].get());
+                } else if (argument.getHasDefaultValue()) {
+                    argument.setFromDefaultValue();
+                }
+            }
             if (resetToState) {
                 settings.set(optionName);
             } else {
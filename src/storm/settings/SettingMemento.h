@@ -3,6 +3,9 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
 
 
 namespace storm {
@@ -14,7 +17,8 @@ namespace storm {
         }
         
         /*!
-         * This class is used to reset the state of an option that was temporarily set to a different status.
+         * This class is used to reset the state of an option that was temporarily set to a different status. The values
+         * of the option's arguments are reset as well, so they may also be changed temporarily.
          */
         class SettingMemento {
 		public:
@@ -42,6 +46,10 @@ namespace storm {
             
             // The state of the option before it was set.
 			bool resetToState;
+            
+            // The values of the option's arguments at the time the memento was created. Arguments that were not set
+            // at that time have no value.
+            std::vector<boost::optional<std::string>> argumentValues;
         };
         
     } // namespace settings
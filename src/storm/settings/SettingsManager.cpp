@@ -330,6 +330,10 @@ namespace storm {
             return *moduleIterator->second;
         }
         
+        bool SettingsManager::hasModule(std::string const& moduleName) const {
+            return this->modules.find(moduleName) != this->modules.end();
+        }
+        
         bool SettingsManager::isCompatible(std::shared_ptr<Option> const& option, std::string const& optionName, std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> const& optionMap) {
             auto optionIterator = optionMap.find(optionName);
             if (optionIterator != optionMap.end()) {
@@ -505,6 +509,22 @@ namespace storm {
             return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
         }
         
+        storm::settings::modules::JitBuilderSettings& mutableJitBuilderSettings() {
+            return dynamic_cast<storm::settings::modules::JitBuilderSettings&>(mutableManager().getModule(storm::settings::modules::JitBuilderSettings::moduleName));
+        }
+        
+        storm::settings::modules::EliminationSettings& mutableEliminationSettings() {
+            return dynamic_cast<storm::settings::modules::EliminationSettings&>(mutableManager().getModule(storm::settings::modules::EliminationSettings::moduleName));
+        }
+        
+        storm::settings::modules::MinMaxEquationSolverSettings& mutableMinMaxEquationSolverSettings() {
+            return dynamic_cast<storm::settings::modules::MinMaxEquationSolverSettings&>(mutableManager().getModule(storm::settings::modules::MinMaxEquationSolverSettings::moduleName));
+        }
+        
+        storm::settings::modules::MultiObjectiveSettings& mutableMultiObjectiveSettings() {
+            return dynamic_cast<storm::settings::modules::MultiObjectiveSettings&>(mutableManager().getModule(storm::settings::modules::MultiObjectiveSettings::moduleName));
+        }
+        
         void initializeAll(std::string const& name, std::string const& executableName) {
             storm::settings::mutableManager().setName(name, executableName);
 
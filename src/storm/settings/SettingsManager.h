@@ -16,6 +16,10 @@ namespace storm {
             class IOSettings;
             class ModuleSettings;
             class AbstractionSettings;
+            class JitBuilderSettings;
+            class EliminationSettings;
+            class MinMaxEquationSolverSettings;
+            class MultiObjectiveSettings;
         }
         class Option;
         
@@ -119,6 +123,14 @@ namespace storm {
              */
             modules::ModuleSettings& getModule(std::string const& moduleName);
             
+            /*!
+             * Checks whether a module with the given name has been registered.
+             *
+             * @param moduleName The name of the module.
+             * @return True iff the module is known to the manager.
+             */
+            bool hasModule(std::string const& moduleName) const;
+            
         private:
 			/*!
 			 * Constructs a new manager. This constructor is private to forbid instantiation of this class. The only
@@ -261,6 +273,17 @@ namespace storm {
             return dynamic_cast<SettingsType const&>(manager().getModule(SettingsType::moduleName));
         }
         
+        /*!
+         * Checks whether the module given as template argument has been registered.
+         *
+         * @return True iff the module is available.
+         */
+        template<typename SettingsType>
+        bool hasModule() {
+            static_assert(std::is_base_of<storm::settings::modules::ModuleSettings, SettingsType>::value, "Template argument must be derived from ModuleSettings");
+            return manager().hasModule(SettingsType::moduleName);
+        }
+        
         /*!
          * Retrieves the core settings in a mutable form. This is only meant to be used for debug purposes or very
          * rare cases where it is necessary.
@@ -285,6 +308,38 @@ namespace storm {
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
         
+        /*!
+         * Retrieves the JIT builder settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the JIT builder settings.
+         */
+        storm::settings::modules::JitBuilderSettings& mutableJitBuilderSettings();
+        
+        /*!
+         * Retrieves the elimination settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the elimination settings.
+         */
+        storm::settings::modules::EliminationSettings& mutableEliminationSettings();
+        
+        /*!
+         * Retrieves the min/max equation solver settings in a mutable form. This is only meant to be used for debug
+         * purposes or very rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the min/max equation solver settings.
+         */
+        storm::settings::modules::MinMaxEquationSolverSettings& mutableMinMaxEquationSolverSettings();
+        
+        /*!
+         * Retrieves the multi-objective settings in a mutable form. This is only meant to be used for debug purposes or
+         * very rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the multi-objective settings.
+         */
+        storm::settings::modules::MultiObjectiveSettings& mutableMultiObjectiveSettings();
+        
     } // namespace settings
 } // namespace storm
 
@@ -104,7 +104,7 @@ namespace storm {
             }
             
             AbstractionSettings::ReuseMode AbstractionSettings::getReuseMode() const {
-                std::string reuseModeAsString = this->getOption(splitModeOptionName).getArgumentByName("mode").getValueAsString();
+                std::string reuseModeAsString = this->getOption(reuseResultsOptionName).getArgumentByName("mode").getValueAsString();
                 if (reuseModeAsString == "all") {
                     return ReuseMode::All;
                 } else if (reuseModeAsString == "none") {
@@ -117,6 +117,18 @@ namespace storm {
                 return ReuseMode::All;
             }
             
+            void AbstractionSettings::setReuseMode(ReuseMode const& mode) {
+                std::string reuseModeAsString = "all";
+                if (mode == ReuseMode::None) {
+                    reuseModeAsString = "none";
+                } else if (mode == ReuseMode::Qualitative) {
+                    reuseModeAsString = "qualitative";
+                } else if (mode == ReuseMode::Quantitative) {
+                    reuseModeAsString = "quantitative";
+                }
+                this->getOption(reuseResultsOptionName).getArgumentByName("mode").setFromStringValue(reuseModeAsString);
+            }
+            
         }
     }
 }
@@ -84,6 +84,13 @@ namespace storm {
                  */
                 ReuseMode getReuseMode() const;
                 
+                /*!
+                 * Sets the reuse mode to the given value.
+                 *
+                 * @param mode The new reuse mode.
+                 */
+                void setReuseMode(ReuseMode const& mode);
+                
                 const static std::string moduleName;
                 
             private:
@@ -17,6 +17,7 @@ namespace storm {
             const std::string BisimulationSettings::representativeOptionName = "repr";
             const std::string BisimulationSettings::quotientFormatOptionName = "quot";
             const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
+            const std::string BisimulationSettings::refinementOptionName = "refinement";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
@@ -29,6 +30,9 @@ namespace storm {
 
                 std::vector<std::string> signatureModes = { "eager", "lazy" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, signatureModeOptionName, false, "Sets the signature computation mode.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(signatureModes)).setDefaultValueString("eager").build()).build());
+                
+                std::vector<std::string> refinementMethods = { "splitter", "signature" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementOptionName, false, "Sets how the partition is refined (only applies to sparse bisimulation).").addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "The refinement method to use. 'signature' computes the signatures of all states in parallel and only supports strong bisimulation.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementMethods)).setDefaultValueString("splitter").build()).build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -67,6 +71,10 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unknown signature mode '" << modeAsString << ".");
             }
             
+            bool BisimulationSettings::isSignatureRefinementSet() const {
+                return this->getOption(refinementOptionName).getArgumentByName("method").getValueAsString() == "signature";
+            }
+            
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
@@ -55,6 +55,13 @@ namespace storm {
                  */
                 storm::dd::bisimulation::SignatureMode getSignatureMode() const;
                 
+                /*!
+                 * Retrieves whether the partition is to be refined by computing the signatures of all states in
+                 * parallel rather than by processing splitters.
+                 * NOTE: only applies to sparse bisimulation.
+                 */
+                bool isSignatureRefinementSet() const;
+                
                 virtual bool check() const override;
                 
                 // The name of the module.
@@ -66,6 +73,7 @@ namespace storm {
                 static const std::string representativeOptionName;
                 static const std::string quotientFormatOptionName;
                 static const std::string signatureModeOptionName;
+                static const std::string refinementOptionName;
             };
         } // namespace modules
     } // namespace settings
@@ -29,6 +29,14 @@ namespace storm {
             const std::string fullModelBuildOptionName = "buildfull";
             const std::string buildChoiceLabelOptionName = "buildchoicelab";
             const std::string buildStateValuationsOptionName = "buildstateval";
+            const std::string compactMatrixOptionName = "compactmatrix";
+            const std::string simdOptionName = "simd";
+            const std::string parallelExplorationOptionName = "parallelexpl";
+            const std::string treeCompressionOptionName = "treecompression";
+            const std::string compileExpressionsOptionName = "compileexpr";
+            const std::string ddVariableOrderImportOptionName = "ddorder-import";
+            const std::string ddVariableOrderExportOptionName = "ddorder-export";
+            const std::string ddReorderingOptionName = "ddreorder";
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
@@ -38,6 +46,18 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildChoiceLabelOptionName, false, "If set, also build the choice labels").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildStateValuationsOptionName, false, "If set, also build the state valuations").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, noBuildOptionName, false, "If set, do not build the model.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compactMatrixOptionName, false, "If set, the matrices that the native solvers only multiply with are stored in a compact layout with separate column and value arrays (and 32-bit column indices, if possible), which needs less memory than the standard layout.").build());
+                std::vector<std::string> simdLevels = {"auto", "avx512", "avx2", "none"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, simdOptionName, false, "Sets the vector instruction set extension the kernels of the compact matrix layout may use (only effective together with --" + compactMatrixOptionName + "). The vectorized kernels may produce results that differ from the scalar ones in the last bits (for example if the binary was compiled with -ffast-math); 'none' enforces the scalar kernels.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("level", "The name of the extension ('auto' selects the best one supported by the CPU).").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(simdLevels)).setDefaultValueString("auto").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExplorationOptionName, false, "If set, the explicit model builder explores the state space with the number of threads selected in the core settings (requires breadth-first exploration). The resulting model is identical to the one of the sequential exploration.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compileExpressionsOptionName, false, "If set, the explicit model builder compiles the guards and updates of PRISM programs to programs that are evaluated directly on the explored states instead of interpreting them.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderImportOptionName, false, "If set, the symbolic model builders create the meta variables of the state variables in the order given in the file (e.g. one exported by an earlier run). This works for all DD libraries.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file from which to read the order.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderExportOptionName, false, "If set, the order of the meta variables of the symbolic model (after reordering, if enabled) is written to the given file.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which to write the order.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddReorderingOptionName, false, "If set, the DD variables of the symbolic model are reordered once after building it, using the (sifting-based) technique selected for the DD library. Only supported by CUDD.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, treeCompressionOptionName, false, "If set, the explicit model builder stores the explored states in a tree-compressed table that splits them into the variables of the individual modules. This reduces the memory needed for models with many states.").build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName)
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
@@ -75,6 +95,38 @@ namespace storm {
             }
 
 
+            bool BuildSettings::check() const {
+                // The standard layout is always multiplied with the scalar kernels.
+                STORM_LOG_WARN_COND(!this->getOption(simdOptionName).getHasOptionBeenSet() || isCompactMatrixLayoutSet(), "The vector instruction set extension (--" << simdOptionName << ") is ignored, because it only applies to the compact matrix layout (--" << compactMatrixOptionName << ").");
+                return true;
+            }
+
+            bool BuildSettings::isCompactMatrixLayoutSet() const {
+                return this->getOption(compactMatrixOptionName).getHasOptionBeenSet();
+            }
+
+            storm::storage::kernels::SimdLevel BuildSettings::getSimdLevel() const {
+                std::string levelAsString = this->getOption(simdOptionName).getArgumentByName("level").getValueAsString();
+                if (levelAsString == "auto") {
+                    return storm::storage::kernels::getSupportedSimdLevel();
+                } else if (levelAsString == "avx512") {
+                    return storm::storage::kernels::SimdLevel::Avx512;
+                } else if (levelAsString == "avx2") {
+                    return storm::storage::kernels::SimdLevel::Avx2;
+                } else if (levelAsString == "none") {
+                    return storm::storage::kernels::SimdLevel::None;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown vector instruction set extension '" << levelAsString << "'.");
+            }
+
+            bool BuildSettings::isParallelExplorationSet() const {
+                return this->getOption(parallelExplorationOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isTreeCompressedStateStorageSet() const {
+                return this->getOption(treeCompressionOptionName).getHasOptionBeenSet();
+            }
+
             storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
                 std::string explorationOrderAsString = this->getOption(explorationOrderOptionName).getArgumentByName("name").getValueAsString();
                 if (explorationOrderAsString == "dfs") {
@@ -88,6 +140,30 @@ namespace storm {
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
+
+            bool BuildSettings::isCompileExpressionsSet() const {
+                return this->getOption(compileExpressionsOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isDdVariableOrderImportSet() const {
+                return this->getOption(ddVariableOrderImportOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getDdVariableOrderImportFilename() const {
+                return this->getOption(ddVariableOrderImportOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool BuildSettings::isDdVariableOrderExportSet() const {
+                return this->getOption(ddVariableOrderExportOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getDdVariableOrderExportFilename() const {
+                return this->getOption(ddVariableOrderExportOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool BuildSettings::isDdReorderingSet() const {
+                return this->getOption(ddReorderingOptionName).getHasOptionBeenSet();
+            }
         }
 
 
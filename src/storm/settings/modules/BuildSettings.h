@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
 
 namespace storm {
     namespace settings {
@@ -37,6 +38,14 @@ namespace storm {
                  */
                 bool isExplorationChecksSet() const;
 
+                /*!
+                 * Retrieves whether the guards and updates are to be compiled to programs that are evaluated directly
+                 * on the compressed states.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isCompileExpressionsSet() const;
+
                 /*!
                  * Retrieves the exploration order if it was set.
                  *
@@ -75,6 +84,73 @@ namespace storm {
                  */
                 bool isBuildStateValuationsSet() const;
 
+                /*!
+                 * Retrieves whether the matrices are to be used in the compact (structure-of-arrays) layout.
+                 *
+                 * @return True iff the compact matrix layout is to be used.
+                 */
+                bool isCompactMatrixLayoutSet() const;
+
+                /*!
+                 * Retrieves the vector instruction set extension the kernels of the compact matrix layout may use.
+                 * The level is capped at the one supported by the CPU when the layout is created. Matrices in the
+                 * standard layout are always multiplied with the scalar kernels, so the level only takes effect if
+                 * the compact layout is used (see isCompactMatrixLayoutSet).
+                 *
+                 * @return The selected extension.
+                 */
+                storm::storage::kernels::SimdLevel getSimdLevel() const;
+
+                /*!
+                 * Retrieves whether the explicit state space exploration is to be performed in parallel.
+                 *
+                 * @return True iff the exploration is to be performed in parallel.
+                 */
+                bool isParallelExplorationSet() const;
+
+                /*!
+                 * Retrieves whether the explored states are to be stored in a tree-compressed table.
+                 *
+                 * @return True iff the states are to be stored in a tree-compressed table.
+                 */
+                bool isTreeCompressedStateStorageSet() const;
+
+                /*!
+                 * Retrieves whether an order of the DD meta variables is to be imported for building symbolic models.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdVariableOrderImportSet() const;
+
+                /*!
+                 * Retrieves the name of the file from which the order of the DD meta variables is to be imported.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getDdVariableOrderImportFilename() const;
+
+                /*!
+                 * Retrieves whether the order of the DD meta variables of symbolic models is to be exported.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdVariableOrderExportSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the order of the DD meta variables is to be exported.
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getDdVariableOrderExportFilename() const;
+
+                /*!
+                 * Retrieves whether the DD variables of symbolic models are to be reordered after building them.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdReorderingSet() const;
+
+                bool check() const override;
 
                 // The name of the module.
                 static const std::string moduleName;
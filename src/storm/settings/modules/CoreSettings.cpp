@@ -1,5 +1,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 
+#include <thread>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -34,6 +36,7 @@ namespace storm {
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+            const std::string CoreSettings::threadCountOptionName = "threads";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(CoreSettings::Engine::Sparse) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false, "Generates a counterexample for the given PRCTL formulas if not satisfied by the model.").setShortName(counterexampleOptionShortName).build());
@@ -62,6 +65,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, false, "Sets the number of threads used by the parallelized parts of the sparse engine.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             bool CoreSettings::isCounterexampleSet() const {
@@ -141,6 +146,34 @@ namespace storm {
                 return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
             }
 
+            bool CoreSettings::isThreadCountSet() const {
+                return this->getOption(threadCountOptionName).getHasOptionBeenSet();
+            }
+
+            uint_fast64_t CoreSettings::getThreadCount() const {
+                uint_fast64_t threadCount = 1;
+                if (isThreadCountSet()) {
+                    threadCount = this->getOption(threadCountOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+                } else if (isUseIntelTbbSet()) {
+                    threadCount = 0;
+                }
+                if (threadCount == 0) {
+                    threadCount = std::max<uint_fast64_t>(1, std::thread::hardware_concurrency());
+                }
+                return threadCount;
+            }
+
+            void CoreSettings::setThreadCount(uint_fast64_t count) {
+                this->getOption(threadCountOptionName).getArgumentByName("count").setFromStringValue(std::to_string(count));
+                this->set(threadCountOptionName);
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideThreadCount(uint_fast64_t count) {
+                std::unique_ptr<storm::settings::SettingMemento> memento = this->overrideOption(threadCountOptionName, true);
+                this->getOption(threadCountOptionName).getArgumentByName("count").setFromStringValue(std::to_string(count));
+                return memento;
+            }
+
             bool CoreSettings::isUseCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
@@ -175,7 +208,7 @@ namespace storm {
 #ifdef STORM_HAVE_INTELTBB
                 return true;
 #else
-                STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Enabling TBB is not supported in this version of Storm as it was not built with support for it.");
+                STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Storm was not built with support for TBB, using the built-in thread pool with all hardware threads instead.");
                 return true;
 #endif
             }
@@ -130,6 +130,38 @@ namespace storm {
                  */
                 bool isUseIntelTbbSet() const;
 
+                /*!
+                 * Retrieves whether the number of threads for the parallelized parts of the sparse engine was set.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isThreadCountSet() const;
+
+                /*!
+                 * Retrieves the number of threads to use for the parallelized parts of the sparse engine. If the
+                 * number was not set explicitly, one thread is used, unless the option to use Intel TBB was set, in
+                 * which case all hardware threads are used.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getThreadCount() const;
+
+                /*!
+                 * Sets the number of threads to use for the parallelized parts of the sparse engine.
+                 *
+                 * @param count The number of threads. If zero, all hardware threads are used.
+                 */
+                void setThreadCount(uint_fast64_t count);
+
+                /*!
+                 * Overrides the number of threads to use for the parallelized parts of the sparse engine. The previous
+                 * number is restored when the returned memento is destroyed.
+                 *
+                 * @param count The number of threads. If zero, all hardware threads are used.
+                 * @return A memento that restores the previous number of threads.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideThreadCount(uint_fast64_t count);
+
                 /*!
                  * Retrieves whether the option to use CUDA is set.
                  *
@@ -174,6 +206,7 @@ namespace storm {
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
                 static const std::string cudaOptionName;
+                static const std::string threadCountOptionName;
             };
 
         } // namespace modules
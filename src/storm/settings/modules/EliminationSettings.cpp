@@ -4,6 +4,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
+#include "storm/settings/SettingMemento.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
@@ -18,9 +19,10 @@ namespace storm {
             const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
             const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
             const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+            const std::string EliminationSettings::parallelSccEliminationOptionName = "parallel-scc";
             
             EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "amd"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the order in which states are chosen for elimination.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(orders)).setDefaultValueString("fwrev").build()).build());
                 
                 std::vector<std::string> methods = {"state", "hybrid"};
@@ -30,6 +32,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalSccSizeOptionName, true, "Sets the maximal size of the SCCs for which state elimination is applied.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("maxsize", "The maximal size of an SCC on which state elimination is applied.").setDefaultValueUnsignedInteger(20).setIsOptional(true).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useDedicatedModelCheckerOptionName, true, "Sets whether to use the dedicated model elimination checker (only DTMCs).").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelSccEliminationOptionName, true, "Sets whether the SCCs of one level are eliminated in parallel (only hybrid elimination). Exact and parametric models are always treated sequentially.").build());
             }
             
             EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -43,6 +46,12 @@ namespace storm {
                 }
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideEliminationMethod(EliminationMethod const& method) {
+                std::unique_ptr<storm::settings::SettingMemento> memento = this->overrideOption(eliminationMethodOptionName, true);
+                this->getOption(eliminationMethodOptionName).getArgumentByName("name").setFromStringValue(method == EliminationMethod::Hybrid ? "hybrid" : "state");
+                return memento;
+            }
+            
             EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder() const {
                 std::string eliminationOrderAsString = this->getOption(eliminationOrderOptionName).getArgumentByName("name").getValueAsString();
                 if (eliminationOrderAsString == "fw") {
@@ -61,6 +70,8 @@ namespace storm {
                     return EliminationOrder::DynamicPenalty;
                 } else if (eliminationOrderAsString == "regex") {
                     return EliminationOrder::RegularExpression;
+                } else if (eliminationOrderAsString == "amd") {
+                    return EliminationOrder::ApproximateMinimumDegree;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
                 }
@@ -77,6 +88,14 @@ namespace storm {
             bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
                 return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
             }
+            
+            bool EliminationSettings::isParallelSccEliminationSet() const {
+                return this->getOption(parallelSccEliminationOptionName).getHasOptionBeenSet();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideParallelSccEliminationSet(bool stateToSet) {
+                return this->overrideOption(parallelSccEliminationOptionName, stateToSet);
+            }
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -15,7 +15,7 @@ namespace storm {
                 /*!
                  * An enum that contains all available state elimination orders.
                  */
-                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression, ApproximateMinimumDegree };
 				
                 /*!
                  * An enum that contains all available elimination methods.
@@ -34,6 +34,15 @@ namespace storm {
                  */
                 EliminationMethod getEliminationMethod() const;
                 
+                /*!
+                 * Overrides the elimination method to use. The previous method is restored when the returned memento
+                 * is destroyed.
+                 *
+                 * @param method The elimination method to use.
+                 * @return A memento that restores the previous elimination method.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideEliminationMethod(EliminationMethod const& method);
+                
                 /*!
                  * Retrieves the selected elimination order.
                  *
@@ -61,6 +70,24 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isUseDedicatedModelCheckerSet() const;
+                
+                /*!
+                 * Retrieves whether the SCCs of one decomposition level are to be eliminated in parallel (only hybrid
+                 * elimination).
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isParallelSccEliminationSet() const;
+                
+                /*!
+                 * Overrides the option to eliminate the SCCs of one decomposition level in parallel by setting it to
+                 * the specified value. As soon as the returned memento goes out of scope, the original value is
+                 * restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideParallelSccEliminationSet(bool stateToSet);
 				
                 const static std::string moduleName;
                 
@@ -70,6 +97,7 @@ namespace storm {
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
+                const static std::string parallelSccEliminationOptionName;
             };
             
         } // namespace modules
@@ -63,6 +63,20 @@ namespace storm {
                  */
                 std::string getExportExplicitFilename() const;
                 
+                /*!
+                 * Retrieves whether the export-to-binary option was set.
+                 *
+                 * @return True if the export-to-binary option was set.
+                 */
+                bool isExportBinarySet() const;
+
+                /*!
+                 * Retrieves the name of the file in which to write the model in the binary format, if the option was set.
+                 *
+                 * @return The name of the file in which to write the exported model.
+                 */
+                std::string getExportBinaryFilename() const;
+
                 /*!
                  * Retrieves whether the explicit option was set.
                  *
@@ -100,6 +114,20 @@ namespace storm {
                  */
                 std::string getExplicitDRNFilename() const;
                 
+                /*!
+                 * Retrieves whether the option to load a model in the binary format was set.
+                 *
+                 * @return True if the binary option was set.
+                 */
+                bool isExplicitBinarySet() const;
+
+                /*!
+                 * Retrieves the name of the file that contains the model in the binary format.
+                 *
+                 * @return The name of the binary file that contains the model.
+                 */
+                std::string getExplicitBinaryFilename() const;
+
                 /*!
                  * Retrieves whether the explicit option with IMCA was set.
                  *
@@ -262,10 +290,12 @@ namespace storm {
                 static const std::string exportDotOptionName;
                 static const std::string exportJaniDotOptionName;
                 static const std::string exportExplicitOptionName;
+                static const std::string exportBinaryOptionName;
                 static const std::string explicitOptionName;
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
                 static const std::string explicitDrnOptionShortName;
+                static const std::string explicitBinaryOptionName;
                 static const std::string explicitImcaOptionName;
                 static const std::string explicitImcaOptionShortName;
                 static const std::string prismInputOptionName;
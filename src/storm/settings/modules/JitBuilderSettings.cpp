@@ -21,6 +21,8 @@ namespace storm {
             const std::string JitBuilderSettings::carlIncludeDirectoryOptionName = "carl";
             const std::string JitBuilderSettings::compilerFlagsOptionName = "cxxflags";
             const std::string JitBuilderSettings::optimizationLevelOptionName = "opt";
+            const std::string JitBuilderSettings::cacheOptionName = "cache";
+            const std::string JitBuilderSettings::cacheDirectoryOptionName = "cachedir";
 
             JitBuilderSettings::JitBuilderSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, doctorOptionName, false, "Show debugging information on why the jit-based model builder is not working on your system.").build());
@@ -36,6 +38,9 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("flags", "The compiler flags.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, optimizationLevelOptionName, false, "Sets the optimization level.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("level", "The level to use.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheOptionName, false, "If set, compiled builders are cached on disk and reused for the same model. Constants that do not influence the variable domains or initial states are then passed at runtime, so changing their values does not trigger a recompilation.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheDirectoryOptionName, false, "The directory in which compiled builders are cached. Defaults to a directory in the system's temporary directory.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The cache directory.").build()).build());
             }
             
             bool JitBuilderSettings::isCompilerSet() const {
@@ -86,6 +91,22 @@ namespace storm {
                 return this->getOption(optimizationLevelOptionName).getArgumentByName("level").getValueAsUnsignedInteger();
             }
             
+            bool JitBuilderSettings::isCacheSet() const {
+                return this->getOption(cacheOptionName).getHasOptionBeenSet();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> JitBuilderSettings::overrideCacheSet(bool stateToSet) {
+                return this->overrideOption(cacheOptionName, stateToSet);
+            }
+            
+            bool JitBuilderSettings::isCacheDirectorySet() const {
+                return this->getOption(cacheDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string JitBuilderSettings::getCacheDirectory() const {
+                return this->getOption(cacheDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+            
             void JitBuilderSettings::finalize() {
                 // Intentionally left empty.
             }
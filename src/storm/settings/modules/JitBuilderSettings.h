@@ -32,6 +32,20 @@ namespace storm {
                 
                 uint64_t getOptimizationLevel() const;
                 
+                bool isCacheSet() const;
+                
+                /*!
+                 * Overrides the option to cache compiled builders by setting it to the specified value. As soon as the
+                 * returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the cache option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideCacheSet(bool stateToSet);
+                
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+                
                 bool check() const override;
                 void finalize() override;
                 
@@ -45,6 +59,8 @@ namespace storm {
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
                 static const std::string optimizationLevelOptionName;
+                static const std::string cacheOptionName;
+                static const std::string cacheDirectoryOptionName;
             };
             
         }
@@ -90,6 +90,20 @@ namespace storm {
                  */
                 storm::solver::LraMethod getLraMethod() const;
                 
+                /*!
+                 * Retrieves the selected method for time-bounded reachability on Markov automata.
+                 *
+                 * @return The selected method.
+                 */
+                storm::solver::MaBoundedReachabilityMethod getMarkovAutomatonBoundedReachabilityMethod() const;
+                
+                /*!
+                 * Sets the method for time-bounded reachability on Markov automata.
+                 *
+                 * @param method The method to use.
+                 */
+                void setMarkovAutomatonBoundedReachabilityMethod(storm::solver::MaBoundedReachabilityMethod const& method);
+                
                 /*!
                  * Retrieves the multiplication style to use in the min-max methods.
                  *
@@ -107,6 +121,7 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string lraMethodOptionName;
+                static const std::string markovAutomatonBoundedReachabilityMethodOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
             };
             
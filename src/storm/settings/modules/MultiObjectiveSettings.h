@@ -57,6 +57,20 @@ namespace storm {
                  */
                 uint_fast64_t getMaxSteps() const;
                 
+                /*!
+                 * Retrieves the number of weight vectors that are checked concurrently in one refinement round of a pareto query.
+                 *
+                 * @return the number of weight vectors that are checked concurrently.
+                 */
+                uint_fast64_t getNumberOfParallelWeightVectors() const;
+                
+                /*!
+                 * Sets the number of weight vectors that are checked concurrently in one refinement round of a pareto query.
+                 *
+                 * @param count The number of weight vectors that are checked concurrently.
+                 */
+                void setNumberOfParallelWeightVectors(uint_fast64_t count);
+                
                 
                 /*!
                  * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
@@ -73,6 +87,7 @@ namespace storm {
 				const static std::string exportPlotOptionName;
 				const static std::string precisionOptionName;
 				const static std::string maxStepsOptionName;
+				const static std::string parallelWeightVectorsOptionName;
             };
             
         } // namespace modules
@@ -23,9 +23,10 @@ namespace storm {
             const std::string NativeEquationSolverSettings::precisionOptionName = "precision";
             const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
+            const std::string NativeEquationSolverSettings::sccTechniqueOptionName = "sccmethod";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "ratsearch" };
+                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "ratsearch", "topological" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The method to be used for solving linear equation systems with the native engine.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods)).setDefaultValueString("jacobi").build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false, "The maximal number of iterations to perform before iterative solving is aborted.").setShortName(maximalIterationsOptionShortName).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal iteration count.").setDefaultValueUnsignedInteger(20000).build()).build());
@@ -36,6 +37,9 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").build());
                 
+                std::vector<std::string> sccMethods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, sccTechniqueOptionName, true, "The method to be used for solving the equation systems of the individual SCCs if the topological method is selected. SCCs consisting of a single state are always solved directly.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sccMethods)).setDefaultValueString("gaussseidel").build()).build());
+                
                 std::vector<std::string> multiplicationStyles = {"gaussseidel", "regular", "gs", "r"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, powerMethodMultiplicationStyleOptionName, false, "Sets which method multiplication style to prefer for the power method.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
@@ -63,10 +67,28 @@ namespace storm {
                     return NativeEquationSolverSettings::LinearEquationMethod::Power;
                 } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
                     return NativeEquationSolverSettings::LinearEquationMethod::RationalSearch;
+                } else if (linearEquationSystemTechniqueAsString == "topological") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::Topological;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
             }
             
+            NativeEquationSolverSettings::LinearEquationMethod NativeEquationSolverSettings::getSccLinearEquationSystemMethod() const {
+                std::string sccTechniqueAsString = this->getOption(sccTechniqueOptionName).getArgumentByName("name").getValueAsString();
+                if (sccTechniqueAsString == "jacobi") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::Jacobi;
+                } else if (sccTechniqueAsString == "gaussseidel") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::GaussSeidel;
+                } else if (sccTechniqueAsString == "sor") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::SOR;
+                } else if (sccTechniqueAsString == "walkerchae") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::WalkerChae;
+                } else if (sccTechniqueAsString == "power") {
+                    return NativeEquationSolverSettings::LinearEquationMethod::Power;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown solution technique '" << sccTechniqueAsString << "' selected for the SCCs.");
+            }
+            
             bool NativeEquationSolverSettings::isMaximalIterationCountSet() const {
                 return this->getOption(maximalIterationsOptionName).getHasOptionBeenSet();
             }
@@ -122,6 +144,7 @@ namespace storm {
                     case NativeEquationSolverSettings::LinearEquationMethod::WalkerChae: out << "walkerchae"; break;
                     case NativeEquationSolverSettings::LinearEquationMethod::Power: out << "power"; break;
                     case NativeEquationSolverSettings::LinearEquationMethod::RationalSearch: out << "ratsearch"; break;
+                    case NativeEquationSolverSettings::LinearEquationMethod::Topological: out << "topological"; break;
                 }
                 return out;
             }
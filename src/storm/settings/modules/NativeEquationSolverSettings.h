@@ -15,7 +15,7 @@ namespace storm {
             class NativeEquationSolverSettings : public ModuleSettings {
             public:
                 // An enumeration of all available methods for solving linear equations.
-                enum class LinearEquationMethod { Jacobi, GaussSeidel, SOR, WalkerChae, Power, RationalSearch };
+                enum class LinearEquationMethod { Jacobi, GaussSeidel, SOR, WalkerChae, Power, RationalSearch, Topological };
                 
                 // An enumeration of all available convergence criteria.
                 enum class ConvergenceCriterion { Absolute, Relative };
@@ -46,6 +46,14 @@ namespace storm {
                  */
                 LinearEquationMethod getLinearEquationSystemMethod() const;
                 
+                /*!
+                 * Retrieves the method that is used to solve the equation systems of the individual SCCs if the
+                 * topological method is selected.
+                 *
+                 * @return The method to use for the SCCs.
+                 */
+                LinearEquationMethod getSccLinearEquationSystemMethod() const;
+                
                 /*!
                  * Retrieves whether the maximal iteration count has been set.
                  *
@@ -116,6 +124,7 @@ namespace storm {
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string powerMethodMultiplicationStyleOptionName;
+                static const std::string sccTechniqueOptionName;
             };
             
             std::ostream& operator<<(std::ostream& out, NativeEquationSolverSettings::LinearEquationMethod const& method);
@@ -4,6 +4,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/utility/macros.h"
@@ -133,29 +134,37 @@ namespace storm {
         
         template<typename T>
         void GmmxxMultiplier<T>::multAddParallel(gmm::csr_matrix<T> const& matrix, std::vector<T> const& x, std::vector<T> const* b, std::vector<T>& result) const {
-#ifdef STORM_HAVE_INTELTBB
-            if (b) {
-                gmm::mult_add_parallel(matrix, x, *b, result);
-            } else {
-                gmm::mult_parallel(matrix, x, result);
+            // The arithmetic of the exact and parametric types is not thread-safe, so they are multiplied sequentially.
+            if (!storm::utility::ThreadPool::supportsParallelComputations<T>()) {
+                if (b) {
+                    gmm::mult_add(matrix, x, *b, result);
+                } else {
+                    gmm::mult(matrix, x, result);
+                }
+                return;
             }
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAdd(matrix, x, b, result);
-#endif
+            
+            // Balance the work by the number of entries rather than the number of rows.
+            storm::utility::ThreadPool::getGlobalPool().parallelFor(matrix.nr, [&matrix] (uint64_t row) { return static_cast<uint64_t>(matrix.jc[row]) + row; }, [&matrix, &x, b, &result] (uint64_t startRow, uint64_t endRow) {
+                auto itr = mat_row_const_begin(matrix) + startRow;
+                for (uint64_t row = startRow; row < endRow; ++row, ++itr) {
+                    T newValue = b ? (*b)[row] : storm::utility::zero<T>();
+                    newValue += vect_sp(gmm::linalg_traits<gmm::csr_matrix<T>>::row(itr), x, typename gmm::linalg_traits<gmm::csr_matrix<T>>::storage_type(), typename gmm::linalg_traits<std::vector<T>>::storage_type());
+                    result[row] = newValue;
+                }
+            });
         }
         
-#ifdef STORM_HAVE_INTELTBB
         template<typename T>
-        class TbbMultAddReduceFunctor {
+        class MultAddReduceRangeFunctor {
         public:
-            TbbMultAddReduceFunctor(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, gmm::csr_matrix<T> const& matrix, std::vector<T> const& x, std::vector<T> const* b, std::vector<T>& result, std::vector<uint64_t>* choices) : dir(dir), rowGroupIndices(rowGroupIndices), matrix(matrix), x(x), b(b), result(result), choices(choices) {
+            MultAddReduceRangeFunctor(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, gmm::csr_matrix<T> const& matrix, std::vector<T> const& x, std::vector<T> const* b, std::vector<T>& result, std::vector<uint64_t>* choices) : dir(dir), rowGroupIndices(rowGroupIndices), matrix(matrix), x(x), b(b), result(result), choices(choices) {
                 // Intentionally left empty.
             }
             
-            void operator()(tbb::blocked_range<unsigned long> const& range) const {
-                auto groupIt = rowGroupIndices.begin() + range.begin();
-                auto groupIte = rowGroupIndices.begin() + range.end();
+            void operator()(uint64_t startGroup, uint64_t endGroup) const {
+                auto groupIt = rowGroupIndices.begin() + startGroup;
+                auto groupIte = rowGroupIndices.begin() + endGroup;
 
                 auto itr = mat_row_const_begin(matrix) + *groupIt;
                 typename std::vector<T>::const_iterator bIt;
@@ -164,10 +173,10 @@ namespace storm {
                 }
                 typename std::vector<uint64_t>::iterator choiceIt;
                 if (choices) {
-                    choiceIt = choices->begin() + range.begin();
+                    choiceIt = choices->begin() + startGroup;
                 }
                 
-                auto resultIt = result.begin() + range.begin();
+                auto resultIt = result.begin() + startGroup;
 
                 for (; groupIt != groupIte; ++groupIt, ++resultIt, ++choiceIt) {
                     if (choices) {
@@ -182,9 +191,10 @@ namespace storm {
                             currentValue = *bIt;
                             ++bIt;
                         }
-                        
+                        currentValue += vect_sp(gmm::linalg_traits<gmm::csr_matrix<T>>::row(itr), x, typename gmm::linalg_traits<gmm::csr_matrix<T>>::storage_type(), typename gmm::linalg_traits<std::vector<T>>::storage_type());
+
                         ++itr;
-                        
+
                         for (auto itre = mat_row_const_begin(matrix) + *(groupIt + 1); itr != itre; ++itr) {
                             T newValue = vect_sp(gmm::linalg_traits<gmm::csr_matrix<T>>::row(itr), x, typename gmm::linalg_traits<gmm::csr_matrix<T>>::storage_type(), typename gmm::linalg_traits<std::vector<T>>::storage_type());
                             if (b) {
@@ -214,16 +224,16 @@ namespace storm {
             std::vector<T>& result;
             std::vector<uint64_t>* choices;
         };
-#endif
         
         template<typename T>
         void GmmxxMultiplier<T>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, gmm::csr_matrix<T> const& matrix, std::vector<T> const& x, std::vector<T> const* b, std::vector<T>& result, std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
-            tbb::parallel_for(tbb::blocked_range<unsigned long>(0, rowGroupIndices.size() - 1, 10), TbbMultAddReduceFunctor<T>(dir, rowGroupIndices, matrix, x, b, result, choices));
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAddReduce(dir, rowGroupIndices, matrix, x, b, result, choices);
-#endif
+            if (!storm::utility::ThreadPool::supportsParallelComputations<T>()) {
+                multAddReduceHelper(dir, rowGroupIndices, matrix, x, b, result, choices);
+                return;
+            }
+            
+            // Balance the work by the number of entries and rows rather than the number of groups.
+            storm::utility::ThreadPool::getGlobalPool().parallelFor(rowGroupIndices.size() - 1, [&matrix, &rowGroupIndices] (uint64_t group) { return static_cast<uint64_t>(matrix.jc[rowGroupIndices[group]]) + rowGroupIndices[group]; }, MultAddReduceRangeFunctor<T>(dir, rowGroupIndices, matrix, x, b, result, choices));
         }
         
         template<>
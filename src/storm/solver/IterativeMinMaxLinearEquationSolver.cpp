@@ -9,6 +9,7 @@
 #include "storm/utility/KwekMehlhorn.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -46,6 +47,8 @@ namespace storm {
                 case MinMaxMethod::ValueIteration: this->solutionMethod = SolutionMethod::ValueIteration; break;
                 case MinMaxMethod::PolicyIteration: this->solutionMethod = SolutionMethod::PolicyIteration; break;
                 case MinMaxMethod::RationalSearch: this->solutionMethod = SolutionMethod::RationalSearch; break;
+                case MinMaxMethod::IntervalIteration: this->solutionMethod = SolutionMethod::IntervalIteration; break;
+                case MinMaxMethod::OptimisticValueIteration: this->solutionMethod = SolutionMethod::OptimisticValueIteration; break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique for iterative MinMax linear equation solver.");
             }
@@ -138,6 +141,12 @@ namespace storm {
                 case IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::RationalSearch:
                     result = solveEquationsRationalSearch(dir, x, b);
                     break;
+                case IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration:
+                    result = solveEquationsIntervalIteration(dir, x, b);
+                    break;
+                case IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::OptimisticValueIteration:
+                    result = solveEquationsOptimisticValueIteration(dir, x, b);
+                    break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "This solver does not implement the selected solution method");
             }
@@ -145,6 +154,16 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBlock(OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Only plain value iteration iterates the systems together. All other methods (and value iteration with
+            // features that refer to a single system) solve the systems one after another.
+            if (this->getSettings().getSolutionMethod() == IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration && !this->getSettings().getForceSoundness() && !this->hasInitialScheduler() && !this->isTrackSchedulerSet() && !this->hasCustomTerminationCondition()) {
+                return solveEquationsValueIterationBlock(dir, x, b);
+            }
+            return StandardMinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBlock(dir, x, b);
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             // Create the initial scheduler.
@@ -268,7 +287,20 @@ namespace storm {
             // Start by copying the requirements of the linear equation solver.
             MinMaxLinearEquationSolverRequirements requirements(this->linearEquationSolverFactory->getRequirements());
 
-            if (this->getSettings().getSolutionMethod() == IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration) {
+            if (this->getSettings().getSolutionMethod() == IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::IntervalIteration) {
+                // Like sound value iteration, interval iteration requires a unique solution and lower+upper bounds.
+                if (!this->hasUniqueSolution()) {
+                    requirements.requireNoEndComponents();
+                }
+                requirements.requireBounds();
+            } else if (this->getSettings().getSolutionMethod() == IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::OptimisticValueIteration) {
+                // Optimistic value iteration approaches the solution from below and guesses the upper bound itself. To
+                // verify the guess, the solution needs to be unique.
+                if (!this->hasUniqueSolution()) {
+                    requirements.requireNoEndComponents();
+                }
+                requirements.requireLowerBounds();
+            } else if (this->getSettings().getSolutionMethod() == IterativeMinMaxLinearEquationSolverSettings<ValueType>::SolutionMethod::ValueIteration) {
                 if (this->getSettings().getForceSoundness()) {
                     // Interval iteration requires a unique solution and lower+upper bounds
                     if (!this->hasUniqueSolution()) {
@@ -362,6 +394,7 @@ namespace storm {
                 this->linEqSolverA = this->linearEquationSolverFactory->create(*this->A);
                 this->linEqSolverA->setCachingEnabled(true);
             }
+            this->createRequestedCompactLayout();
             
             if (!auxiliaryRowGroupVector) {
                 auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
@@ -433,6 +466,66 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIterationBlock(OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            if (!this->linEqSolverA) {
+                this->linEqSolverA = this->linearEquationSolverFactory->create(*this->A);
+                this->linEqSolverA->setCachingEnabled(true);
+            }
+            
+            uint64_t blockSize = x.size();
+            STORM_LOG_INFO("Solving " << blockSize << " min-max equation systems (" << this->A->getRowGroupCount() << " row groups) with block value iteration.");
+            
+            // Start from the bounds from which the iteration converges to the correct fixed point.
+            if (!this->hasUniqueSolution()) {
+                for (auto& singleX : x) {
+                    if (dir == storm::OptimizationDirection::Maximize) {
+                        this->createLowerBoundsVector(singleX);
+                    } else {
+                        this->createUpperBoundsVector(singleX);
+                    }
+                }
+            }
+            
+            std::vector<ValueType> interleavedB = storm::utility::vector::interleaveVectors(b);
+            std::vector<ValueType> firstX = storm::utility::vector::interleaveVectors(x);
+            std::vector<ValueType> secondX(firstX.size());
+            std::vector<ValueType>* currentX = &firstX;
+            std::vector<ValueType>* newX = &secondX;
+            
+            this->startMeasureProgress();
+            SolverStatus status = SolverStatus::InProgress;
+            uint64_t iterations = 0;
+            while (status == SolverStatus::InProgress) {
+                // Compute x' = min/max(A*x + b) for all vectors of the block.
+                this->linEqSolverA->multiplyAndReduceBlock(dir, this->A->getRowGroupIndices(), blockSize, *currentX, &interleavedB, *newX);
+                
+                // The criterion is applied entry-wise, so the block converges iff all systems converge.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, this->getSettings().getPrecision(), this->getSettings().getRelativeTerminationCriterion())) {
+                    status = SolverStatus::Converged;
+                }
+                
+                std::swap(currentX, newX);
+                ++iterations;
+                if (status != SolverStatus::Converged && iterations >= this->getSettings().getMaximalNumberOfIterations()) {
+                    status = SolverStatus::MaximalIterationsExceeded;
+                }
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+            }
+            
+            storm::utility::vector::deinterleaveVectors(*currentX, x);
+            
+            reportStatus(status, iterations);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -471,6 +564,7 @@ namespace storm {
                 this->linEqSolverA = this->linearEquationSolverFactory->create(*this->A);
                 this->linEqSolverA->setCachingEnabled(true);
             }
+            this->createRequestedCompactLayout();
             
             if (!auxiliaryRowGroupVector) {
                 auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
@@ -636,6 +730,288 @@ namespace storm {
             return status == SolverStatus::Converged;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::performIntervalIterationStep(OptimizationDirection dir, std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX, std::vector<ValueType>& newLowerX, std::vector<ValueType>& newUpperX, std::vector<ValueType> const& b, ValueType const& precision, uint64_t startGroup, uint64_t endGroup) const {
+            std::vector<uint64_t> const& rowGroupIndices = this->A->getRowGroupIndices();
+            bool minimize = storm::solver::minimize(dir);
+            bool relative = this->getSettings().getRelativeTerminationCriterion();
+            storm::storage::BitVector const* relevantValues = this->hasRelevantValues() ? &this->getRelevantValues() : nullptr;
+            
+            bool converged = true;
+            for (uint64_t group = startGroup; group < endGroup; ++group) {
+                uint64_t row = rowGroupIndices[group];
+                uint64_t endRow = rowGroupIndices[group + 1];
+                if (row == endRow) {
+                    continue;
+                }
+                
+                // Every entry of the row is loaded once and used for both the lower and the upper bound.
+                ValueType bestLower;
+                ValueType bestUpper;
+                for (bool firstRow = true; row < endRow; ++row, firstRow = false) {
+                    ValueType lowerValue = b[row];
+                    ValueType upperValue = b[row];
+                    for (auto const& entry : this->A->getRow(row)) {
+                        lowerValue += entry.getValue() * lowerX[entry.getColumn()];
+                        upperValue += entry.getValue() * upperX[entry.getColumn()];
+                    }
+                    
+                    if (firstRow) {
+                        bestLower = std::move(lowerValue);
+                        bestUpper = std::move(upperValue);
+                    } else if (minimize) {
+                        bestLower = std::min(bestLower, lowerValue);
+                        bestUpper = std::min(bestUpper, upperValue);
+                    } else {
+                        bestLower = std::max(bestLower, lowerValue);
+                        bestUpper = std::max(bestUpper, upperValue);
+                    }
+                }
+                
+                // Check the gap of the state while its values are still at hand.
+                if (converged && (!relevantValues || relevantValues->get(group))) {
+                    converged = storm::utility::vector::equalModuloPrecision<ValueType>(bestLower, bestUpper, precision, relative);
+                }
+                newLowerX[group] = std::move(bestLower);
+                newUpperX[group] = std::move(bestUpper);
+            }
+            return converged;
+        }
+        
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::performIntervalIterationStep(OptimizationDirection dir, std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX, std::vector<ValueType>& newLowerX, std::vector<ValueType>& newUpperX, std::vector<ValueType> const& b, ValueType const& precision) const {
+            uint64_t numberOfGroups = this->A->getRowGroupCount();
+            storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+            
+            // In-place updates need to be performed sequentially.
+            if (&lowerX == &newLowerX || pool.getThreadCount() <= 1 || !storm::utility::ThreadPool::supportsParallelComputations<ValueType>()) {
+                return performIntervalIterationStep(dir, lowerX, upperX, newLowerX, newUpperX, b, precision, 0, numberOfGroups);
+            }
+            
+            std::vector<uint64_t> const& rowGroupIndices = this->A->getRowGroupIndices();
+            std::atomic<bool> converged(true);
+            pool.parallelFor(numberOfGroups, [this, &rowGroupIndices] (uint64_t group) { return static_cast<uint64_t>(this->A->begin(rowGroupIndices[group]) - this->A->begin()) + rowGroupIndices[group]; }, [&] (uint64_t startGroup, uint64_t endGroup) {
+                if (!performIntervalIterationStep(dir, lowerX, upperX, newLowerX, newUpperX, b, precision, startGroup, endGroup)) {
+                    converged.store(false, std::memory_order_relaxed);
+                }
+            });
+            return converged.load();
+        }
+        
+        /*!
+         * Interval iteration (Haddad and Monmege, TCS 2017, Baier et al., CAV 2017) that improves the lower and the
+         * upper bound in one pass over the matrix. Hence, the matrix is only traversed once per iteration while
+         * sound value iteration traverses it for both bounds separately. The method terminates as soon as the gap
+         * between the bounds of every (relevant) state is small enough.
+         */
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+            STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
+            
+            uint64_t numberOfGroups = this->A->getRowGroupCount();
+            std::vector<ValueType>* lowerX = &x;
+            this->createLowerBoundsVector(*lowerX);
+            this->createUpperBoundsVector(this->auxiliaryRowGroupVector, numberOfGroups);
+            std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
+            
+            // With Gauss-Seidel style multiplications, the bounds are updated in-place (and hence sequentially). Otherwise,
+            // the new bounds are written to separate vectors, which allows to process the row groups in parallel.
+            bool inPlace = this->getSettings().getValueIterationMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
+            std::vector<ValueType> newLowerX;
+            std::vector<ValueType> newUpperX;
+            if (!inPlace) {
+                newLowerX.resize(numberOfGroups);
+                newUpperX.resize(numberOfGroups);
+            }
+            
+            // As the result is the mean of both bounds, a gap of twice the precision suffices for absolute precision.
+            ValueType precision = static_cast<ValueType>(this->getSettings().getPrecision());
+            if (!this->getSettings().getRelativeTerminationCriterion()) {
+                precision *= storm::utility::convertNumber<ValueType>(2.0);
+            }
+            
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                bool converged;
+                if (inPlace) {
+                    converged = performIntervalIterationStep(dir, *lowerX, *upperX, *lowerX, *upperX, b, precision);
+                } else {
+                    converged = performIntervalIterationStep(dir, *lowerX, *upperX, newLowerX, newUpperX, b, precision);
+                }
+                if (!inPlace) {
+                    std::swap(*lowerX, newLowerX);
+                    std::swap(*upperX, newUpperX);
+                }
+                
+                if (converged) {
+                    status = SolverStatus::Converged;
+                }
+                
+                // Update environment variables.
+                ++iterations;
+                status = updateStatusIfNotConverged(status, *lowerX, iterations, SolverGuarantee::LessOrEqual);
+                status = updateStatusIfNotConverged(status, *upperX, iterations, SolverGuarantee::GreaterOrEqual);
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+            }
+            
+            reportStatus(status, iterations);
+            
+            // We take the means of the lower and upper bound so we guarantee the desired precision.
+            ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+            storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(*lowerX, *upperX, *lowerX, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(numberOfGroups);
+                this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged;
+        }
+        
+        /*!
+         * Optimistic value iteration (Hartmanns and Kaminski, Optimistic Value Iteration, CAV 2020). Value iteration
+         * approaches the solution from below until it converges with respect to a guessed precision. Then, the values
+         * are increased slightly to obtain a candidate upper bound that is verified by iterating both bounds in fused
+         * passes over the matrix: once the candidate does not increase in one iteration, it is inductive and hence a
+         * sound upper bound. If instead the lower bound overtakes the candidate or the verification takes too long, value
+         * iteration is resumed with a smaller guessing precision.
+         */
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+            
+            if (!this->linEqSolverA) {
+                this->linEqSolverA = this->linearEquationSolverFactory->create(*this->A);
+                this->linEqSolverA->setCachingEnabled(true);
+            }
+            this->createRequestedCompactLayout();
+            
+            uint64_t numberOfGroups = this->A->getRowGroupCount();
+            if (!auxiliaryRowGroupVector) {
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(numberOfGroups);
+            }
+            
+            this->createLowerBoundsVector(x);
+            std::vector<ValueType> upperX(numberOfGroups);
+            std::vector<ValueType> newLowerX(numberOfGroups);
+            std::vector<ValueType> newUpperX(numberOfGroups);
+            boost::optional<std::vector<ValueType>> upperBounds;
+            if (this->hasUpperBound()) {
+                upperBounds = std::vector<ValueType>(numberOfGroups);
+                this->createUpperBoundsVector(upperBounds.get());
+            }
+            
+            bool relative = this->getSettings().getRelativeTerminationCriterion();
+            ValueType guessPrecision = static_cast<ValueType>(this->getSettings().getPrecision());
+            
+            // As the result is the mean of both bounds, a gap of twice the precision suffices for absolute precision.
+            ValueType precision = guessPrecision;
+            if (!relative) {
+                precision *= storm::utility::convertNumber<ValueType>(2.0);
+            }
+            
+            uint64_t iterations = 0;
+            bool verified = false;
+            SolverStatus status = SolverStatus::InProgress;
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress) {
+                // Approach the solution from below.
+                std::vector<ValueType>* currentX = &x;
+                std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
+                ValueIterationResult valueIterationResult = performValueIteration(dir, currentX, newX, b, guessPrecision, relative, SolverGuarantee::LessOrEqual, iterations);
+                if (currentX != &x) {
+                    std::swap(x, *currentX);
+                }
+                iterations += valueIterationResult.iterations;
+                if (valueIterationResult.status != SolverStatus::Converged) {
+                    status = valueIterationResult.status;
+                    break;
+                }
+                
+                // Guess an upper bound.
+                for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                    if (relative) {
+                        upperX[group] = x[group] * (storm::utility::one<ValueType>() + guessPrecision);
+                    } else {
+                        upperX[group] = x[group] + guessPrecision;
+                    }
+                    if (upperBounds) {
+                        upperX[group] = std::min(upperX[group], upperBounds.get()[group]);
+                    }
+                }
+                
+                // Verify the guess. We spend at most as many iterations on this as the preceding value iteration took.
+                for (uint64_t verificationIterations = 0; status == SolverStatus::InProgress && (verified || verificationIterations < valueIterationResult.iterations); ++verificationIterations) {
+                    bool converged = performIntervalIterationStep(dir, x, upperX, newLowerX, newUpperX, b, precision);
+                    
+                    bool inductive = true;
+                    bool crossed = false;
+                    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                        if (newUpperX[group] > upperX[group]) {
+                            inductive = false;
+                        }
+                        if (newLowerX[group] > upperX[group]) {
+                            crossed = true;
+                        }
+                    }
+                    std::swap(x, newLowerX);
+                    std::swap(upperX, newUpperX);
+                    ++iterations;
+                    
+                    // Once the candidate is inductive, all its successors are sound upper bounds as well.
+                    verified |= inductive;
+                    if (verified && converged) {
+                        status = SolverStatus::Converged;
+                    } else if (!verified && crossed) {
+                        break;
+                    }
+                    
+                    status = updateStatusIfNotConverged(status, x, iterations, SolverGuarantee::LessOrEqual);
+                    if (verified) {
+                        status = updateStatusIfNotConverged(status, upperX, iterations, SolverGuarantee::GreaterOrEqual);
+                    }
+                    
+                    // Potentially show progress.
+                    this->showProgressIterative(iterations);
+                }
+                
+                if (!verified && status == SolverStatus::InProgress) {
+                    guessPrecision /= storm::utility::convertNumber<ValueType>(2.0);
+                    STORM_LOG_TRACE("Verification of the upper bound failed after " << iterations << " iterations, continuing with guessing precision " << guessPrecision << ".");
+                }
+            }
+            
+            reportStatus(status, iterations);
+            
+            // We take the means of the lower and upper bound (if it could be verified) so we guarantee the desired precision.
+            if (verified) {
+                ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(x, upperX, x, [&two] (ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+            }
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(numberOfGroups);
+                this->linEqSolverA->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector, &this->schedulerChoices.get());
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::isSolution(storm::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
             storm::utility::ConstantsComparator<ValueType> comparator;
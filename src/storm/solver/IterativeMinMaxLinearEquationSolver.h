@@ -18,7 +18,7 @@ namespace storm {
             IterativeMinMaxLinearEquationSolverSettings();
             
             enum class SolutionMethod {
-                ValueIteration, PolicyIteration, Acyclic, RationalSearch
+                ValueIteration, PolicyIteration, Acyclic, RationalSearch, IntervalIteration, OptimisticValueIteration
             };
             
             void setSolutionMethod(SolutionMethod const& solutionMethod);
@@ -53,6 +53,7 @@ namespace storm {
             IterativeMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A, std::unique_ptr<LinearEquationSolverFactory<ValueType>>&& linearEquationSolverFactory, IterativeMinMaxLinearEquationSolverSettings<ValueType> const& settings = IterativeMinMaxLinearEquationSolverSettings<ValueType>());
             
             virtual bool internalSolveEquations(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveEquationsBlock(OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const override;
 
             IterativeMinMaxLinearEquationSolverSettings<ValueType> const& getSettings() const;
             void setSettings(IterativeMinMaxLinearEquationSolverSettings<ValueType> const& newSettings);
@@ -69,7 +70,12 @@ namespace storm {
             bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
             bool solveEquationsValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsValueIterationBlock(OptimizationDirection dir, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
             bool solveEquationsSoundValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsIntervalIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsOptimisticValueIteration(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool performIntervalIterationStep(OptimizationDirection dir, std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX, std::vector<ValueType>& newLowerX, std::vector<ValueType>& newUpperX, std::vector<ValueType> const& b, ValueType const& precision) const;
+            bool performIntervalIterationStep(OptimizationDirection dir, std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX, std::vector<ValueType>& newLowerX, std::vector<ValueType>& newUpperX, std::vector<ValueType> const& b, ValueType const& precision, uint64_t startGroup, uint64_t endGroup) const;
             bool solveEquationsAcyclic(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsRationalSearch(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
@@ -16,6 +16,7 @@
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 
 namespace storm {
     namespace solver {
@@ -30,6 +31,50 @@ namespace storm {
             return this->internalSolveEquations(x, b);
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquations(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException, "The number of solution vectors does not match the number of right-hand sides.");
+            if (x.empty()) {
+                return true;
+            } else if (x.size() == 1) {
+                return this->internalSolveEquations(x.front(), b.front());
+            }
+            return this->internalSolveEquationsBlock(x, b);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::internalSolveEquationsBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // The systems share the matrix, so we keep the data the solver derives from it (e.g. decompositions or
+            // preconditioners) for all systems. But remember how the old setting was.
+            bool cachingWasEnabled = isCachingEnabled();
+            setCachingEnabled(true);
+            
+            bool result = true;
+            for (uint64_t i = 0; i < x.size(); ++i) {
+                result &= this->internalSolveEquations(x[i], b[i]);
+            }
+            
+            // Restore the old caching setting.
+            setCachingEnabled(cachingWasEnabled);
+            return result;
+        }
+        
+        template<typename ValueType>
+        void LinearEquationSolver<ValueType>::multiplyBlock(uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<std::vector<ValueType>> xs(blockSize);
+            storm::utility::vector::deinterleaveVectors(x, xs);
+            std::vector<std::vector<ValueType>> bs;
+            if (b) {
+                bs.resize(blockSize);
+                storm::utility::vector::deinterleaveVectors(*b, bs);
+            }
+            std::vector<std::vector<ValueType>> results(blockSize, std::vector<ValueType>(getMatrixRowCount()));
+            for (uint64_t i = 0; i < blockSize; ++i) {
+                this->multiply(xs[i], b ? &bs[i] : nullptr, results[i]);
+            }
+            result = storm::utility::vector::interleaveVectors(results);
+        }
+        
         template<typename ValueType>
         void LinearEquationSolver<ValueType>::repeatedMultiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
             if (!cachedRowVector) {
@@ -90,6 +135,22 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void LinearEquationSolver<ValueType>::multiplyAndReduceBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<std::vector<ValueType>> xs(blockSize);
+            storm::utility::vector::deinterleaveVectors(x, xs);
+            std::vector<std::vector<ValueType>> bs;
+            if (b) {
+                bs.resize(blockSize);
+                storm::utility::vector::deinterleaveVectors(*b, bs);
+            }
+            std::vector<std::vector<ValueType>> results(blockSize, std::vector<ValueType>(rowGroupIndices.size() - 1));
+            for (uint64_t i = 0; i < blockSize; ++i) {
+                this->multiplyAndReduce(dir, rowGroupIndices, xs[i], b ? &bs[i] : nullptr, results[i]);
+            }
+            result = storm::utility::vector::interleaveVectors(results);
+        }
+        
 #ifdef STORM_HAVE_CARL
         template<>
         void LinearEquationSolver<storm::RationalFunction>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<storm::RationalFunction>& x, std::vector<storm::RationalFunction> const* b, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices ) const {
@@ -102,6 +163,11 @@ namespace storm {
             return false;
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::multipliesWithGivenMatrix() const {
+            return false;
+        }
+        
         template<typename ValueType>
         void LinearEquationSolver<ValueType>::multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This solver does not support the function 'multiplyGaussSeidel'.");
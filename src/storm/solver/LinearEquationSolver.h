@@ -49,6 +49,18 @@ namespace storm {
              * @return true
              */
             bool solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Solves the equation system for several right-hand sides, i.e. it computes the solution x[i] for the
+             * vector b[i] for every i. Solvers that support it iterate all systems together, so that each entry of
+             * the matrix is only loaded once per iteration. Other solvers solve the systems one after another.
+             *
+             * @param x The solution vectors that have to be computed. There must be as many as there are vectors b.
+             * @param b The right-hand sides.
+             *
+             * @return true iff all systems were solved.
+             */
+            bool solveEquations(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
 
             /*!
              * Performs on matrix-vector multiplication x' = A*x + b.
@@ -62,6 +74,19 @@ namespace storm {
              */
             virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const = 0;
             
+            /*!
+             * Performs the matrix-vector multiplication x' = A*x + b for a block of vectors at once. The vectors are
+             * stored interleaved, i.e. entry j of the i-th vector is located at position i + j * blockSize (see
+             * storm::utility::vector::interleaveVectors). Unless overridden, the vectors are multiplied one after
+             * another.
+             *
+             * @param blockSize The number of vectors in the block.
+             * @param x The interleaved input vectors.
+             * @param b If non-null, these interleaved vectors are added after the multiplication.
+             * @param result The interleaved target vectors. They must not alias the input vectors.
+             */
+            virtual void multiplyBlock(uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            
             /*!
              * Performs on matrix-vector multiplication x' = A*x + b and then minimizes/maximizes over the row groups
              * so that the resulting vector has the size of number of row groups of A.
@@ -78,11 +103,24 @@ namespace storm {
              */
             virtual void multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const;
             
+            /*!
+             * Performs the same operation as multiplyAndReduce for a block of interleaved vectors (see multiplyBlock).
+             * The reduction is done for each of the vectors independently.
+             */
+            virtual void multiplyAndReduceBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            
             /*!
              * Retrieves whether this solver offers the gauss-seidel style multiplications.
              */
             virtual bool supportsGaussSeidelMultiplication() const;
             
+            /*!
+             * Retrieves whether the multiplications of this solver operate on the matrix it was given (rather than on
+             * a copy in a solver-specific format), so that the matrix may be stored in the compact layout (see
+             * SparseMatrix::createCompactLayout).
+             */
+            virtual bool multipliesWithGivenMatrix() const;
+            
             /*!
              * Performs on matrix-vector multiplication x' = A*x + b. It does so in a gauss-seidel style, i.e. reusing
              * the new x' components in the further multiplication.
@@ -152,6 +190,12 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems for several right-hand sides. By default, this solves them one after another
+             * and keeps the cached data of the solver in between.
+             */
+            virtual bool internalSolveEquationsBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
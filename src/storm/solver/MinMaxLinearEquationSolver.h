@@ -57,6 +57,20 @@ namespace storm {
              */
             void solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
+            /*!
+             * Solves the equation systems x[i] = min/max(A*x[i] + b[i]) for several vectors b[i] at once. Solvers that
+             * support it iterate all systems together, so that each entry of the matrix is only loaded once per
+             * iteration. Other solvers solve the systems one after another. Note that the optimal choices are
+             * determined for every system independently. If a scheduler is tracked, the retrieved scheduler belongs
+             * to the last system.
+             *
+             * @param d The optimization direction.
+             * @param x The solution vectors. There must be as many as there are vectors b.
+             * @param b The vectors to add after matrix-vector multiplication.
+             * @return true iff all systems were solved.
+             */
+            bool solveEquations(OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+            
             /*!
              * Performs (repeated) matrix-vector multiplication with the given parameters, i.e. computes
              * x[i+1] = min/max(A*x[i] + b) until x[n], where x[0] = x. After each multiplication and addition, the
@@ -133,7 +147,7 @@ namespace storm {
              * Sets whether some of the generated data during solver calls should be cached.
              * This possibly decreases the runtime of subsequent calls but also increases memory consumption.
              */
-            void setCachingEnabled(bool value);
+            void setCachingEnabled(bool value) const;
             
             /*!
              * Retrieves whether some of the generated data during solver calls should be cached.
@@ -179,6 +193,12 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            
+            /*!
+             * Solves the equation systems for several vectors b. By default, this solves them one after another
+             * and keeps the cached data of the solver in between.
+             */
+            virtual bool internalSolveEquationsBlock(OptimizationDirection d, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
                         
             /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
             OptimizationDirectionSetting direction;
@@ -197,7 +217,7 @@ namespace storm {
             bool uniqueSolution;
             
             /// Whether some of the generated data during solver calls should be cached.
-            bool cachingEnabled;
+            mutable bool cachingEnabled;
             
             /// A flag storing whether the requirements of the solver were checked.
             bool requirementsChecked;
@@ -1,5 +1,6 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
+#include <atomic>
 #include <utility>
 
 #include "storm/settings/SettingsManager.h"
@@ -10,6 +11,7 @@
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -18,26 +20,34 @@
 namespace storm {
     namespace solver {
 
+        namespace {
+            template<typename SolutionMethod>
+            SolutionMethod convertSolutionMethod(storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod const& methodAsSetting) {
+                if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::GaussSeidel) {
+                    return SolutionMethod::GaussSeidel;
+                } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::Jacobi) {
+                    return SolutionMethod::Jacobi;
+                } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::SOR) {
+                    return SolutionMethod::SOR;
+                } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::WalkerChae) {
+                    return SolutionMethod::WalkerChae;
+                } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::Power) {
+                    return SolutionMethod::Power;
+                } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::RationalSearch) {
+                    return SolutionMethod::RationalSearch;
+                } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::Topological) {
+                    return SolutionMethod::Topological;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "The selected solution technique is invalid for this solver.");
+            }
+        }
+
         template<typename ValueType>
         NativeLinearEquationSolverSettings<ValueType>::NativeLinearEquationSolverSettings() {
             storm::settings::modules::NativeEquationSolverSettings const& settings = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>();
             
-            storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod methodAsSetting = settings.getLinearEquationSystemMethod();
-            if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::GaussSeidel) {
-                method = SolutionMethod::GaussSeidel;
-            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::Jacobi) {
-                method = SolutionMethod::Jacobi;
-            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::SOR) {
-                method = SolutionMethod::SOR;
-            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::WalkerChae) {
-                method = SolutionMethod::WalkerChae;
-            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::Power) {
-                method = SolutionMethod::Power;
-            } else if (methodAsSetting == storm::settings::modules::NativeEquationSolverSettings::LinearEquationMethod::RationalSearch) {
-                method = SolutionMethod::RationalSearch;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "The selected solution technique is invalid for this solver.");
-            }
+            method = convertSolutionMethod<SolutionMethod>(settings.getLinearEquationSystemMethod());
+            sccMethod = convertSolutionMethod<SolutionMethod>(settings.getSccLinearEquationSystemMethod());
         
             maximalNumberOfIterations = settings.getMaximalIterationCount();
             precision = settings.getPrecision();
@@ -91,11 +101,27 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolverSettings<ValueType>::setSccSolutionMethod(SolutionMethod const& method) {
+            STORM_LOG_THROW(method != SolutionMethod::Topological && method != SolutionMethod::RationalSearch, storm::exceptions::InvalidSettingsException, "The selected solution technique can not be used for the SCCs of the topological method.");
+            this->sccMethod = method;
+        }
+        
         template<typename ValueType>
         typename NativeLinearEquationSolverSettings<ValueType>::SolutionMethod NativeLinearEquationSolverSettings<ValueType>::getSolutionMethod() const {
             return method;
         }
         
+        template<typename ValueType>
+        typename NativeLinearEquationSolverSettings<ValueType>::SolutionMethod NativeLinearEquationSolverSettings<ValueType>::getSccSolutionMethod() const {
+            return sccMethod;
+        }
+        
+        template<typename ValueType>
+        typename NativeLinearEquationSolverSettings<ValueType>::SolutionMethod NativeLinearEquationSolverSettings<ValueType>::getEffectiveSolutionMethod() const {
+            return method == SolutionMethod::Topological ? sccMethod : method;
+        }
+        
         template<typename ValueType>
         ValueType NativeLinearEquationSolverSettings<ValueType>::getPrecision() const {
             return precision;
@@ -208,6 +234,7 @@ namespace storm {
             // Get a Jacobi decomposition of the matrix A.
             if (!jacobiDecomposition) {
                 jacobiDecomposition = std::make_unique<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>>(A->getJacobiDecomposition());
+                jacobiDecomposition->first.createRequestedCompactLayout();
             }
             storm::storage::SparseMatrix<ValueType> const& jacobiLU = jacobiDecomposition->first;
             std::vector<ValueType> const& jacobiD = jacobiDecomposition->second;
@@ -257,6 +284,59 @@ namespace storm {
             return converged;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobiBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            uint64_t blockSize = x.size();
+            STORM_LOG_INFO("Solving " << blockSize << " linear equation systems (" << getMatrixRowCount() << " rows) with NativeLinearEquationSolver (block Jacobi)");
+            
+            // Get a Jacobi decomposition of the matrix A.
+            if (!jacobiDecomposition) {
+                jacobiDecomposition = std::make_unique<std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>>>(A->getJacobiDecomposition());
+                jacobiDecomposition->first.createRequestedCompactLayout();
+            }
+            storm::storage::SparseMatrix<ValueType> const& jacobiLU = jacobiDecomposition->first;
+            std::vector<ValueType> const& jacobiD = jacobiDecomposition->second;
+            
+            // Prepare the interleaved solution vectors and right-hand sides.
+            std::vector<ValueType> interleavedB = storm::utility::vector::interleaveVectors(b);
+            std::vector<ValueType> firstX = storm::utility::vector::interleaveVectors(x);
+            std::vector<ValueType> secondX(firstX.size());
+            std::vector<ValueType>* currentX = &firstX;
+            std::vector<ValueType>* nextX = &secondX;
+            
+            // The systems are iterated together until all of them converged. As for the power method, the
+            // convergence criterion is applied entry-wise.
+            this->startMeasureProgress();
+            bool converged = false;
+            uint64_t iterations = 0;
+            while (!converged && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                // Compute D^-1 * (b - LU * x) for every system and store the result in nextX.
+                this->multiplier.multAddBlock(jacobiLU, blockSize, *currentX, nullptr, *nextX);
+                auto nextIt = nextX->begin();
+                auto bIt = interleavedB.begin();
+                for (auto const& diagonalEntry : jacobiD) {
+                    for (uint64_t i = 0; i < blockSize; ++i, ++nextIt, ++bIt) {
+                        *nextIt = diagonalEntry * (*bIt - *nextIt);
+                    }
+                }
+                
+                converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
+                this->showProgressIterative(iterations);
+                std::swap(currentX, nextX);
+                ++iterations;
+            }
+            
+            storm::utility::vector::deinterleaveVectors(*currentX, x);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, false, iterations);
+            
+            return converged;
+        }
+        
         template<typename ValueType>
         NativeLinearEquationSolver<ValueType>::WalkerChaeData::WalkerChaeData(storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& originalB) : t(storm::utility::convertNumber<ValueType>(1000.0)) {
             computeWalkerChaeMatrix(originalMatrix);
@@ -435,6 +515,7 @@ namespace storm {
         bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
             STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Power)");
+            createRequestedCompactLayout();
 
             // Prepare the solution vectors.
             if (!this->cachedRowVector) {
@@ -462,6 +543,47 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsPowerBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+            uint64_t blockSize = x.size();
+            STORM_LOG_INFO("Solving " << blockSize << " linear equation systems (" << getMatrixRowCount() << " rows) with NativeLinearEquationSolver (block Power)");
+            createRequestedCompactLayout();
+            
+            // Prepare the interleaved solution vectors and right-hand sides.
+            for (auto& singleX : x) {
+                this->createLowerBoundsVector(singleX);
+            }
+            std::vector<ValueType> interleavedB = storm::utility::vector::interleaveVectors(b);
+            std::vector<ValueType> firstX = storm::utility::vector::interleaveVectors(x);
+            std::vector<ValueType> secondX(firstX.size());
+            std::vector<ValueType>* currentX = &firstX;
+            std::vector<ValueType>* newX = &secondX;
+            
+            // The systems are iterated together until all of them converged. Note that the convergence criterion is
+            // applied entry-wise, so it is the same as the one for the individual systems.
+            this->startMeasureProgress();
+            bool converged = false;
+            uint64_t iterations = 0;
+            while (!converged && iterations < this->getSettings().getMaximalNumberOfIterations()) {
+                this->multiplier.multAddBlock(*this->A, blockSize, *currentX, &interleavedB, *newX);
+                converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, static_cast<ValueType>(this->getSettings().getPrecision()), this->getSettings().getRelativeTerminationCriterion());
+                this->showProgressIterative(iterations);
+                std::swap(currentX, newX);
+                ++iterations;
+            }
+            
+            storm::utility::vector::deinterleaveVectors(*currentX, x);
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, false, iterations);
+            
+            return converged;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -491,6 +613,7 @@ namespace storm {
             STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
             STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
             STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (SoundPower)");
+            createRequestedCompactLayout();
             
             std::vector<ValueType>* lowerX = &x;
             this->createLowerBoundsVector(*lowerX);
@@ -649,6 +772,168 @@ namespace storm {
             return solveEquationsRationalSearchHelper<double>(x, b);
         }
         
+        template<typename ValueType>
+        NativeLinearEquationSolver<ValueType>::TopologicalData::TopologicalData(storm::storage::SparseMatrix<ValueType> const& matrix) : sccDecomposition(matrix), stateToScc(matrix.getRowCount()), localIndices(matrix.getRowCount()) {
+            for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                uint64_t localIndex = 0;
+                for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                    stateToScc[state] = sccIndex;
+                    localIndices[state] = localIndex;
+                    ++localIndex;
+                }
+            }
+            
+            // The decomposition lists every SCC after all SCCs reachable from it, so the depths of the successors of
+            // an SCC are known when it is processed.
+            std::vector<uint64_t> depths(sccDecomposition.size(), 0);
+            uint64_t maximalDepth = 0;
+            for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                    for (auto const& entry : matrix.getRow(state)) {
+                        uint64_t successorScc = stateToScc[entry.getColumn()];
+                        if (successorScc != sccIndex) {
+                            STORM_LOG_ASSERT(successorScc < sccIndex, "SCCs are not in topological order.");
+                            depths[sccIndex] = std::max(depths[sccIndex], depths[successorScc] + 1);
+                        }
+                    }
+                }
+                maximalDepth = std::max(maximalDepth, depths[sccIndex]);
+            }
+            
+            levels.resize(sccDecomposition.empty() ? 0 : maximalDepth + 1);
+            levelPrefixWeights.resize(levels.size(), std::vector<uint64_t>(1, 0));
+            for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                uint64_t weight = 0;
+                for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                    weight += matrix.getRow(state).getNumberOfEntries() + 1;
+                }
+                levels[depths[sccIndex]].push_back(sccIndex);
+                levelPrefixWeights[depths[sccIndex]].push_back(levelPrefixWeights[depths[sccIndex]].back() + weight);
+            }
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsTopological(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (topological)");
+            
+            if (!this->topologicalData) {
+                this->topologicalData = std::make_unique<TopologicalData>(*this->A);
+            }
+            TopologicalData const& data = *this->topologicalData;
+            STORM_LOG_INFO("Found " << data.sccDecomposition.size() << " SCCs in " << data.levels.size() << " levels.");
+            
+            // In the fixed point format, the matrix is A in x = Ax + b, otherwise it is A in Ax = b. The values of
+            // states outside of an SCC are moved to the right-hand side with the corresponding sign.
+            bool fixedPointFormat = this->getEquationProblemFormat() == LinearEquationSolverProblemFormat::FixedPointSystem;
+            
+            NativeLinearEquationSolverSettings<ValueType> sccSettings = this->getSettings();
+            sccSettings.setSolutionMethod(this->getSettings().getSccSolutionMethod());
+            
+            std::atomic<bool> converged(true);
+            auto solveScc = [&] (uint64_t sccIndex) {
+                storm::storage::StronglyConnectedComponent const& scc = data.sccDecomposition.getBlock(sccIndex);
+                
+                if (scc.size() == 1) {
+                    // Solve single-state SCCs directly.
+                    uint64_t state = *scc.begin();
+                    ValueType diagonal = storm::utility::zero<ValueType>();
+                    ValueType value = b[state];
+                    for (auto const& entry : this->A->getRow(state)) {
+                        if (entry.getColumn() == state) {
+                            diagonal += entry.getValue();
+                        } else if (fixedPointFormat) {
+                            value += entry.getValue() * x[entry.getColumn()];
+                        } else {
+                            value -= entry.getValue() * x[entry.getColumn()];
+                        }
+                    }
+                    if (fixedPointFormat) {
+                        diagonal = storm::utility::one<ValueType>() - diagonal;
+                    }
+                    x[state] = value / diagonal;
+                    return;
+                }
+                
+                // Otherwise, build the equation system of the SCC.
+                storm::storage::SparseMatrixBuilder<ValueType> builder(scc.size(), scc.size());
+                std::vector<ValueType> sccB;
+                sccB.reserve(scc.size());
+                uint64_t row = 0;
+                for (auto const& state : scc) {
+                    ValueType value = b[state];
+                    for (auto const& entry : this->A->getRow(state)) {
+                        if (data.stateToScc[entry.getColumn()] == sccIndex) {
+                            builder.addNextValue(row, data.localIndices[entry.getColumn()], entry.getValue());
+                        } else if (fixedPointFormat) {
+                            value += entry.getValue() * x[entry.getColumn()];
+                        } else {
+                            value -= entry.getValue() * x[entry.getColumn()];
+                        }
+                    }
+                    sccB.push_back(value);
+                    ++row;
+                }
+                
+                NativeLinearEquationSolver<ValueType> sccSolver(builder.build(), sccSettings);
+                std::vector<ValueType> sccX;
+                sccX.reserve(scc.size());
+                for (auto const& state : scc) {
+                    sccX.push_back(x[state]);
+                }
+                if (this->hasLowerBound(AbstractEquationSolver<ValueType>::BoundType::Local)) {
+                    std::vector<ValueType> lowerBounds;
+                    for (auto const& state : scc) {
+                        lowerBounds.push_back(this->getLowerBounds()[state]);
+                    }
+                    sccSolver.setLowerBounds(lowerBounds);
+                } else if (this->hasLowerBound(AbstractEquationSolver<ValueType>::BoundType::Global)) {
+                    sccSolver.setLowerBound(this->getLowerBound());
+                }
+                if (this->hasUpperBound(AbstractEquationSolver<ValueType>::BoundType::Local)) {
+                    std::vector<ValueType> upperBounds;
+                    for (auto const& state : scc) {
+                        upperBounds.push_back(this->getUpperBounds()[state]);
+                    }
+                    sccSolver.setUpperBounds(std::move(upperBounds));
+                } else if (this->hasUpperBound(AbstractEquationSolver<ValueType>::BoundType::Global)) {
+                    sccSolver.setUpperBound(this->getUpperBound());
+                }
+                
+                if (!sccSolver.solveEquations(sccX, sccB)) {
+                    converged = false;
+                }
+                row = 0;
+                for (auto const& state : scc) {
+                    x[state] = sccX[row];
+                    ++row;
+                }
+            };
+            
+            // Solve the SCCs level by level. The SCCs of one level only depend on the ones of lower levels, so they
+            // can be solved in parallel.
+            storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+            for (uint64_t level = 0; level < data.levels.size(); ++level) {
+                std::vector<uint64_t> const& sccs = data.levels[level];
+                std::vector<uint64_t> const& prefixWeights = data.levelPrefixWeights[level];
+                auto solveSccs = [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        solveScc(sccs[index]);
+                    }
+                };
+                if (storm::utility::ThreadPool::supportsParallelComputations<ValueType>()) {
+                    pool.parallelFor(sccs.size(), [&prefixWeights] (uint64_t index) { return prefixWeights[index]; }, solveSccs);
+                } else {
+                    solveSccs(0, sccs.size());
+                }
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return converged;
+        }
+        
         template<typename RationalType, typename ImpreciseType>
         struct TemporaryHelper {
             static std::vector<RationalType>* getTemporary(std::vector<RationalType>& rationalX, std::vector<ImpreciseType>*& currentX, std::vector<ImpreciseType>*& newX) {
@@ -901,6 +1186,13 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::createRequestedCompactLayout() const {
+            if (localA) {
+                localA->createRequestedCompactLayout();
+            }
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::SOR || this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::GaussSeidel) {
@@ -917,12 +1209,29 @@ namespace storm {
                 }
             } else if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::RationalSearch) {
                 return this->solveEquationsRationalSearch(x, b);
+            } else if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Topological) {
+                return this->solveEquationsTopological(x, b);
             }
             
             STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unknown solving technique.");
             return false;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const {
+            // Only the Jacobi method and the (unsound) power method iterate the systems together. The block iteration of
+            // the power method is always performed in the Jacobi style, because a Gauss-Seidel sweep would have to be
+            // repeated for every vector anyway.
+            if (!this->hasCustomTerminationCondition()) {
+                if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Jacobi) {
+                    return this->solveEquationsJacobiBlock(x, b);
+                } else if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power && !this->getSettings().getForceSoundness()) {
+                    return this->solveEquationsPowerBlock(x, b);
+                }
+            }
+            return LinearEquationSolver<ValueType>::internalSolveEquationsBlock(x, b);
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             if (&x != &result) {
@@ -961,11 +1270,26 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::multiplyBlock(uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            multiplier.multAddBlock(*A, blockSize, x, b, result);
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::multiplyAndReduceBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            multiplier.multAddReduceBlock(dir, rowGroupIndices, *A, blockSize, x, b, result);
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::supportsGaussSeidelMultiplication() const {
             return true;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::multipliesWithGivenMatrix() const {
+            return true;
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
             STORM_LOG_ASSERT(this->A->getRowCount() == this->A->getColumnCount(), "This function is only applicable for square matrices.");
@@ -989,7 +1313,7 @@ namespace storm {
         
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat() const {
-            if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power || this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::RationalSearch) {
+            if (this->getSettings().getEffectiveSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power || this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::RationalSearch) {
                 return LinearEquationSolverProblemFormat::FixedPointSystem;
             } else {
                 return LinearEquationSolverProblemFormat::EquationSystem;
@@ -1006,7 +1330,7 @@ namespace storm {
                     STORM_LOG_WARN("Forcing soundness, but selecting a method other than the power iteration is not supported.");
                 }
             } else {
-                if (this->getSettings().getSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power) {
+                if (this->getSettings().getEffectiveSolutionMethod() == NativeLinearEquationSolverSettings<ValueType>::SolutionMethod::Power) {
                     requirements.requireLowerBounds();
                 }
             }
@@ -1018,6 +1342,7 @@ namespace storm {
             jacobiDecomposition.reset();
             cachedRowVector2.reset();
             walkerChaeData.reset();
+            topologicalData.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -8,6 +8,8 @@
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/SolverStatus.h"
 
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
 #include "storm/utility/NumberTraits.h"
 
 namespace storm {
@@ -17,7 +19,7 @@ namespace storm {
         class NativeLinearEquationSolverSettings {
         public:
             enum class SolutionMethod {
-                Jacobi, GaussSeidel, SOR, WalkerChae, Power, RationalSearch
+                Jacobi, GaussSeidel, SOR, WalkerChae, Power, RationalSearch, Topological
             };
 
             NativeLinearEquationSolverSettings();
@@ -29,6 +31,7 @@ namespace storm {
             void setOmega(ValueType omega);
             void setPowerMethodMultiplicationStyle(MultiplicationStyle value);
             void setForceSoundness(bool value);
+            void setSccSolutionMethod(SolutionMethod const& method);
             
             SolutionMethod getSolutionMethod() const;
             ValueType getPrecision() const;
@@ -37,10 +40,18 @@ namespace storm {
             ValueType getOmega() const;
             MultiplicationStyle getPowerMethodMultiplicationStyle() const;
             bool getForceSoundness() const;
+            SolutionMethod getSccSolutionMethod() const;
+            
+            /*!
+             * Retrieves the method that is used for the actual computations, i.e. the method used for the SCCs if the
+             * topological method is selected.
+             */
+            SolutionMethod getEffectiveSolutionMethod() const;
 
         private:
             bool forceSoundness;
             SolutionMethod method;
+            SolutionMethod sccMethod;
             ValueType precision;
             bool relative;
             uint_fast64_t maximalNumberOfIterations;
@@ -63,7 +74,10 @@ namespace storm {
             
             virtual void multiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
             virtual void multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyBlock(uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyAndReduceBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
             virtual bool supportsGaussSeidelMultiplication() const override;
+            virtual bool multipliesWithGivenMatrix() const override;
             virtual void multiplyGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
             virtual void multiplyAndReduceGaussSeidel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
             
@@ -77,6 +91,7 @@ namespace storm {
 
         protected:
             virtual bool internalSolveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+            virtual bool internalSolveEquationsBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const override;
             
         private:
             struct PowerIterationResult {
@@ -95,15 +110,24 @@ namespace storm {
             
             void logIterations(bool converged, bool terminate, uint64_t iterations) const;
             
+            /*!
+             * Converts the matrix to the compact layout if the solver owns it and the layout was requested for it.
+             * This is only done by the methods that exclusively multiply with the matrix.
+             */
+            void createRequestedCompactLayout() const;
+            
             virtual uint64_t getMatrixRowCount() const override;
             virtual uint64_t getMatrixColumnCount() const override;
 
             virtual bool solveEquationsSOR(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const;
             virtual bool solveEquationsJacobi(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsJacobiBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
             virtual bool solveEquationsWalkerChae(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsPower(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsPowerBlock(std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
             virtual bool solveEquationsSoundPower(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsTopological(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -151,6 +175,23 @@ namespace storm {
                 std::vector<ValueType> newX;
             };
             mutable std::unique_ptr<WalkerChaeData> walkerChaeData;
+            
+            struct TopologicalData {
+                TopologicalData(storm::storage::SparseMatrix<ValueType> const& matrix);
+                
+                storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition;
+                
+                // The SCC of every state and the index of every state within its SCC.
+                std::vector<uint64_t> stateToScc;
+                std::vector<uint64_t> localIndices;
+                
+                // The SCCs grouped by their depth, i.e. the length of the longest path to an SCC without successors.
+                // SCCs of the same depth do not depend on each other. For each depth, the prefix sums of the number of
+                // entries in the rows of the SCCs are stored as well.
+                std::vector<std::vector<uint64_t>> levels;
+                std::vector<std::vector<uint64_t>> levelPrefixWeights;
+            };
+            mutable std::unique_ptr<TopologicalData> topologicalData;
         };
         
         template<typename ValueType>
@@ -28,7 +28,7 @@ namespace storm {
             }
             
             if (this->parallelize()) {
-                multAddParallel(matrix, x, b, result);
+                multAddParallel(matrix, x, b, *target);
             } else {
                 matrix.multiplyWithVector(x, result, b);
             }
@@ -71,25 +71,39 @@ namespace storm {
                 
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddParallel(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-#ifdef STORM_HAVE_INTELTBB
             matrix.multiplyWithVectorParallel(x, result, b);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAdd(matrix, x, b, result);
-#endif
         }
                 
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
             matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
-#else
-            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-            multAddReduce(dir, rowGroupIndices, matrix, x, b, result, choices);
-#endif
         }
 
-
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddBlock(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (&x == &result) {
+                STORM_LOG_WARN("Using temporary in 'multAddBlock'.");
+                std::vector<ValueType> temporary(result.size());
+                matrix.multiplyWithVectorBlock(blockSize, x, temporary, b);
+                std::swap(result, temporary);
+            } else {
+                matrix.multiplyWithVectorBlock(blockSize, x, result, b);
+            }
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduceBlock(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (&x == &result) {
+                STORM_LOG_WARN("Using temporary in 'multAddReduceBlock'.");
+                std::vector<ValueType> temporary(result.size());
+                matrix.multiplyAndReduceBlock(dir, rowGroupIndices, blockSize, x, b, temporary);
+                std::swap(result, temporary);
+            } else {
+                matrix.multiplyAndReduceBlock(dir, rowGroupIndices, blockSize, x, b, result);
+            }
+        }
+        
         template class NativeMultiplier<double>;
         
 #ifdef STORM_HAVE_CARL
@@ -16,6 +16,10 @@ namespace storm {
                     return "acyclic";
                 case MinMaxMethod::RationalSearch:
                     return "ratsearch";
+                case MinMaxMethod::IntervalIteration:
+                    return "interval-iteration";
+                case MinMaxMethod::OptimisticValueIteration:
+                    return "optimisticvalueiteration";
             }
             return "invalid";
         }
@@ -30,6 +34,16 @@ namespace storm {
             return "invalid";
         }
         
+        std::string toString(MaBoundedReachabilityMethod m) {
+            switch(m) {
+                case MaBoundedReachabilityMethod::Imca:
+                    return "imca";
+                case MaBoundedReachabilityMethod::UnifPlus:
+                    return "unifplus";
+            }
+            return "invalid";
+        }
+        
         std::string toString(LpSolverType t) {
             switch(t) {
                 case LpSolverType::Gurobi:
@@ -41,12 +41,20 @@ namespace storm {
             this->A = this->localA.get();
         }
         
+        template<typename ValueType>
+        void StandardMinMaxLinearEquationSolver<ValueType>::createRequestedCompactLayout() const {
+            if (localA && linEqSolverA && linEqSolverA->multipliesWithGivenMatrix()) {
+                localA->createRequestedCompactLayout();
+            }
+        }
+        
         template<typename ValueType>
         void StandardMinMaxLinearEquationSolver<ValueType>::repeatedMultiply(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
             if (!linEqSolverA) {
                 linEqSolverA = linearEquationSolverFactory->create(*A);
                 linEqSolverA->setCachingEnabled(true);
             }
+            createRequestedCompactLayout();
             
             if (!auxiliaryRowGroupVector) {
                 auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
@@ -107,7 +115,7 @@ namespace storm {
         std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> StandardMinMaxLinearEquationSolverFactory<ValueType>::create() const {
             std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> result;
             auto method = this->getMinMaxMethod();
-            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::Acyclic) {
+            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::Acyclic || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration) {
                 IterativeMinMaxLinearEquationSolverSettings<ValueType> iterativeSolverSettings;
                 iterativeSolverSettings.setSolutionMethod(method);
                 result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType>>(this->linearEquationSolverFactory->clone(), iterativeSolverSettings);
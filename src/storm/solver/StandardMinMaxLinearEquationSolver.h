@@ -23,6 +23,12 @@ namespace storm {
             virtual void clearCache() const override;
 
         protected:
+            /*!
+             * Converts the matrix to the compact layout if the solver owns it, the layout was requested for it and the
+             * multiplications of the linear equation solver operate on it. This is only done by the methods that
+             * exclusively multiply with the matrix.
+             */
+            void createRequestedCompactLayout() const;
             
             // possibly cached data
             mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolverA;
@@ -32,6 +32,8 @@ namespace storm {
                 case MinMaxMethod::ValueIteration: this->solutionMethod = SolutionMethod::ValueIteration; break;
                 case MinMaxMethod::PolicyIteration: this->solutionMethod = SolutionMethod::PolicyIteration; break;
                 case MinMaxMethod::RationalSearch: this->solutionMethod = SolutionMethod::RationalSearch; break;
+                case MinMaxMethod::IntervalIteration:
+                    STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Interval iteration is not available for symbolic min/max equation solvers (hybrid and dd engines). Please select a different min/max method or use the sparse engine.");
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
             }
@@ -103,6 +103,7 @@ namespace storm {
 #ifdef STORM_HAVE_CUDA
                 STORM_LOG_THROW(resetCudaDevice(), storm::exceptions::InvalidStateException, "Could not reset CUDA Device, can not use CUDA Equation Solver.");
 
+				A->ensureStandardLayout();
 				bool result = false;
 				size_t globalIterations = 0;
 				if (dir == OptimizationDirection::Minimize) {
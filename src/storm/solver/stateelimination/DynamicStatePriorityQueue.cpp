@@ -1,5 +1,7 @@
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
@@ -25,6 +27,8 @@ namespace storm {
             
             template<typename ValueType>
             storm::storage::sparse::state_type DynamicStatePriorityQueue<ValueType>::pop() {
+                performPendingUpdates();
+                
                 auto it = priorityQueue.begin();
                 STORM_LOG_TRACE("Popping state " << it->first << " with priority " << it->second << ".");
                 storm::storage::sparse::state_type result = it->first;
@@ -35,25 +39,35 @@ namespace storm {
             
             template<typename ValueType>
             void DynamicStatePriorityQueue<ValueType>::update(storm::storage::sparse::state_type state) {
-                // First, we need to find the old priority queue entry for the state.
-                auto priorityQueueEntryIt = stateToPriorityQueueEntry.find(state);
-                
                 // If the priority queue does not store the priority of the given state, we must not update it.
-                if (priorityQueueEntryIt == stateToPriorityQueueEntry.end()) {
-                    return;
+                if (stateToPriorityQueueEntry.find(state) != stateToPriorityQueueEntry.end()) {
+                    statesToUpdate.push_back(state);
                 }
-
-                // Compute the new priority.
-                uint_fast64_t newPriority = penaltyFunction(state, transitionMatrix, backwardTransitions, oneStepProbabilities);
+            }
+            
+            template<typename ValueType>
+            void DynamicStatePriorityQueue<ValueType>::performPendingUpdates() {
+                std::sort(statesToUpdate.begin(), statesToUpdate.end());
+                statesToUpdate.erase(std::unique(statesToUpdate.begin(), statesToUpdate.end()), statesToUpdate.end());
                 
-                if (priorityQueueEntryIt->second->second != newPriority) {
-                    // Erase and re-insert the entry into priority queue (with the new priority).
-                    priorityQueue.erase(priorityQueueEntryIt->second);
-                    stateToPriorityQueueEntry.erase(priorityQueueEntryIt);
+                for (auto const& state : statesToUpdate) {
+                    // First, we need to find the old priority queue entry for the state.
+                    auto priorityQueueEntryIt = stateToPriorityQueueEntry.find(state);
+                    if (priorityQueueEntryIt == stateToPriorityQueueEntry.end()) {
+                        continue;
+                    }
+                    
+                    // Compute the new priority.
+                    uint_fast64_t newPriority = penaltyFunction(state, transitionMatrix, backwardTransitions, oneStepProbabilities);
                     
-                    auto newElementIt = priorityQueue.emplace(state, newPriority);
-                    stateToPriorityQueueEntry.emplace(state, newElementIt.first);
+                    if (priorityQueueEntryIt->second->second != newPriority) {
+                        // Erase and re-insert the entry into priority queue (with the new priority).
+                        priorityQueue.erase(priorityQueueEntryIt->second);
+                        auto newElementIt = priorityQueue.emplace(state, newPriority);
+                        priorityQueueEntryIt->second = newElementIt.first;
+                    }
                 }
+                statesToUpdate.clear();
             }
             
             template<typename ValueType>
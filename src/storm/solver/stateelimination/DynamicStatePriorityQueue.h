@@ -35,6 +35,11 @@ namespace storm {
                 virtual std::size_t size() const override;
                 
             private:
+                /*!
+                 * Recomputes the priorities of all states whose priority was invalidated since the last retrieval.
+                 */
+                void performPendingUpdates();
+                
                 typedef std::set<std::pair<storm::storage::sparse::state_type, uint_fast64_t>, PriorityComparator> PriorityQueue;
                 typedef std::unordered_map<storm::storage::sparse::state_type, PriorityQueue::const_iterator> StatePriorityQueueEntryMap;
                 
@@ -44,6 +49,10 @@ namespace storm {
                 PriorityQueue priorityQueue;
                 StatePriorityQueueEntryMap stateToPriorityQueueEntry;
                 PenaltyFunctionType penaltyFunction;
+                
+                // The states whose priority needs to be recomputed before the next state is retrieved. As states are
+                // typically updated many times between two retrievals, priorities are only recomputed lazily.
+                std::vector<storm::storage::sparse::state_type> statesToUpdate;
             };
             
         }
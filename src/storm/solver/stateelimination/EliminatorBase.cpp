@@ -1,5 +1,7 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
@@ -72,7 +74,7 @@ namespace storm {
                 FlexibleRowType rowsKeepingEntryInColumnEqualRow;
                 
                 // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-                // column d.
+                // column d. The lists are indexed by the position of the entry in the row.
                 std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
                 for (auto& backwardEntry : newBackwardEntries) {
                     backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
@@ -103,70 +105,64 @@ namespace storm {
                     FlexibleRowType& predecessorForwardTransitions = matrix.getRow(predecessor);
                     FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == column; });
                     
-                    // Make sure we have found the probability and set it to zero.
+                    // Make sure we have found the probability and remove the transition to the current state.
                     STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end(), storm::exceptions::InvalidStateException, "No probability for successor found.");
-                    ValueType multiplyFactor = multiplyElement->getValue();
-                    multiplyElement->setValue(storm::utility::zero<ValueType>());
-                    
-                    // At this point, we need to update the (forward) transitions of the predecessor.
-                    FlexibleRowIterator first1 = predecessorForwardTransitions.begin();
-                    FlexibleRowIterator last1 = predecessorForwardTransitions.end();
-                    FlexibleRowIterator first2 = entriesInRow.begin();
-                    FlexibleRowIterator last2 = entriesInRow.end();
-                    
-                    FlexibleRowType newSuccessors;
-                    newSuccessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+                    ValueType multiplyFactor = std::move(multiplyElement->getValue());
+                    predecessorForwardTransitions.erase(multiplyElement);
                     
-                    uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
-                    // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
-                    for (; first1 != last1; ++result) {
-                        // Skip the transitions to the state that is currently being eliminated.
-                        if (first1->getColumn() == column || (first2 != last2 && first2->getColumn() == column)) {
-                            if (first1->getColumn() == column) {
+                    // At this point, we need to update the (forward) transitions of the predecessor. To avoid allocating
+                    // a new row for every predecessor, we merge the (scaled) row of the current state into the row of
+                    // the predecessor in place. For this, we first determine how many entries the row gains and then
+                    // merge both rows from the back.
+                    uint_fast64_t numberOfNewEntries = 0;
+                    {
+                        FlexibleRowIterator first1 = predecessorForwardTransitions.begin();
+                        FlexibleRowIterator last1 = predecessorForwardTransitions.end();
+                        for (auto const& entry : entriesInRow) {
+                            if (entry.getColumn() == column) {
+                                continue;
+                            }
+                            while (first1 != last1 && first1->getColumn() < entry.getColumn()) {
                                 ++first1;
                             }
-                            if (first2 != last2 && first2->getColumn() == column) {
-                                ++first2;
+                            if (first1 == last1 || first1->getColumn() != entry.getColumn()) {
+                                ++numberOfNewEntries;
                             }
-                            continue;
                         }
+                    }
+                    
+                    uint_fast64_t remainingPredecessorEntries = predecessorForwardTransitions.size();
+                    uint_fast64_t remainingRowEntries = entriesInRow.size();
+                    predecessorForwardTransitions.resize(remainingPredecessorEntries + numberOfNewEntries);
+                    uint_fast64_t writePosition = predecessorForwardTransitions.size();
+                    while (remainingRowEntries > 0) {
+                        auto const& rowEntry = entriesInRow[remainingRowEntries - 1];
                         
-                        if (first2 == last2) {
-                            std::copy_if(first1, last1, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != column; } );
-                            break;
+                        // Skip the transitions to the state that is currently being eliminated.
+                        if (rowEntry.getColumn() == column) {
+                            --remainingRowEntries;
+                            continue;
                         }
-                        if (first2->getColumn() < first1->getColumn()) {
-                            auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = successorEntry;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
-                            ++first2;
-                            ++successorOffsetInNewBackwardTransitions;
-                        } else if (first1->getColumn() < first2->getColumn()) {
-                            *result = *first1;
-                            ++first1;
-                        } else {
-                            ValueType sprod = multiplyFactor * first2->getValue();
-                            ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
+                        
+                        if (remainingPredecessorEntries > 0 && predecessorForwardTransitions[remainingPredecessorEntries - 1].getColumn() > rowEntry.getColumn()) {
+                            predecessorForwardTransitions[--writePosition] = std::move(predecessorForwardTransitions[--remainingPredecessorEntries]);
+                        } else if (remainingPredecessorEntries > 0 && predecessorForwardTransitions[remainingPredecessorEntries - 1].getColumn() == rowEntry.getColumn()) {
+                            ValueType sprod = multiplyFactor * rowEntry.getValue();
+                            ValueType sum = predecessorForwardTransitions[remainingPredecessorEntries - 1].getValue() + storm::utility::simplify(sprod);
                             auto probability = storm::utility::simplify(sum);
-                            *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
-                            ++first1;
-                            ++first2;
-                            ++successorOffsetInNewBackwardTransitions;
-                        }
-                    }
-                    for (; first2 != last2; ++first2) {
-                        if (first2->getColumn() != column) {
-                            auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = stateProbability;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
-                            ++successorOffsetInNewBackwardTransitions;
+                            --remainingPredecessorEntries;
+                            predecessorForwardTransitions[--writePosition] = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(rowEntry.getColumn(), probability);
+                            newBackwardEntries[remainingRowEntries - 1].emplace_back(predecessor, probability);
+                            --remainingRowEntries;
+                        } else {
+                            auto successorEntry = storm::utility::simplify(std::move(rowEntry * multiplyFactor));
+                            newBackwardEntries[remainingRowEntries - 1].emplace_back(predecessor, successorEntry.getValue());
+                            predecessorForwardTransitions[--writePosition] = std::move(successorEntry);
+                            --remainingRowEntries;
                         }
                     }
+                    STORM_LOG_ASSERT(writePosition == remainingPredecessorEntries, "Merging the rows failed.");
                     
-                    // Now move the new transitions in place.
-                    predecessorForwardTransitions = std::move(newSuccessors);
                     STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
                     
                     updatePredecessor(predecessor, multiplyFactor, row);
@@ -176,8 +172,8 @@ namespace storm {
                 }
                 
                 // Finally, we need to add the predecessor to the set of predecessors of every successor.
-                uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
-                for (auto const& successorEntry : entriesInRow) {
+                for (uint_fast64_t successorOffset = 0; successorOffset < entriesInRow.size(); ++successorOffset) {
+                    auto const& successorEntry = entriesInRow[successorOffset];
                     if (successorEntry.getColumn() == column) {
                         continue;
                     }
@@ -192,46 +188,54 @@ namespace storm {
                         successorBackwardTransitions.erase(elimIt);
                     }
                     
-                    FlexibleRowIterator first1 = successorBackwardTransitions.begin();
-                    FlexibleRowIterator last1 = successorBackwardTransitions.end();
-                    FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
-                    FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
+                    // Drop the new predecessors that are not to be recorded. As before, the predecessor filter only
+                    // applies to the new predecessors beyond the last existing one.
+                    FlexibleRowType& newPredecessors = newBackwardEntries[successorOffset];
+                    bool filterNewPredecessors = isFilterPredecessor();
+                    storm::storage::sparse::state_type lastExistingPredecessor = successorBackwardTransitions.empty() ? 0 : successorBackwardTransitions.back().getColumn();
+                    newPredecessors.erase(std::remove_if(newPredecessors.begin(), newPredecessors.end(), [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == row || (filterNewPredecessors && (successorBackwardTransitions.empty() || a.getColumn() > lastExistingPredecessor) && !filterPredecessor(a.getColumn())); }), newPredecessors.end());
                     
-                    FlexibleRowType newPredecessors;
-                    newPredecessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
-                    
-                    for (; first1 != last1; ++result) {
-                        if (first2 == last2) {
-                            std::copy(first1, last1, result);
-                            break;
-                        }
-                        if (first2->getColumn() < first1->getColumn()) {
-                            if (first2->getColumn() != row) {
-                                *result = *first2;
+                    // As for the forward transitions, we merge the new predecessors into the existing ones in place.
+                    uint_fast64_t numberOfNewEntries = 0;
+                    {
+                        FlexibleRowIterator first1 = successorBackwardTransitions.begin();
+                        FlexibleRowIterator last1 = successorBackwardTransitions.end();
+                        for (auto const& entry : newPredecessors) {
+                            while (first1 != last1 && first1->getColumn() < entry.getColumn()) {
+                                ++first1;
                             }
-                            ++first2;
-                        } else if (first1->getColumn() == first2->getColumn()) {
-                            if (estimateComplexity(first1->getValue()) > estimateComplexity(first2->getValue())) {
-                                *result = *first1;
+                            if (first1 == last1 || first1->getColumn() != entry.getColumn()) {
+                                ++numberOfNewEntries;
+                            }
+                        }
+                    }
+                    
+                    uint_fast64_t remainingOldEntries = successorBackwardTransitions.size();
+                    uint_fast64_t remainingNewEntries = newPredecessors.size();
+                    successorBackwardTransitions.resize(remainingOldEntries + numberOfNewEntries);
+                    uint_fast64_t writePosition = successorBackwardTransitions.size();
+                    while (remainingNewEntries > 0) {
+                        auto& newEntry = newPredecessors[remainingNewEntries - 1];
+                        if (remainingOldEntries > 0 && successorBackwardTransitions[remainingOldEntries - 1].getColumn() > newEntry.getColumn()) {
+                            successorBackwardTransitions[--writePosition] = std::move(successorBackwardTransitions[--remainingOldEntries]);
+                        } else if (remainingOldEntries > 0 && successorBackwardTransitions[remainingOldEntries - 1].getColumn() == newEntry.getColumn()) {
+                            // Keep the value that is more complex and, if both are equally complex, the new one. The values
+                            // of the backward transitions are only used to estimate the cost of eliminating a state, which
+                            // should rather be over- than underestimated.
+                            --remainingOldEntries;
+                            --writePosition;
+                            if (estimateComplexity(successorBackwardTransitions[remainingOldEntries].getValue()) <= estimateComplexity(newEntry.getValue())) {
+                                successorBackwardTransitions[writePosition] = std::move(newEntry);
                             } else {
-                                *result = *first2;
+                                successorBackwardTransitions[writePosition] = std::move(successorBackwardTransitions[remainingOldEntries]);
                             }
-                            ++first1;
-                            ++first2;
+                            --remainingNewEntries;
                         } else {
-                            *result = *first1;
-                            ++first1;
+                            successorBackwardTransitions[--writePosition] = std::move(newEntry);
+                            --remainingNewEntries;
                         }
                     }
-                    if (isFilterPredecessor()) {
-                        std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row && filterPredecessor(a.getColumn()); });
-                    } else {
-                        std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row; });
-                    }
-                    // Now move the new predecessors in place.
-                    successorBackwardTransitions = std::move(newPredecessors);
-                    ++successorOffsetInNewBackwardTransitions;
+                    STORM_LOG_ASSERT(writePosition == remainingOldEntries, "Merging the predecessors failed.");
                 }
                 STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
                 
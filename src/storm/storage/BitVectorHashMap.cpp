@@ -80,6 +80,11 @@ namespace storm {
             return *currentSizeIterator;
         }
         
+        template<class ValueType, class Hash>
+        uint64_t BitVectorHashMap<ValueType, Hash>::getSizeInMemory() const {
+            return buckets.getSizeInBytes() + occupied.getSizeInBytes() + values.capacity() * sizeof(ValueType);
+        }
+        
         template<class ValueType, class Hash>
         void BitVectorHashMap<ValueType, Hash>::increaseSize() {
             ++currentSizeIterator;
@@ -220,6 +225,15 @@ namespace storm {
             return findBucket(key).first;
         }
 
+        template<class ValueType, class Hash>
+        boost::optional<ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+            std::pair<bool, std::size_t> flagBucketPair = findBucket(key, false);
+            if (flagBucketPair.first) {
+                return values[flagBucketPair.second];
+            }
+            return boost::none;
+        }
+
         template<class ValueType, class Hash>
         typename BitVectorHashMap<ValueType, Hash>::const_iterator BitVectorHashMap<ValueType, Hash>::begin() const {
             return const_iterator(*this, occupied.begin());
@@ -236,9 +250,11 @@ namespace storm {
         }
         
         template<class ValueType, class Hash>
-        std::pair<bool, std::size_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key) const {
+        std::pair<bool, std::size_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key, bool updateStatistics) const {
 #ifndef NDEBUG
-            ++numberOfFinds;
+            if (updateStatistics) {
+                ++numberOfFinds;
+            }
 #endif
             uint_fast64_t initialHash = hasher(key) % *currentSizeIterator;
             uint_fast64_t bucket = initialHash;
@@ -247,7 +263,9 @@ namespace storm {
             while (isBucketOccupied(bucket)) {
                 ++i;
 #ifndef NDEBUG
-                ++numberOfFindProbingSteps;
+                if (updateStatistics) {
+                    ++numberOfFindProbingSteps;
+                }
 #endif
                 if (buckets.matches(bucket * bucketSize, key)) {
                     return std::make_pair(true, bucket);
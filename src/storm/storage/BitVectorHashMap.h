@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <functional>
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/BitVector.h"
 
 namespace storm {
@@ -129,6 +131,15 @@ namespace storm {
              */
             bool contains(storm::storage::BitVector const& key) const;
 
+            /*!
+             * Searches for the given key in the map. As opposed to the other methods, this may be called by several
+             * threads at the same time (as long as the map is not modified concurrently).
+             *
+             * @param key The key to search.
+             * @return The value of the key if it is contained in the map and nothing otherwise.
+             */
+            boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
             /*!
              * Retrieves an iterator to the elements of the map.
              *
@@ -157,6 +168,13 @@ namespace storm {
              */
             std::size_t capacity() const;
             
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the map.
+             *
+             * @return The number of bytes occupied by the map.
+             */
+            uint64_t getSizeInMemory() const;
+            
             /*!
              * Performs a remapping of all values stored by applying the given remapping.
              *
@@ -177,10 +195,11 @@ namespace storm {
              * Searches for the bucket with the given key.
              *
              * @param key The key to search for.
+             * @param updateStatistics If set, the statistics (that are gathered in debug mode) are updated.
              * @return A pair whose first component indicates whether the key is already contained in the map and whose
              * second component indicates in which bucket the key is stored.
              */
-            std::pair<bool, std::size_t> findBucket(storm::storage::BitVector const& key) const;
+            std::pair<bool, std::size_t> findBucket(storm::storage::BitVector const& key, bool updateStatistics = true) const;
             
             /*!
              * Searches for the bucket into which the given key can be inserted. If no empty bucket can be found, the
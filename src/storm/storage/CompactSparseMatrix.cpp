@@ -0,0 +1,362 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm-config.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace {
+            // The number of rows whose values are computed by the vectorized kernels before their groups are reduced.
+            uint64_t const VECTORIZED_CHUNK_ROWS = 1024;
+
+            // The minimal number of rows of a group for the backward reduction to use the vectorized kernels.
+            uint64_t const VECTORIZED_MIN_GROUP_ROWS = 8;
+
+            template<typename ValueType, typename ColumnType>
+            bool multiplyRowsVectorized(kernels::SimdLevel, uint64_t const*, ColumnType const*, ValueType const*, ValueType const*, ValueType const*, ValueType*, uint64_t, uint64_t) {
+                // Vectorized kernels are only available for doubles.
+                return false;
+            }
+
+            template<typename ColumnType>
+            bool multiplyRowsVectorized(kernels::SimdLevel level, uint64_t const* rowIndications, ColumnType const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow) {
+                return kernels::multiplyRows(level, rowIndications, columns, values, x, summand, result, firstRow, endRow);
+            }
+        }
+
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType>::CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices) : rowCount(matrix.getRowCount()), columnCount(matrix.getColumnCount()), narrow(allowNarrowColumnIndices && fitsNarrowColumnIndices(matrix.getColumnCount())), simdLevel(kernels::getSupportedSimdLevel()) {
+            rowIndications.reserve(rowCount + 1);
+            values.reserve(matrix.getEntryCount());
+            if (narrow) {
+                narrowColumns.reserve(matrix.getEntryCount());
+            } else {
+                wideColumns.reserve(matrix.getEntryCount());
+            }
+
+            rowIndications.push_back(0);
+            for (index_type row = 0; row < rowCount; ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    if (narrow) {
+                        narrowColumns.push_back(static_cast<uint32_t>(entry.getColumn()));
+                    } else {
+                        wideColumns.push_back(entry.getColumn());
+                    }
+                    values.push_back(entry.getValue());
+                }
+                rowIndications.push_back(values.size());
+            }
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getRowCount() const {
+            return rowCount;
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        typename CompactSparseMatrix<ValueType>::index_type CompactSparseMatrix<ValueType>::getEntryCount() const {
+            return values.size();
+        }
+
+        template<typename ValueType>
+        std::vector<typename CompactSparseMatrix<ValueType>::index_type> const& CompactSparseMatrix<ValueType>::getRowIndications() const {
+            return rowIndications;
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::toStandardLayout(std::vector<index_type>& rowIndications, std::vector<MatrixEntry<index_type, value_type>>& columnsAndValues) const {
+            rowIndications = this->rowIndications;
+            columnsAndValues.clear();
+            columnsAndValues.reserve(values.size());
+            for (index_type entry = 0; entry < values.size(); ++entry) {
+                columnsAndValues.emplace_back(narrow ? static_cast<index_type>(narrowColumns[entry]) : wideColumns[entry], values[entry]);
+            }
+        }
+
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::hasNarrowColumnIndices() const {
+            return narrow;
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getSizeInMemory() const {
+            return rowIndications.size() * sizeof(index_type) + narrowColumns.size() * sizeof(uint32_t) + wideColumns.size() * sizeof(index_type) + values.size() * sizeof(value_type);
+        }
+
+        template<typename ValueType>
+        uint64_t CompactSparseMatrix<ValueType>::getSizeInMemory(index_type rowCount, index_type columnCount, index_type entryCount, bool allowNarrowColumnIndices) {
+            uint64_t columnSize = (allowNarrowColumnIndices && fitsNarrowColumnIndices(columnCount)) ? sizeof(uint32_t) : sizeof(index_type);
+            return (rowCount + 1) * sizeof(index_type) + entryCount * (columnSize + sizeof(value_type));
+        }
+
+        template<typename ValueType>
+        bool CompactSparseMatrix<ValueType>::fitsNarrowColumnIndices(index_type columnCount) {
+            return columnCount <= static_cast<index_type>(std::numeric_limits<uint32_t>::max()) + 1;
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::setSimdLevel(kernels::SimdLevel level) {
+            simdLevel = std::min(level, kernels::getSupportedSimdLevel());
+        }
+
+        template<typename ValueType>
+        kernels::SimdLevel CompactSparseMatrix<ValueType>::getSimdLevel() const {
+            return simdLevel;
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            multiplyWithVectorRange(0, rowCount, vector, result, summand);
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorRange(index_type firstRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            STORM_LOG_ASSERT(firstRow <= endRow && endRow <= rowCount, "Invalid row range.");
+            if (hasNarrowColumnIndices()) {
+                multiplyWithVectorForward(narrowColumns, firstRow, endRow, vector, result, summand);
+            } else {
+                multiplyWithVectorForward(wideColumns, firstRow, endRow, vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result || rowCount == columnCount, "In-place multiplication is only applicable for square matrices.");
+            if (hasNarrowColumnIndices()) {
+                multiplyWithVectorBackward(narrowColumns, vector, result, summand);
+            } else {
+                multiplyWithVectorBackward(wideColumns, vector, result, summand);
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduceRange(0, rowGroupIndices.size() - 1, dir, rowGroupIndices, vector, summand, result, choices);
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceRange(uint64_t firstGroup, uint64_t endGroup, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            STORM_LOG_ASSERT(firstGroup <= endGroup && endGroup < rowGroupIndices.size(), "Invalid row group range.");
+            if (hasNarrowColumnIndices()) {
+                multiplyAndReduceForward(narrowColumns, firstGroup, endGroup, dir, rowGroupIndices, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceForward(wideColumns, firstGroup, endGroup, dir, rowGroupIndices, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            if (hasNarrowColumnIndices()) {
+                multiplyAndReduceBackward(narrowColumns, dir, rowGroupIndices, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceBackward(wideColumns, dir, rowGroupIndices, vector, summand, result, choices);
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ColumnType> const& columns, index_type firstRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            if (simdLevel != kernels::SimdLevel::None && multiplyRowsVectorized(simdLevel, rowIndications.data(), columns.data(), values.data(), vector.data(), summand ? summand->data() : nullptr, result.data() + firstRow, firstRow, endRow)) {
+                return;
+            }
+
+            ColumnType const* columnIt = columns.data() + rowIndications[firstRow];
+            value_type const* valueIt = values.data() + rowIndications[firstRow];
+            value_type const* valueIte;
+            value_type const* valueBegin = values.data();
+
+            for (index_type row = firstRow; row < endRow; ++row) {
+                value_type newValue = summand ? (*summand)[row] : storm::utility::zero<value_type>();
+                for (valueIte = valueBegin + rowIndications[row + 1]; valueIt != valueIte; ++valueIt, ++columnIt) {
+                    newValue += *valueIt * vector[*columnIt];
+                }
+                result[row] = newValue;
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        void CompactSparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ColumnType> const& columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const {
+            // Iterate over the entries in reverse order, just as SparseMatrix::multiplyWithVectorBackward does. Every
+            // row depends on the rows treated before it if the vectors are aliased, so this stays scalar.
+            for (index_type row = rowCount; row > 0;) {
+                --row;
+                value_type newValue = summand ? (*summand)[row] : storm::utility::zero<value_type>();
+                for (index_type entry = rowIndications[row + 1]; entry > rowIndications[row];) {
+                    --entry;
+                    newValue += values[entry] * vector[columns[entry]];
+                }
+                result[row] = newValue;
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceForward(std::vector<ColumnType> const& columns, uint64_t firstGroup, uint64_t endGroup, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            if (simdLevel != kernels::SimdLevel::None && multiplyAndReduceVectorized(columns, firstGroup, endGroup, dir, rowGroupIndices, vector, summand, result, choices)) {
+                return;
+            }
+
+            bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+
+            for (uint64_t group = firstGroup; group < endGroup; ++group) {
+                uint64_t firstRow = rowGroupIndices[group];
+                uint64_t endRow = rowGroupIndices[group + 1];
+                value_type currentValue = storm::utility::zero<value_type>();
+                uint_fast64_t currentChoice = 0;
+
+                for (uint64_t row = firstRow; row < endRow; ++row) {
+                    value_type newValue = summand ? (*summand)[row] : storm::utility::zero<value_type>();
+                    for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                        newValue += values[entry] * vector[columns[entry]];
+                    }
+
+                    if (row == firstRow || (minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                        currentValue = newValue;
+                        currentChoice = row - firstRow;
+                    }
+                }
+
+                result[group] = currentValue;
+                if (choices) {
+                    (*choices)[group] = currentChoice;
+                }
+            }
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        bool CompactSparseMatrix<ValueType>::multiplyAndReduceVectorized(std::vector<ColumnType> const& columns, uint64_t firstGroup, uint64_t endGroup, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+            value_type const* summandData = summand ? summand->data() : nullptr;
+            std::vector<value_type> rowValues;
+
+            // Compute the values of the rows of a chunk of groups with the vectorized kernel and then reduce the groups
+            // of the chunk. This keeps the row values in cache while the reduction reads them.
+            for (uint64_t chunkFirstGroup = firstGroup; chunkFirstGroup < endGroup;) {
+                uint64_t chunkEndGroup = chunkFirstGroup + 1;
+                while (chunkEndGroup < endGroup && rowGroupIndices[chunkEndGroup + 1] - rowGroupIndices[chunkFirstGroup] <= VECTORIZED_CHUNK_ROWS) {
+                    ++chunkEndGroup;
+                }
+                uint64_t chunkFirstRow = rowGroupIndices[chunkFirstGroup];
+                uint64_t chunkEndRow = rowGroupIndices[chunkEndGroup];
+                rowValues.resize(std::max<uint64_t>(rowValues.size(), chunkEndRow - chunkFirstRow));
+                if (!multiplyRowsVectorized(simdLevel, rowIndications.data(), columns.data(), values.data(), vector.data(), summandData, rowValues.data(), chunkFirstRow, chunkEndRow)) {
+                    STORM_LOG_ASSERT(chunkFirstGroup == firstGroup, "Vectorized kernel became unavailable.");
+                    return false;
+                }
+
+                // The reduction has the same semantics as the scalar one: ties are resolved in favor of the lower row.
+                for (uint64_t group = chunkFirstGroup; group < chunkEndGroup; ++group) {
+                    value_type const* rowValueIt = rowValues.data() + (rowGroupIndices[group] - chunkFirstRow);
+                    value_type const* rowValueIte = rowValues.data() + (rowGroupIndices[group + 1] - chunkFirstRow);
+                    value_type currentValue = storm::utility::zero<value_type>();
+                    uint_fast64_t currentChoice = 0;
+                    if (rowValueIt != rowValueIte) {
+                        currentValue = *rowValueIt;
+                        for (uint_fast64_t choice = 1; rowValueIt + choice != rowValueIte; ++choice) {
+                            value_type const& newValue = rowValueIt[choice];
+                            bool better = minimize ? newValue < currentValue : newValue > currentValue;
+                            currentValue = better ? newValue : currentValue;
+                            currentChoice = better ? choice : currentChoice;
+                        }
+                    }
+
+                    result[group] = currentValue;
+                    if (choices) {
+                        (*choices)[group] = currentChoice;
+                    }
+                }
+                chunkFirstGroup = chunkEndGroup;
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        template<typename ColumnType>
+        void CompactSparseMatrix<ValueType>::multiplyAndReduceBackward(std::vector<ColumnType> const& columns, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const {
+            bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+            value_type const* summandData = summand ? summand->data() : nullptr;
+            std::vector<value_type> rowValues;
+
+            for (uint64_t group = rowGroupIndices.size() - 1; group > 0;) {
+                --group;
+                uint64_t firstRow = rowGroupIndices[group];
+                uint64_t endRow = rowGroupIndices[group + 1];
+                value_type currentValue = storm::utility::zero<value_type>();
+                uint_fast64_t currentChoice = 0;
+
+                // The rows of a group only read the vector and the group's value is written after all of them are
+                // computed, so the rows of large groups can be processed by the vectorized kernel even in place.
+                bool vectorized = false;
+                if (simdLevel != kernels::SimdLevel::None && endRow - firstRow >= VECTORIZED_MIN_GROUP_ROWS) {
+                    rowValues.resize(std::max<uint64_t>(rowValues.size(), endRow - firstRow));
+                    vectorized = multiplyRowsVectorized(simdLevel, rowIndications.data(), columns.data(), values.data(), vector.data(), summandData, rowValues.data(), firstRow, endRow);
+                }
+
+                // Like SparseMatrix::multiplyAndReduceBackward, rows are treated from the last to the first one, so
+                // ties are resolved in favor of the higher row.
+                for (uint64_t row = endRow; row > firstRow;) {
+                    --row;
+                    value_type newValue;
+                    if (vectorized) {
+                        newValue = rowValues[row - firstRow];
+                    } else {
+                        newValue = summand ? (*summand)[row] : storm::utility::zero<value_type>();
+                        for (index_type entry = rowIndications[row + 1]; entry > rowIndications[row];) {
+                            --entry;
+                            newValue += values[entry] * vector[columns[entry]];
+                        }
+                    }
+
+                    if (row + 1 == endRow || (minimize && newValue < currentValue) || (!minimize && newValue > currentValue)) {
+                        currentValue = newValue;
+                        currentChoice = row - firstRow;
+                    }
+                }
+
+                result[group] = currentValue;
+                if (choices) {
+                    (*choices)[group] = currentChoice;
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceRange(uint64_t, uint64_t, storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+
+        template<>
+        void CompactSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template class CompactSparseMatrix<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class CompactSparseMatrix<storm::RationalNumber>;
+        template class CompactSparseMatrix<storm::RationalFunction>;
+#endif
+    }
+}
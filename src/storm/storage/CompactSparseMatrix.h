@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A read-only sparse matrix in a structure-of-arrays layout. Instead of storing column-value pairs
+         * next to each other, columns and values are kept in separate arrays. If the number of columns permits it,
+         * column indices are stored with 32 bits, which (for double values) reduces the size of an entry from 16 to
+         * 12 bytes and lets the multiplication kernels stream columns and values independently.
+         *
+         * The multiplication methods mirror the ones of SparseMatrix and accumulate the entries in the same order,
+         * so that results are bitwise identical to the ones obtained on the original matrix. For double values, the
+         * forward multiplications (and the backward reduction of large row groups) use vectorized kernels that
+         * process several rows at once (see CompactSparseMatrixKernels.h) whenever the CPU supports them; the
+         * scalar kernels serve as fallback and can be enforced with setSimdLevel.
+         *
+         * Compact matrices are usually not used directly, but serve as the storage of a SparseMatrix (see
+         * SparseMatrix::createCompactLayout), whose multiplication methods then delegate to them.
+         */
+        template<typename ValueType>
+        class CompactSparseMatrix {
+        public:
+            typedef SparseMatrixIndexType index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Creates a compact copy of the given matrix.
+             *
+             * @param matrix The matrix to copy.
+             * @param allowNarrowColumnIndices If set, 32-bit column indices are used whenever the column count of the
+             * matrix permits it.
+             */
+            CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices = true);
+
+            index_type getRowCount() const;
+            index_type getColumnCount() const;
+            index_type getEntryCount() const;
+
+            /*!
+             * Retrieves the indices at which the rows begin in the column and value arrays.
+             */
+            std::vector<index_type> const& getRowIndications() const;
+
+            /*!
+             * Writes the entries of this matrix in the layout of SparseMatrix to the given vectors, which are
+             * overwritten.
+             *
+             * @param rowIndications The vector that holds the indices at which the rows begin after the operation.
+             * @param columnsAndValues The vector that holds the columns and values of the entries after the operation.
+             */
+            void toStandardLayout(std::vector<index_type>& rowIndications, std::vector<MatrixEntry<index_type, value_type>>& columnsAndValues) const;
+
+            /*!
+             * Retrieves whether the column indices of this matrix are stored with 32 bits.
+             */
+            bool hasNarrowColumnIndices() const;
+
+            /*!
+             * Retrieves the number of bytes occupied by the row indications, columns and values of this matrix.
+             */
+            uint64_t getSizeInMemory() const;
+
+            /*!
+             * Retrieves the number of bytes a compact matrix with the given dimensions occupies.
+             */
+            static uint64_t getSizeInMemory(index_type rowCount, index_type columnCount, index_type entryCount, bool allowNarrowColumnIndices = true);
+
+            /*!
+             * Retrieves whether the given column count can be represented with 32-bit column indices.
+             */
+            static bool fitsNarrowColumnIndices(index_type columnCount);
+
+            /*!
+             * Sets the instruction set extension that the forward multiplications may use. The level is capped at the
+             * one supported by the CPU. Setting it to none enforces the scalar kernels.
+             */
+            void setSimdLevel(kernels::SimdLevel level);
+
+            /*!
+             * Retrieves the instruction set extension that the forward multiplications use.
+             */
+            kernels::SimdLevel getSimdLevel() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector. The
+             * vector and the result must not be aliased.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Performs the same operation as multiplyWithVector, but only for the rows in [firstRow, endRow). The
+             * other entries of the result are left untouched, so that several ranges may be processed concurrently.
+             */
+            void multiplyWithVectorRange(index_type firstRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Performs the multiplication row by row from the last to the first row. The vector and the result may
+             * be aliased, in which case the vector is updated in place (Gauss-Seidel style).
+             */
+            void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, reduces the rows of each group with respect to the given
+             * direction and writes the result to the given result vector. The vector and the result must not be
+             * aliased.
+             *
+             * @param dir The direction for the reduction.
+             * @param rowGroupIndices The row groups to use for the reduction.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param choices If given, the choices made in the reduction process are written to this vector.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Performs the same operation as multiplyAndReduce, but only for the row groups in [firstGroup, endGroup).
+             * The other entries of the result (and the choices) are left untouched.
+             */
+            void multiplyAndReduceRange(uint64_t firstGroup, uint64_t endGroup, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Performs the multiplication and reduction group by group from the last to the first group. The vector
+             * and the result may be aliased, in which case the vector is updated in place (Gauss-Seidel style).
+             * Groups with many rows are multiplied with the vectorized kernels. These accumulate the entries of a row
+             * from the first to the last one whereas the scalar kernel (like SparseMatrix) uses the reverse order, so
+             * the results may differ in the last bits unless the vectorized kernels are disabled (see setSimdLevel).
+             */
+            void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+        private:
+            template<typename ColumnType>
+            void multiplyWithVectorForward(std::vector<ColumnType> const& columns, index_type firstRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+
+            template<typename ColumnType>
+            void multiplyWithVectorBackward(std::vector<ColumnType> const& columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+
+            template<typename ColumnType>
+            void multiplyAndReduceForward(std::vector<ColumnType> const& columns, uint64_t firstGroup, uint64_t endGroup, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<typename ColumnType>
+            bool multiplyAndReduceVectorized(std::vector<ColumnType> const& columns, uint64_t firstGroup, uint64_t endGroup, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            template<typename ColumnType>
+            void multiplyAndReduceBackward(std::vector<ColumnType> const& columns, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            // The number of rows of the matrix.
+            index_type rowCount;
+
+            // The number of columns of the matrix.
+            index_type columnCount;
+
+            // A flag indicating whether the column indices are stored with 32 bits.
+            bool narrow;
+
+            // The indices at which the rows begin in the column and value arrays.
+            std::vector<index_type> rowIndications;
+
+            // The column indices of the entries if they fit into 32 bits (otherwise empty).
+            std::vector<uint32_t> narrowColumns;
+
+            // The column indices of the entries if they do not fit into 32 bits (otherwise empty).
+            std::vector<index_type> wideColumns;
+
+            // The values of the entries.
+            std::vector<value_type> values;
+
+            // The instruction set extension used by the forward multiplications.
+            kernels::SimdLevel simdLevel;
+        };
+
+    }
+}
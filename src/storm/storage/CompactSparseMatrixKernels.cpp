@@ -0,0 +1,156 @@
+#include "storm/storage/CompactSparseMatrixKernels.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define STORM_HAVE_X86_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace storm {
+    namespace storage {
+        namespace kernels {
+
+            std::ostream& operator<<(std::ostream& out, SimdLevel const& level) {
+                switch (level) {
+                    case SimdLevel::None: out << "none"; break;
+                    case SimdLevel::Avx2: out << "avx2"; break;
+                    case SimdLevel::Avx512: out << "avx512"; break;
+                }
+                return out;
+            }
+
+            SimdLevel getSupportedSimdLevel() {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                static SimdLevel const level = [] () {
+                    __builtin_cpu_init();
+                    if (__builtin_cpu_supports("avx512f")) {
+                        return SimdLevel::Avx512;
+                    } else if (__builtin_cpu_supports("avx2")) {
+                        return SimdLevel::Avx2;
+                    }
+                    return SimdLevel::None;
+                }();
+                return level;
+#else
+                return SimdLevel::None;
+#endif
+            }
+
+            template<typename ColumnType>
+            void multiplyRowsScalar(uint64_t const* rowIndications, ColumnType const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t row, uint64_t endRow) {
+                for (; row < endRow; ++row) {
+                    double newValue = summand ? summand[row] : 0.0;
+                    for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                        newValue += values[entry] * x[columns[entry]];
+                    }
+                    result[row - firstRow] = newValue;
+                }
+            }
+
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+            __attribute__((target("avx2")))
+            inline __m256i gatherColumnsAvx2(uint32_t const* columns, __m256i offsets, __m256i mask) {
+                // Narrow the 64-bit lane mask to the 32-bit lanes expected by the gather.
+                __m128i narrowMask = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(mask, _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0)));
+                __m128i narrowColumns = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), reinterpret_cast<int const*>(columns), offsets, narrowMask, 4);
+                return _mm256_cvtepu32_epi64(narrowColumns);
+            }
+
+            __attribute__((target("avx2")))
+            inline __m256i gatherColumnsAvx2(uint64_t const* columns, __m256i offsets, __m256i mask) {
+                return _mm256_mask_i64gather_epi64(_mm256_setzero_si256(), reinterpret_cast<long long const*>(columns), offsets, mask, 8);
+            }
+
+            template<typename ColumnType>
+            __attribute__((target("avx2")))
+            void multiplyRowsAvx2(uint64_t const* rowIndications, ColumnType const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow) {
+                __m256i const one = _mm256_set1_epi64x(1);
+                uint64_t row = firstRow;
+                for (; row + 4 <= endRow; row += 4) {
+                    __m256i offsets = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(rowIndications + row));
+                    __m256i lengths = _mm256_sub_epi64(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(rowIndications + row + 1)), offsets);
+                    uint64_t maxLength = std::max(std::max(rowIndications[row + 1] - rowIndications[row], rowIndications[row + 2] - rowIndications[row + 1]), std::max(rowIndications[row + 3] - rowIndications[row + 2], rowIndications[row + 4] - rowIndications[row + 3]));
+
+                    __m256d accumulator = summand ? _mm256_loadu_pd(summand + row) : _mm256_setzero_pd();
+                    __m256i position = _mm256_setzero_si256();
+                    for (uint64_t step = 0; step < maxLength; ++step) {
+                        __m256i mask = _mm256_cmpgt_epi64(lengths, position);
+                        __m256d doubleMask = _mm256_castsi256_pd(mask);
+                        __m256d entryValues = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), values, offsets, doubleMask, 8);
+                        __m256i entryColumns = gatherColumnsAvx2(columns, offsets, mask);
+                        __m256d xValues = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), x, entryColumns, doubleMask, 8);
+                        accumulator = _mm256_blendv_pd(accumulator, _mm256_add_pd(accumulator, _mm256_mul_pd(entryValues, xValues)), doubleMask);
+                        offsets = _mm256_add_epi64(offsets, one);
+                        position = _mm256_add_epi64(position, one);
+                    }
+                    _mm256_storeu_pd(result + (row - firstRow), accumulator);
+                }
+                multiplyRowsScalar(rowIndications, columns, values, x, summand, result, firstRow, row, endRow);
+            }
+
+            __attribute__((target("avx512f")))
+            inline __m512i gatherColumnsAvx512(uint32_t const* columns, __m512i offsets, __mmask8 mask) {
+                return _mm512_cvtepu32_epi64(_mm512_mask_i64gather_epi32(_mm256_setzero_si256(), mask, offsets, columns, 4));
+            }
+
+            __attribute__((target("avx512f")))
+            inline __m512i gatherColumnsAvx512(uint64_t const* columns, __m512i offsets, __mmask8 mask) {
+                return _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask, offsets, columns, 8);
+            }
+
+            template<typename ColumnType>
+            __attribute__((target("avx512f")))
+            void multiplyRowsAvx512(uint64_t const* rowIndications, ColumnType const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow) {
+                __m512i const one = _mm512_set1_epi64(1);
+                uint64_t row = firstRow;
+                for (; row + 8 <= endRow; row += 8) {
+                    __m512i offsets = _mm512_loadu_si512(rowIndications + row);
+                    __m512i lengths = _mm512_sub_epi64(_mm512_loadu_si512(rowIndications + row + 1), offsets);
+                    uint64_t maxLength = _mm512_reduce_max_epu64(lengths);
+
+                    __m512d accumulator = summand ? _mm512_loadu_pd(summand + row) : _mm512_setzero_pd();
+                    __m512i position = _mm512_setzero_si512();
+                    for (uint64_t step = 0; step < maxLength; ++step) {
+                        __mmask8 mask = _mm512_cmpgt_epu64_mask(lengths, position);
+                        __m512d entryValues = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask, offsets, values, 8);
+                        __m512i entryColumns = gatherColumnsAvx512(columns, offsets, mask);
+                        __m512d xValues = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask, entryColumns, x, 8);
+                        accumulator = _mm512_mask_add_pd(accumulator, mask, accumulator, _mm512_mul_pd(entryValues, xValues));
+                        offsets = _mm512_add_epi64(offsets, one);
+                        position = _mm512_add_epi64(position, one);
+                    }
+                    _mm512_storeu_pd(result + (row - firstRow), accumulator);
+                }
+                multiplyRowsScalar(rowIndications, columns, values, x, summand, result, firstRow, row, endRow);
+            }
+#endif
+
+            template<typename ColumnType>
+            bool multiplyRowsDispatch(SimdLevel level, uint64_t const* rowIndications, ColumnType const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow) {
+#ifdef STORM_HAVE_X86_SIMD_KERNELS
+                switch (level) {
+                    case SimdLevel::Avx512:
+                        multiplyRowsAvx512(rowIndications, columns, values, x, summand, result, firstRow, endRow);
+                        return true;
+                    case SimdLevel::Avx2:
+                        multiplyRowsAvx2(rowIndications, columns, values, x, summand, result, firstRow, endRow);
+                        return true;
+                    case SimdLevel::None:
+                        break;
+                }
+#endif
+                return false;
+            }
+
+            bool multiplyRows(SimdLevel level, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow) {
+                return multiplyRowsDispatch(level, rowIndications, columns, values, x, summand, result, firstRow, endRow);
+            }
+
+            bool multiplyRows(SimdLevel level, uint64_t const* rowIndications, uint64_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow) {
+                return multiplyRowsDispatch(level, rowIndications, columns, values, x, summand, result, firstRow, endRow);
+            }
+
+        }
+    }
+}
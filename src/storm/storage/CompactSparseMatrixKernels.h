@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+namespace storm {
+    namespace storage {
+        namespace kernels {
+
+            /*!
+             * The vector instruction set extensions for which the multiplication kernels of compact matrices are
+             * available. The kernels stream columns and values from separate arrays, so they are only used for
+             * matrices in the compact layout (see CompactSparseMatrix); matrices in the standard layout, whose entries
+             * interleave columns and values, are always multiplied with the scalar kernels of SparseMatrix.
+             */
+            enum class SimdLevel { None, Avx2, Avx512 };
+
+            std::ostream& operator<<(std::ostream& out, SimdLevel const& level);
+
+            /*!
+             * Retrieves the most powerful instruction set extension that is supported both by the binary and by the
+             * CPU the program is running on. The result is determined once and then cached.
+             */
+            SimdLevel getSupportedSimdLevel();
+
+            /*!
+             * Computes the values summand[row] + (A * x)[row] of all rows in [firstRow, endRow) and writes them to
+             * result[row - firstRow]. Several rows are processed at once, one row per vector lane. Within each lane,
+             * the entries of the row are accumulated in the same order as the scalar kernels do, so that (as long as
+             * the compiler is not allowed to reassociate or contract floating point operations) the results are
+             * bitwise identical.
+             *
+             * @param level The extension to use. Must not exceed the level returned by getSupportedSimdLevel.
+             * @return False iff no vectorized kernel for the given level is available, in which case nothing is
+             * computed.
+             */
+            bool multiplyRows(SimdLevel level, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow);
+            bool multiplyRows(SimdLevel level, uint64_t const* rowIndications, uint64_t const* columns, double const* values, double const* x, double const* summand, double* result, uint64_t firstRow, uint64_t endRow);
+
+        }
+    }
+}
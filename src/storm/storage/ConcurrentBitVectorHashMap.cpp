@@ -0,0 +1,153 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <thread>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InternalException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::BUCKET_WRITTEN;
+
+        template<class ValueType, class Hash>
+        const uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::BUCKET_RESERVED;
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : bucketSize(bucketSize), loadFactor(loadFactor), logCapacity(1), numberOfElements(0), numberOfReservedElements(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_ASSERT(loadFactor > 0 && loadFactor < 1, "Illegal load factor.");
+            while ((1ull << logCapacity) * loadFactor < initialSize) {
+                ++logCapacity;
+            }
+
+            bucketStatus = std::vector<std::atomic<uint64_t>>(capacity());
+            buckets = storm::storage::BitVector(bucketSize * capacity());
+            values = std::vector<ValueType>(capacity());
+            maximalNumberOfElements = static_cast<uint64_t>(capacity() * loadFactor);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::computeHash(storm::storage::BitVector const& key) const {
+            // Spread the bits of the hash, because the bucket is determined by the highest bits.
+            uint64_t hash = static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+            return (hash | BUCKET_RESERVED) & ~BUCKET_WRITTEN;
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getInitialBucket(uint64_t hash) const {
+            return hash >> (64 - logCapacity);
+        }
+
+        template<class ValueType, class Hash>
+        boost::optional<std::pair<ValueType, bool>> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key) {
+            uint64_t hash = computeHash(key);
+            uint64_t mask = capacity() - 1;
+            uint64_t bucket = getInitialBucket(hash);
+
+            // Probe linearly until we either find the key or an empty bucket.
+            for (uint64_t step = 0; step < capacity(); ++step, bucket = (bucket + 1) & mask) {
+                uint64_t status = bucketStatus[bucket].load(std::memory_order_acquire);
+                if (status == 0) {
+                    // Reserve the space for the element before claiming the bucket. Several threads may pass a
+                    // check of the current size at the same time, so the reservation needs to be atomic.
+                    if (numberOfReservedElements.fetch_add(1, std::memory_order_relaxed) >= maximalNumberOfElements) {
+                        numberOfReservedElements.fetch_sub(1, std::memory_order_relaxed);
+                        return boost::none;
+                    }
+
+                    if (bucketStatus[bucket].compare_exchange_strong(status, hash, std::memory_order_acq_rel)) {
+                        // We reserved the bucket, so no other thread touches its key and value until we mark it as
+                        // written.
+                        buckets.set(bucket * bucketSize, key);
+                        ValueType value = static_cast<ValueType>(numberOfElements.fetch_add(1, std::memory_order_relaxed));
+                        values[bucket] = value;
+                        bucketStatus[bucket].store(hash | BUCKET_WRITTEN, std::memory_order_release);
+                        return std::make_pair(value, true);
+                    }
+
+                    // Otherwise, another thread reserved the bucket in the meantime and status now holds its status.
+                    numberOfReservedElements.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                if ((status & ~BUCKET_WRITTEN) == hash) {
+                    // The bucket may hold our key, but we can only compare the keys once it is completely written.
+                    while ((status & BUCKET_WRITTEN) == 0) {
+                        std::this_thread::yield();
+                        status = bucketStatus[bucket].load(std::memory_order_acquire);
+                    }
+                    if (buckets.matches(bucket * bucketSize, key)) {
+                        return std::make_pair(values[bucket], false);
+                    }
+                }
+            }
+
+            return boost::none;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::increaseSize() {
+            ++logCapacity;
+            STORM_LOG_THROW(logCapacity < 64, storm::exceptions::InternalException, "Hash map became to big.");
+            STORM_LOG_TRACE("Increasing size of concurrent hash map to " << capacity() << ".");
+
+            std::vector<std::atomic<uint64_t>> oldBucketStatus(capacity());
+            std::swap(oldBucketStatus, bucketStatus);
+            storm::storage::BitVector oldBuckets(bucketSize * capacity());
+            std::swap(oldBuckets, buckets);
+            std::vector<ValueType> oldValues(capacity());
+            std::swap(oldValues, values);
+            maximalNumberOfElements = static_cast<uint64_t>(capacity() * loadFactor);
+
+            // Reinsert all elements. Since there are no concurrent accesses, the statuses can be set directly.
+            uint64_t mask = capacity() - 1;
+            for (uint64_t oldBucket = 0; oldBucket < oldBucketStatus.size(); ++oldBucket) {
+                uint64_t status = oldBucketStatus[oldBucket].load(std::memory_order_relaxed);
+                if (status == 0) {
+                    continue;
+                }
+
+                uint64_t bucket = getInitialBucket(status);
+                while (bucketStatus[bucket].load(std::memory_order_relaxed) != 0) {
+                    bucket = (bucket + 1) & mask;
+                }
+                bucketStatus[bucket].store(status, std::memory_order_relaxed);
+                buckets.set(bucket * bucketSize, oldBuckets.get(oldBucket * bucketSize, bucketSize));
+                values[bucket] = oldValues[oldBucket];
+            }
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::clear() {
+            for (auto& status : bucketStatus) {
+                status.store(0, std::memory_order_relaxed);
+            }
+            numberOfElements.store(0);
+            numberOfReservedElements.store(0);
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::isBucketOccupied(uint64_t bucket) const {
+            return (bucketStatus[bucket].load(std::memory_order_acquire) & BUCKET_WRITTEN) != 0;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+            return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
+        }
+
+        template<class ValueType, class Hash>
+        std::size_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return numberOfElements.load();
+        }
+
+        template<class ValueType, class Hash>
+        std::size_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return 1ull << logCapacity;
+        }
+
+        template class ConcurrentBitVectorHashMap<uint_fast64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A hash map whose keys are bit vectors (of a length that is a multiple of 64) and that supports concurrent
+         * insertions without locks. Every key is mapped to the number of keys that were added before it, so the
+         * values form the range [0, size()). Since entries are never moved while inserting, the map cannot grow
+         * concurrently. Instead, insertions fail once the map is full and the owner needs to increase the size while
+         * no other thread accesses the map.
+         */
+        template<typename ValueType, typename Hash = std::hash<storm::storage::BitVector>>
+        class ConcurrentBitVectorHashMap {
+        public:
+            /*!
+             * Creates a new map with the given bucket size and initial capacity.
+             *
+             * @param bucketSize The number of bits of each key (must be a multiple of 64).
+             * @param initialSize The number of elements for which to reserve space.
+             * @param loadFactor The fraction of buckets that may be occupied before insertions fail.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+            /*!
+             * Searches for the given key and adds it if it is not yet contained. This method may be called by several
+             * threads at the same time.
+             *
+             * @param key The key to search or add.
+             * @return If the map is full and the key is not contained, nothing. Otherwise, the value of the key and a
+             * flag that indicates whether the key was added by this call.
+             */
+            boost::optional<std::pair<ValueType, bool>> findOrAdd(storm::storage::BitVector const& key);
+
+            /*!
+             * Doubles the number of buckets. This must not be called concurrently to any other method.
+             */
+            void increaseSize();
+
+            /*!
+             * Removes all elements from the map but keeps its capacity. This must not be called concurrently to any
+             * other method.
+             */
+            void clear();
+
+            /*!
+             * Checks whether the given bucket holds a value.
+             */
+            bool isBucketOccupied(uint64_t bucket) const;
+
+            /*!
+             * Retrieves the key and the value stored in the given (occupied) bucket.
+             */
+            std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+            /*!
+             * Retrieves the number of elements in the map.
+             */
+            std::size_t size() const;
+
+            /*!
+             * Retrieves the number of buckets of the map.
+             */
+            std::size_t capacity() const;
+
+        private:
+            /*!
+             * Computes the hash of the given key. The two lowest bits of the hash are reserved for the status of a bucket.
+             */
+            uint64_t computeHash(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Computes the bucket at which the search for a key with the given hash starts.
+             */
+            uint64_t getInitialBucket(uint64_t hash) const;
+
+            // The status of a bucket is zero if it is empty. Otherwise, it is the hash of its key (whose second lowest
+            // bit is always set) and the lowest bit indicates whether the key and the value were completely written.
+            static const uint64_t BUCKET_WRITTEN = 1;
+            static const uint64_t BUCKET_RESERVED = 2;
+
+            // The number of bits of each key.
+            uint64_t bucketSize;
+
+            // The fraction of buckets that may be occupied.
+            double loadFactor;
+
+            // The logarithm of the number of buckets.
+            uint64_t logCapacity;
+
+            // The number of elements that may be inserted before insertions fail.
+            uint64_t maximalNumberOfElements;
+
+            // The status of each bucket (see above).
+            std::vector<std::atomic<uint64_t>> bucketStatus;
+
+            // The keys stored in the buckets.
+            storm::storage::BitVector buckets;
+
+            // The values stored in the buckets.
+            std::vector<ValueType> values;
+
+            // The number of elements in the map.
+            std::atomic<uint64_t> numberOfElements;
+
+            // The number of elements in the map plus the number of insertions that are in progress. Insertions
+            // reserve their element here first, so the map never holds more than maximalNumberOfElements elements.
+            std::atomic<uint64_t> numberOfReservedElements;
+
+            // Functor object that is used to perform the actual hashing.
+            Hash hasher;
+        };
+
+    }
+}
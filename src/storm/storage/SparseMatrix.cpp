@@ -3,18 +3,17 @@
 // To detect whether the usage of TBB is possible, this include is neccessary
 #include "storm-config.h"
 
-#ifdef STORM_HAVE_INTELTBB
-#include "tbb/tbb.h"
-#endif
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -29,6 +28,85 @@
 namespace storm {
     namespace storage {
         
+        namespace {
+            // The compact layout is only available for doubles. For all other value types, a matrix never has a compact
+            // layout, so apart from the creation (which is rejected) the functions below are never called.
+            template<typename ValueType>
+            struct CompactLayout {
+                static std::shared_ptr<CompactSparseMatrix<ValueType> const> create(SparseMatrix<ValueType> const&, kernels::SimdLevel) {
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The compact matrix layout is only available for double matrices.");
+                    return nullptr;
+                }
+                
+                static kernels::SimdLevel getSimdLevel(CompactSparseMatrix<ValueType> const&) {
+                    return kernels::SimdLevel::None;
+                }
+                
+                static std::vector<uint64_t> const& getRowIndications(CompactSparseMatrix<ValueType> const&) {
+                    STORM_LOG_ASSERT(false, "Unexpected compact matrix layout.");
+                    static std::vector<uint64_t> const noRowIndications;
+                    return noRowIndications;
+                }
+                
+                static void toStandardLayout(CompactSparseMatrix<ValueType> const&, std::vector<uint64_t>&, std::vector<MatrixEntry<uint64_t, ValueType>>&) {
+                    STORM_LOG_ASSERT(false, "Unexpected compact matrix layout.");
+                }
+                
+                static void multiplyWithVectorRange(CompactSparseMatrix<ValueType> const&, uint64_t, uint64_t, std::vector<ValueType> const&, std::vector<ValueType>&, std::vector<ValueType> const*) {
+                    STORM_LOG_ASSERT(false, "Unexpected compact matrix layout.");
+                }
+                
+                static void multiplyWithVectorBackward(CompactSparseMatrix<ValueType> const&, std::vector<ValueType> const&, std::vector<ValueType>&, std::vector<ValueType> const*) {
+                    STORM_LOG_ASSERT(false, "Unexpected compact matrix layout.");
+                }
+                
+                static void multiplyAndReduceRange(CompactSparseMatrix<ValueType> const&, uint64_t, uint64_t, OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint_fast64_t>*) {
+                    STORM_LOG_ASSERT(false, "Unexpected compact matrix layout.");
+                }
+                
+                static void multiplyAndReduceBackward(CompactSparseMatrix<ValueType> const&, OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint_fast64_t>*) {
+                    STORM_LOG_ASSERT(false, "Unexpected compact matrix layout.");
+                }
+            };
+            
+            template<>
+            struct CompactLayout<double> {
+                static std::shared_ptr<CompactSparseMatrix<double> const> create(SparseMatrix<double> const& matrix, kernels::SimdLevel simdLevel) {
+                    auto result = std::make_shared<CompactSparseMatrix<double>>(matrix);
+                    result->setSimdLevel(simdLevel);
+                    return result;
+                }
+                
+                static kernels::SimdLevel getSimdLevel(CompactSparseMatrix<double> const& layout) {
+                    return layout.getSimdLevel();
+                }
+                
+                static std::vector<uint64_t> const& getRowIndications(CompactSparseMatrix<double> const& layout) {
+                    return layout.getRowIndications();
+                }
+                
+                static void toStandardLayout(CompactSparseMatrix<double> const& layout, std::vector<uint64_t>& rowIndications, std::vector<MatrixEntry<uint64_t, double>>& columnsAndValues) {
+                    layout.toStandardLayout(rowIndications, columnsAndValues);
+                }
+                
+                static void multiplyWithVectorRange(CompactSparseMatrix<double> const& layout, uint64_t firstRow, uint64_t endRow, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand) {
+                    layout.multiplyWithVectorRange(firstRow, endRow, vector, result, summand);
+                }
+                
+                static void multiplyWithVectorBackward(CompactSparseMatrix<double> const& layout, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand) {
+                    layout.multiplyWithVectorBackward(vector, result, summand);
+                }
+                
+                static void multiplyAndReduceRange(CompactSparseMatrix<double> const& layout, uint64_t firstGroup, uint64_t endGroup, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices) {
+                    layout.multiplyAndReduceRange(firstGroup, endGroup, dir, rowGroupIndices, vector, summand, result, choices);
+                }
+                
+                static void multiplyAndReduceBackward(CompactSparseMatrix<double> const& layout, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices) {
+                    layout.multiplyAndReduceBackward(dir, rowGroupIndices, vector, summand, result, choices);
+                }
+            };
+        }
+        
         template<typename IndexType, typename ValueType>
         MatrixEntry<IndexType, ValueType>::MatrixEntry(IndexType column, ValueType value) : entry(column, value) {
             // Intentionally left empty.
@@ -105,7 +183,11 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(std::move(matrix.columnsAndValues)), rowIndications(std::move(matrix.rowIndications)), currentEntryCount(matrix.entryCount), currentRowGroup() {
+        SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& matrix) :  initialRowCountSet(false), initialRowCount(0), initialColumnCountSet(false), initialColumnCount(0), initialEntryCountSet(false), initialEntryCount(0), forceInitialDimensions(false), hasCustomRowGrouping(!matrix.trivialRowGrouping), initialRowGroupCountSet(false), initialRowGroupCount(0), rowGroupIndices(), columnsAndValues(), rowIndications(), currentEntryCount(matrix.entryCount), currentRowGroup() {
+            // The entries are taken over, so the matrix must hold them in the standard layout.
+            matrix.dropCompactLayout();
+            columnsAndValues = std::move(matrix.columnsAndValues);
+            rowIndications = std::move(matrix.rowIndications);
             
             lastRow = matrix.rowCount == 0 ? 0 : matrix.rowCount - 1;
             lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
@@ -374,12 +456,17 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrix<ValueType>::SparseMatrix() : rowCount(0), columnCount(0), entryCount(0), nonzeroEntryCount(0), columnsAndValues(), rowIndications(), rowGroupIndices() {
+        SparseMatrix<ValueType>::SparseMatrix() : rowCount(0), columnCount(0), entryCount(0), nonzeroEntryCount(0), columnsAndValues(), rowIndications(), rowGroupIndices(), standardLayoutReleased(false) {
             // Intentionally left empty.
         }
         
         template<typename ValueType>
-        SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType> const& other) : rowCount(other.rowCount), columnCount(other.columnCount), entryCount(other.entryCount), nonzeroEntryCount(other.nonzeroEntryCount), columnsAndValues(other.columnsAndValues), rowIndications(other.rowIndications), trivialRowGrouping(other.trivialRowGrouping), rowGroupIndices(other.rowGroupIndices) {
+        SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType> const& other) : SparseMatrix(other, std::unique_lock<std::mutex>(other.standardLayoutMutex)) {
+            // Intentionally left empty.
+        }
+        
+        template<typename ValueType>
+        SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType> const& other, std::unique_lock<std::mutex> const&) : rowCount(other.rowCount), columnCount(other.columnCount), entryCount(other.entryCount), nonzeroEntryCount(other.nonzeroEntryCount), columnsAndValues(other.columnsAndValues), rowIndications(other.rowIndications), trivialRowGrouping(other.trivialRowGrouping), rowGroupIndices(other.rowGroupIndices), compactLayout(other.compactLayout), standardLayoutReleased(other.standardLayoutReleased.load()), requestedCompactLayout(other.requestedCompactLayout) {
             // Intentionally left empty.
         }
         
@@ -391,20 +478,21 @@ namespace storm {
         }
         
         template<typename ValueType>
-        SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType>&& other) : rowCount(other.rowCount), columnCount(other.columnCount), entryCount(other.entryCount), nonzeroEntryCount(other.nonzeroEntryCount), columnsAndValues(std::move(other.columnsAndValues)), rowIndications(std::move(other.rowIndications)), trivialRowGrouping(other.trivialRowGrouping), rowGroupIndices(std::move(other.rowGroupIndices)) {
+        SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType>&& other) : rowCount(other.rowCount), columnCount(other.columnCount), entryCount(other.entryCount), nonzeroEntryCount(other.nonzeroEntryCount), columnsAndValues(std::move(other.columnsAndValues)), rowIndications(std::move(other.rowIndications)), trivialRowGrouping(other.trivialRowGrouping), rowGroupIndices(std::move(other.rowGroupIndices)), compactLayout(std::move(other.compactLayout)), standardLayoutReleased(other.standardLayoutReleased.load()), requestedCompactLayout(other.requestedCompactLayout) {
             // Now update the source matrix
             other.rowCount = 0;
             other.columnCount = 0;
             other.entryCount = 0;
+            other.standardLayoutReleased = false;
         }
         
         template<typename ValueType>
-        SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_type> const& rowIndications, std::vector<MatrixEntry<index_type, ValueType>> const& columnsAndValues, boost::optional<std::vector<index_type>> const& rowGroupIndices) : rowCount(rowIndications.size() - 1), columnCount(columnCount), entryCount(columnsAndValues.size()), nonzeroEntryCount(0), columnsAndValues(columnsAndValues), rowIndications(rowIndications), trivialRowGrouping(!rowGroupIndices), rowGroupIndices(rowGroupIndices) {
+        SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_type> const& rowIndications, std::vector<MatrixEntry<index_type, ValueType>> const& columnsAndValues, boost::optional<std::vector<index_type>> const& rowGroupIndices) : rowCount(rowIndications.size() - 1), columnCount(columnCount), entryCount(columnsAndValues.size()), nonzeroEntryCount(0), columnsAndValues(columnsAndValues), rowIndications(rowIndications), trivialRowGrouping(!rowGroupIndices), rowGroupIndices(rowGroupIndices), standardLayoutReleased(false) {
             this->updateNonzeroEntryCount();
         }
         
         template<typename ValueType>
-        SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_type>&& rowIndications, std::vector<MatrixEntry<index_type, ValueType>>&& columnsAndValues, boost::optional<std::vector<index_type>>&& rowGroupIndices) : rowCount(rowIndications.size() - 1), columnCount(columnCount), entryCount(columnsAndValues.size()), nonzeroEntryCount(0), columnsAndValues(std::move(columnsAndValues)), rowIndications(std::move(rowIndications)), trivialRowGrouping(!rowGroupIndices), rowGroupIndices(std::move(rowGroupIndices)) {
+        SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_type>&& rowIndications, std::vector<MatrixEntry<index_type, ValueType>>&& columnsAndValues, boost::optional<std::vector<index_type>>&& rowGroupIndices) : rowCount(rowIndications.size() - 1), columnCount(columnCount), entryCount(columnsAndValues.size()), nonzeroEntryCount(0), columnsAndValues(std::move(columnsAndValues)), rowIndications(std::move(rowIndications)), trivialRowGrouping(!rowGroupIndices), rowGroupIndices(std::move(rowGroupIndices)), standardLayoutReleased(false) {
             this->updateNonzeroEntryCount();
         }
         
@@ -412,6 +500,7 @@ namespace storm {
         SparseMatrix<ValueType>& SparseMatrix<ValueType>::operator=(SparseMatrix<ValueType> const& other) {
             // Only perform assignment if source and target are not the same.
             if (this != &other) {
+                std::lock_guard<std::mutex> lock(other.standardLayoutMutex);
                 rowCount = other.rowCount;
                 columnCount = other.columnCount;
                 entryCount = other.entryCount;
@@ -421,6 +510,9 @@ namespace storm {
                 rowIndications = other.rowIndications;
                 rowGroupIndices = other.rowGroupIndices;
                 trivialRowGrouping = other.trivialRowGrouping;
+                compactLayout = other.compactLayout;
+                standardLayoutReleased = other.standardLayoutReleased.load();
+                requestedCompactLayout = other.requestedCompactLayout;
             }
             return *this;
         }
@@ -438,6 +530,10 @@ namespace storm {
                 rowIndications = std::move(other.rowIndications);
                 rowGroupIndices = std::move(other.rowGroupIndices);
                 trivialRowGrouping = other.trivialRowGrouping;
+                compactLayout = std::move(other.compactLayout);
+                standardLayoutReleased = other.standardLayoutReleased.load();
+                requestedCompactLayout = other.requestedCompactLayout;
+                other.standardLayoutReleased = false;
             }
             return *this;
         }
@@ -513,6 +609,7 @@ namespace storm {
         
         template<typename T>
         uint_fast64_t SparseMatrix<T>::getRowGroupEntryCount(uint_fast64_t const group) const {
+            ensureStandardLayout();
             uint_fast64_t result = 0;
             if (!this->hasTrivialRowGrouping()) {
                 for (uint_fast64_t row = this->getRowGroupIndices()[group]; row < this->getRowGroupIndices()[group + 1]; ++row) {
@@ -658,6 +755,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::makeRowDirac(index_type row, index_type column) {
+            dropCompactLayout();
             iterator columnValuePtr = this->begin(row);
             iterator columnValuePtrEnd = this->end(row);
             
@@ -713,6 +811,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::swapRows(index_type const& row1, index_type const& row2) {
+            dropCompactLayout();
             if (row1 == row2) {
                 return;
             }
@@ -853,7 +952,9 @@ namespace storm {
         template<typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(bool useGroups, storm::storage::BitVector const& rowConstraint, storm::storage::BitVector const& columnConstraint, bool insertDiagonalElements) const {
             if (useGroups) {
-                return getSubmatrix(rowConstraint, columnConstraint, this->getRowGroupIndices(), insertDiagonalElements);
+                auto res = getSubmatrix(rowConstraint, columnConstraint, this->getRowGroupIndices(), insertDiagonalElements);
+                passOnCompactLayoutRequest(res);
+                return res;
             } else {
                 // Create a fake row grouping to reduce this to a call to a more general method.
                 std::vector<index_type> fakeRowGroupIndices(rowCount + 1);
@@ -886,6 +987,7 @@ namespace storm {
                     res.rowGroupIndices = newRowGroupIndices;
                 }
                 
+                passOnCompactLayoutRequest(res);
                 return res;
             }
         }
@@ -1079,7 +1181,9 @@ namespace storm {
             }
             
             // Finalize created matrix and return result.
-            return matrixBuilder.build();
+            SparseMatrix<ValueType> result = matrixBuilder.build();
+            passOnCompactLayoutRequest(result);
+            return result;
         }
         
         template<typename ValueType>
@@ -1126,6 +1230,7 @@ namespace storm {
         
         template <typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool keepZeros) const {
+            ensureStandardLayout();
             index_type rowCount = this->getColumnCount();
             index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
             index_type entryCount;
@@ -1175,6 +1280,7 @@ namespace storm {
         
         template <typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::transposeSelectedRowsFromRowGroups(std::vector<uint_fast64_t> const& rowGroupChoices, bool keepZeros) const {
+            ensureStandardLayout();
             index_type rowCount = this->getColumnCount();
             index_type columnCount = this->getRowGroupCount();
             
@@ -1225,6 +1331,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::invertDiagonal() {
+            dropCompactLayout();
             // Now iterate over all row groups and set the diagonal elements to the inverted value.
             // If there is a row without the diagonal element, an exception is thrown.
             ValueType one = storm::utility::one<ValueType>();
@@ -1255,6 +1362,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::negateAllNonDiagonalEntries() {
+            dropCompactLayout();
             // Iterate over all row groups and negate all the elements that are not on the diagonal.
             for (index_type group = 0; group < this->getRowGroupCount(); ++group) {
                 for (auto& entry : this->getRowGroup(group)) {
@@ -1267,6 +1375,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::deleteDiagonalEntries() {
+            dropCompactLayout();
             // Iterate over all rows and negate all the elements that are not on the diagonal.
             for (index_type group = 0; group < this->getRowGroupCount(); ++group) {
                 for (auto& entry : this->getRowGroup(group)) {
@@ -1297,7 +1406,9 @@ namespace storm {
                 }
             }
             
-            return std::make_pair(luBuilder.build(), std::move(invertedDiagonal));
+            SparseMatrix<ValueType> lu = luBuilder.build();
+            passOnCompactLayoutRequest(lu);
+            return std::make_pair(std::move(lu), std::move(invertedDiagonal));
         }
         
 #ifdef STORM_HAVE_CARL
@@ -1361,6 +1472,11 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            if (compactLayout) {
+                CompactLayout<ValueType>::multiplyWithVectorRange(*compactLayout, 0, result.size(), vector, result, summand);
+                return;
+            }
+            
             const_iterator it = this->begin();
             const_iterator ite;
             std::vector<index_type>::const_iterator rowIterator = rowIndications.begin();
@@ -1389,6 +1505,11 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            if (compactLayout) {
+                CompactLayout<ValueType>::multiplyWithVectorBackward(*compactLayout, vector, result, summand);
+                return;
+            }
+            
             const_iterator it = this->end() - 1;
             const_iterator ite;
             std::vector<index_type>::const_iterator rowIterator = rowIndications.end() - 2;
@@ -1415,21 +1536,18 @@ namespace storm {
             }
         }
         
-#ifdef STORM_HAVE_INTELTBB
         template <typename ValueType>
-        class TbbMultAddFunctor {
+        class MultAddRangeFunctor {
         public:
             typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
             
-            TbbMultAddFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand) : columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand) {
+            MultAddRangeFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand) : columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand) {
                 // Intentionally left empty.
             }
             
-            void operator()(tbb::blocked_range<index_type> const& range) const {
-                index_type startRow = range.begin();
-                index_type endRow = range.end();
+            void operator()(index_type startRow, index_type endRow) const {
                 typename std::vector<index_type>::const_iterator rowIterator = rowIndications.begin() + startRow;
                 const_iterator it = columnsAndEntries.begin() + *rowIterator;
                 const_iterator ite;
@@ -1466,11 +1584,105 @@ namespace storm {
                 std::vector<ValueType> tmpVector(this->getRowCount());
                 multiplyWithVectorParallel(vector, tmpVector);
                 result = std::move(tmpVector);
+            } else if (!storm::utility::ThreadPool::supportsParallelComputations<ValueType>()) {
+                // The arithmetic of this value type must not be used from several threads at once.
+                multiplyWithVectorForward(vector, result, summand);
             } else {
-                tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 10), TbbMultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand));
+                // Balance the work by the number of entries rather than the number of rows.
+                if (compactLayout) {
+                    CompactSparseMatrix<ValueType> const& layout = *compactLayout;
+                    std::vector<index_type> const& layoutRowIndications = CompactLayout<ValueType>::getRowIndications(layout);
+                    auto rowWeight = [&layoutRowIndications] (uint64_t row) { return layoutRowIndications[row] + row; };
+                    storm::utility::ThreadPool::getGlobalPool().parallelFor(result.size(), rowWeight, [&] (uint64_t startRow, uint64_t endRow) { CompactLayout<ValueType>::multiplyWithVectorRange(layout, startRow, endRow, vector, result, summand); });
+                } else {
+                    auto rowWeight = [this] (uint64_t row) { return rowIndications[row] + row; };
+                    storm::utility::ThreadPool::getGlobalPool().parallelFor(result.size(), rowWeight, MultAddRangeFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand));
+                }
             }
         }
-#endif
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::createCompactLayout(storm::storage::kernels::SimdLevel simdLevel) {
+            ensureStandardLayout();
+            compactLayout = CompactLayout<ValueType>::create(*this, simdLevel);
+            requestedCompactLayout = simdLevel;
+            
+            // From now on, the compact layout is the storage of the entries.
+            std::vector<MatrixEntry<index_type, value_type>>().swap(columnsAndValues);
+            std::vector<index_type>().swap(rowIndications);
+            standardLayoutReleased = true;
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::requestCompactLayout(storm::storage::kernels::SimdLevel simdLevel) {
+            STORM_LOG_THROW(isCompactLayoutSupported(), storm::exceptions::NotSupportedException, "The compact matrix layout is only available for double matrices.");
+            requestedCompactLayout = simdLevel;
+        }
+        
+        template<typename ValueType>
+        bool SparseMatrix<ValueType>::isCompactLayoutRequested() const {
+            return static_cast<bool>(requestedCompactLayout);
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::createRequestedCompactLayout() {
+            if (requestedCompactLayout && !compactLayout) {
+                STORM_LOG_DEBUG("Converting " << rowCount << "x" << columnCount << " matrix with " << entryCount << " entries to the compact layout.");
+                createCompactLayout(requestedCompactLayout.get());
+            }
+        }
+        
+        template<typename ValueType>
+        bool SparseMatrix<ValueType>::hasCompactLayout() const {
+            return static_cast<bool>(compactLayout);
+        }
+        
+        template<typename ValueType>
+        bool SparseMatrix<ValueType>::isStandardLayoutReleased() const {
+            return standardLayoutReleased.load();
+        }
+        
+        template<typename ValueType>
+        CompactSparseMatrix<ValueType> const& SparseMatrix<ValueType>::getCompactLayout() const {
+            STORM_LOG_ASSERT(compactLayout, "Matrix has no compact layout.");
+            return *compactLayout;
+        }
+        
+        template<typename ValueType>
+        bool SparseMatrix<ValueType>::isCompactLayoutSupported() {
+            return std::is_same<ValueType, double>::value;
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::dropCompactLayout() {
+            if (compactLayout) {
+                STORM_LOG_INFO("Dropping the compact layout of a " << rowCount << "x" << columnCount << " matrix with " << entryCount << " entries, because its entries may be changed. Its multiplications use the standard layout from now on.");
+                ensureStandardLayout();
+                compactLayout.reset();
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::ensureStandardLayout() const {
+            if (standardLayoutReleased.load(std::memory_order_acquire)) {
+                restoreStandardLayout();
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::restoreStandardLayout() const {
+            std::lock_guard<std::mutex> lock(standardLayoutMutex);
+            if (standardLayoutReleased.load(std::memory_order_relaxed)) {
+                STORM_LOG_INFO("Restoring the standard layout of a " << rowCount << "x" << columnCount << " matrix with " << entryCount << " entries, because its rows are accessed. The matrix is kept in both layouts from now on.");
+                CompactLayout<ValueType>::toStandardLayout(*compactLayout, rowIndications, columnsAndValues);
+                standardLayoutReleased.store(false, std::memory_order_release);
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::passOnCompactLayoutRequest(SparseMatrix<value_type>& derivedMatrix) const {
+            derivedMatrix.requestedCompactLayout = requestedCompactLayout;
+        }
         
         template<typename ValueType>
         ValueType SparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
@@ -1484,6 +1696,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            ensureStandardLayout();
             const_iterator it = this->end() - 1;
             const_iterator ite;
             std::vector<index_type>::const_iterator rowIterator = rowIndications.end() - 2;
@@ -1518,6 +1731,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::performWalkerChaeStep(std::vector<ValueType> const& x, std::vector<ValueType> const& columnSums, std::vector<ValueType> const& b, std::vector<ValueType> const& ax, std::vector<ValueType>& result) const {
+            ensureStandardLayout();
             const_iterator it = this->begin();
             const_iterator ite;
             std::vector<index_type>::const_iterator rowIterator = rowIndications.begin();
@@ -1552,6 +1766,11 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduceForward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (compactLayout) {
+                CompactLayout<ValueType>::multiplyAndReduceRange(*compactLayout, 0, result.size(), dir, rowGroupIndices, vector, summand, result, choices);
+                return;
+            }
+            
             auto elementIt = this->begin();
             auto rowGroupIt = rowGroupIndices.begin();
             auto rowIt = rowIndications.begin();
@@ -1617,6 +1836,11 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduceBackward(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (compactLayout) {
+                CompactLayout<ValueType>::multiplyAndReduceBackward(*compactLayout, dir, rowGroupIndices, vector, summand, result, choices);
+                return;
+            }
+            
             auto elementIt = this->end() - 1;
             auto rowGroupIt = rowGroupIndices.end() - 2;
             auto rowIt = rowIndications.end() - 2;
@@ -1677,21 +1901,20 @@ namespace storm {
         }
 #endif
         
-#ifdef STORM_HAVE_INTELTBB
         template <typename ValueType>
-        class TbbMultAddReduceFunctor {
+        class MultAddReduceRangeFunctor {
         public:
             typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
             typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
             
-            TbbMultAddReduceFunctor(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand, std::vector<uint_fast64_t>* choices) : dir(dir), rowGroupIndices(rowGroupIndices), columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand), choices(choices) {
+            MultAddReduceRangeFunctor(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand, std::vector<uint_fast64_t>* choices) : dir(dir), rowGroupIndices(rowGroupIndices), columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand), choices(choices) {
                 // Intentionally left empty.
             }
             
-            void operator()(tbb::blocked_range<index_type> const& range) const {
-                auto groupIt = rowGroupIndices.begin() + range.begin();
-                auto groupIte = rowGroupIndices.begin() + range.end();
+            void operator()(index_type startGroup, index_type endGroup) const {
+                auto groupIt = rowGroupIndices.begin() + startGroup;
+                auto groupIte = rowGroupIndices.begin() + endGroup;
                 
                 auto rowIt = rowIndications.begin() + *groupIt;
                 auto elementIt = columnsAndEntries.begin() + *rowIt;
@@ -1701,10 +1924,10 @@ namespace storm {
                 }
                 typename std::vector<uint_fast64_t>::iterator choiceIt;
                 if (choices) {
-                    choiceIt = choices->begin() + range.begin();
+                    choiceIt = choices->begin() + startGroup;
                 }
                 
-                auto resultIt = result.begin() + range.begin();
+                auto resultIt = result.begin() + startGroup;
                 
                 for (; groupIt != groupIte; ++groupIt, ++resultIt, ++choiceIt) {
                     if (choices) {
@@ -1759,7 +1982,22 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
-            tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 10), TbbMultAddReduceFunctor<ValueType>(dir, rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices));
+            if (!storm::utility::ThreadPool::supportsParallelComputations<ValueType>()) {
+                // The arithmetic of this value type must not be used from several threads at once.
+                multiplyAndReduceForward(dir, rowGroupIndices, vector, summand, result, choices);
+                return;
+            }
+            
+            // Balance the work by the number of entries and rows rather than the number of groups.
+            if (compactLayout) {
+                CompactSparseMatrix<ValueType> const& layout = *compactLayout;
+                std::vector<index_type> const& layoutRowIndications = CompactLayout<ValueType>::getRowIndications(layout);
+                auto groupWeight = [&layoutRowIndications, &rowGroupIndices] (uint64_t group) { return layoutRowIndications[rowGroupIndices[group]] + rowGroupIndices[group]; };
+                storm::utility::ThreadPool::getGlobalPool().parallelFor(rowGroupIndices.size() - 1, groupWeight, [&] (uint64_t startGroup, uint64_t endGroup) { CompactLayout<ValueType>::multiplyAndReduceRange(layout, startGroup, endGroup, dir, rowGroupIndices, vector, summand, result, choices); });
+            } else {
+                auto groupWeight = [this, &rowGroupIndices] (uint64_t group) { return rowIndications[rowGroupIndices[group]] + rowGroupIndices[group]; };
+                storm::utility::ThreadPool::getGlobalPool().parallelFor(rowGroupIndices.size() - 1, groupWeight, MultAddReduceRangeFunctor<ValueType>(dir, rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices));
+            }
         }
         
 #ifdef STORM_HAVE_CARL
@@ -1768,6 +2006,80 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
         }
 #endif
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorBlock(uint64_t blockSize, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            ensureStandardLayout();
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            STORM_LOG_ASSERT(vector.size() == this->getColumnCount() * blockSize, "Vector has unexpected size.");
+            STORM_LOG_ASSERT(result.size() == this->getRowCount() * blockSize, "Result vector has unexpected size.");
+            
+            const_iterator it = this->begin();
+            const_iterator ite;
+            auto resultIt = result.begin();
+            for (index_type row = 0; row < this->getRowCount(); ++row, resultIt += blockSize) {
+                if (summand) {
+                    std::copy(summand->begin() + row * blockSize, summand->begin() + (row + 1) * blockSize, resultIt);
+                } else {
+                    std::fill(resultIt, resultIt + blockSize, storm::utility::zero<ValueType>());
+                }
+                
+                for (ite = this->begin() + rowIndications[row + 1]; it != ite; ++it) {
+                    ValueType const& value = it->getValue();
+                    auto vectorIt = vector.begin() + it->getColumn() * blockSize;
+                    for (uint64_t i = 0; i < blockSize; ++i) {
+                        resultIt[i] += value * vectorIt[i];
+                    }
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t blockSize, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            STORM_LOG_ASSERT(result.size() == (rowGroupIndices.size() - 1) * blockSize, "Result vector has unexpected size.");
+            
+            // Computes the values of the given row for all vectors of the block.
+            auto multiplyRow = [&] (index_type row, typename std::vector<ValueType>::iterator target) {
+                if (summand) {
+                    std::copy(summand->begin() + row * blockSize, summand->begin() + (row + 1) * blockSize, target);
+                } else {
+                    std::fill(target, target + blockSize, storm::utility::zero<ValueType>());
+                }
+                for (auto const& entry : this->getRow(row)) {
+                    auto vectorIt = vector.begin() + entry.getColumn() * blockSize;
+                    for (uint64_t i = 0; i < blockSize; ++i) {
+                        target[i] += entry.getValue() * vectorIt[i];
+                    }
+                }
+            };
+            
+            std::vector<ValueType> rowValues(blockSize);
+            auto resultIt = result.begin();
+            for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group, resultIt += blockSize) {
+                // Only multiply and reduce if there is at least one row in the group.
+                if (rowGroupIndices[group] == rowGroupIndices[group + 1]) {
+                    std::fill(resultIt, resultIt + blockSize, storm::utility::zero<ValueType>());
+                    continue;
+                }
+                
+                multiplyRow(rowGroupIndices[group], resultIt);
+                for (index_type row = rowGroupIndices[group] + 1; row < rowGroupIndices[group + 1]; ++row) {
+                    multiplyRow(row, rowValues.begin());
+                    for (uint64_t i = 0; i < blockSize; ++i) {
+                        if ((dir == OptimizationDirection::Minimize && rowValues[i] < resultIt[i]) || (dir == OptimizationDirection::Maximize && rowValues[i] > resultIt[i])) {
+                            resultIt[i] = rowValues[i];
+                        }
+                    }
+                }
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t blockSize, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* summand, std::vector<storm::RationalFunction>& result) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
 #endif
         
         template<typename ValueType>
@@ -1793,6 +2105,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyVectorWithMatrix(std::vector<value_type> const& vector, std::vector<value_type>& result) const {
+            ensureStandardLayout();
             const_iterator it = this->begin();
             const_iterator ite;
             std::vector<index_type>::const_iterator rowIterator = rowIndications.begin();
@@ -1809,6 +2122,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::scaleRowsInPlace(std::vector<ValueType> const& factors) {
+            dropCompactLayout();
             STORM_LOG_ASSERT(factors.size() == this->getRowCount(), "Can not scale rows: Number of rows and number of scaling factors do not match.");
             uint_fast64_t row = 0;
             for (auto const& factor : factors) {
@@ -1821,6 +2135,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::divideRowsInPlace(std::vector<ValueType> const& divisors) {
+            dropCompactLayout();
             STORM_LOG_ASSERT(divisors.size() == this->getRowCount(), "Can not divide rows: Number of rows and number of divisors do not match.");
             uint_fast64_t row = 0;
             for (auto const& divisor : divisors) {
@@ -1841,11 +2156,13 @@ namespace storm {
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::const_rows SparseMatrix<ValueType>::getRows(index_type startRow, index_type endRow) const {
+            ensureStandardLayout();
             return const_rows(this->columnsAndValues.begin() + this->rowIndications[startRow], this->rowIndications[endRow] - this->rowIndications[startRow]);
         }
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::rows SparseMatrix<ValueType>::getRows(index_type startRow, index_type endRow) {
+            dropCompactLayout();
             return rows(this->columnsAndValues.begin() + this->rowIndications[startRow], this->rowIndications[endRow] - this->rowIndications[startRow]);
         }
         
@@ -1905,31 +2222,37 @@ namespace storm {
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::const_iterator SparseMatrix<ValueType>::begin(index_type row) const {
+            ensureStandardLayout();
             return this->columnsAndValues.begin() + this->rowIndications[row];
         }
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::iterator SparseMatrix<ValueType>::begin(index_type row)  {
+            dropCompactLayout();
             return this->columnsAndValues.begin() + this->rowIndications[row];
         }
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::const_iterator SparseMatrix<ValueType>::end(index_type row) const {
+            ensureStandardLayout();
             return this->columnsAndValues.begin() + this->rowIndications[row + 1];
         }
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::iterator SparseMatrix<ValueType>::end(index_type row)  {
+            dropCompactLayout();
             return this->columnsAndValues.begin() + this->rowIndications[row + 1];
         }
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::const_iterator SparseMatrix<ValueType>::end() const {
+            ensureStandardLayout();
             return this->columnsAndValues.begin() + this->rowIndications[rowCount];
         }
         
         template<typename ValueType>
         typename SparseMatrix<ValueType>::iterator SparseMatrix<ValueType>::end()  {
+            dropCompactLayout();
             return this->columnsAndValues.begin() + this->rowIndications[rowCount];
         }
 
@@ -2060,6 +2383,7 @@ namespace storm {
         
         template<typename ValueType>
         void SparseMatrix<ValueType>::printAsMatlabMatrix(std::ostream& out) const {
+            ensureStandardLayout();
             // Iterate over all row groups.
             for (typename SparseMatrix<ValueType>::index_type group = 0; group < this->getRowGroupCount(); ++group) {
                 STORM_LOG_ASSERT(this->getRowGroupSize(group) == 1, "Incorrect row group size.");
@@ -2085,6 +2409,7 @@ namespace storm {
         
         template<typename ValueType>
         std::size_t SparseMatrix<ValueType>::hash() const {
+            ensureStandardLayout();
             std::size_t result = 0;
             
             boost::hash_combine(result, this->getRowCount());
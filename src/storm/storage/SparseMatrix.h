@@ -2,15 +2,19 @@
 #define STORM_STORAGE_SPARSEMATRIX_H_
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <cstdint>
 #include <vector>
 #include <iterator>
+#include <memory>
+#include <mutex>
 
 #include <boost/functional/hash.hpp>
 #include <boost/optional.hpp>
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/CompactSparseMatrixKernels.h"
 
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/macros.h"
@@ -40,6 +44,9 @@ namespace storm {
         template<typename T>
         class SparseMatrix;
         
+        template<typename T>
+        class CompactSparseMatrix;
+        
         typedef uint_fast64_t SparseMatrixIndexType;
         
         template<typename IndexType, typename ValueType>
@@ -270,14 +277,15 @@ namespace storm {
             // The vector that stores the row-group indices (if they are non-trivial).
             boost::optional<std::vector<index_type>> rowGroupIndices;
             
-            // The storage for the columns and values of all entries in the matrix.
-            std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
+            // The storage for the columns and values of all entries in the matrix. This needs to be mutable, because
+            // it is restored on-the-fly if it was released in favor of the compact layout.
+            mutable std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
             
             // A vector containing the indices at which each given row begins. This index is to be interpreted as an
             // index in the valueStorage and the columnIndications vectors. Put differently, the values of the entries
             // in row i are valueStorage[rowIndications[i]] to valueStorage[rowIndications[i + 1]] where the last
-            // entry is not included anymore.
-            std::vector<index_type> rowIndications;
+            // entry is not included anymore. Like columnsAndValues, this is restored on-the-fly if it was released.
+            mutable std::vector<index_type> rowIndications;
             
             // Stores the current number of entries in the matrix. This is used for inserting an entry into a matrix
             // with preallocated storage.
@@ -819,9 +827,12 @@ namespace storm {
             
             void multiplyWithVectorForward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
             void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
-#ifdef STORM_HAVE_INTELTBB
+            
+            /*!
+             * Performs the same operation as multiplyWithVector, but distributes the rows among the threads of the
+             * global thread pool (see storm::utility::ThreadPool).
+             */
             void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
-#endif
             
             /*!
              * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
@@ -839,10 +850,87 @@ namespace storm {
             
             void multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
             void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
-#ifdef STORM_HAVE_INTELTBB
+            
+            /*!
+             * Performs the same operation as multiplyAndReduce, but distributes the row groups among the threads of
+             * the global thread pool (see storm::utility::ThreadPool).
+             */
             void multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
-#endif
 
+            /*!
+             * Multiplies the matrix with a block of vectors at once. The vectors are stored interleaved, i.e. entry j
+             * of the i-th vector is located at position i + j * blockSize. Compared to multiplying the vectors one
+             * after another, every matrix entry is only loaded once.
+             *
+             * @param blockSize The number of vectors in the block.
+             * @param vector The interleaved vectors with which to multiply the matrix. Must not alias the result.
+             * @param result The interleaved vectors that hold the result of the multiplication after the operation.
+             * @param summand If given, these interleaved vectors will be added to the result of the multiplication.
+             */
+            void multiplyWithVectorBlock(uint64_t blockSize, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            
+            /*!
+             * Performs the same operation as multiplyAndReduce on a block of interleaved vectors (see
+             * multiplyWithVectorBlock). The reduction is done for each of the vectors independently.
+             */
+            void multiplyAndReduceBlock(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, uint64_t blockSize, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result) const;
+
+            /*!
+             * Converts the entries of this matrix to the compact layout (see CompactSparseMatrix), which from then on
+             * is their storage: the standard layout is released and the multiplication methods (multiplyWithVector,
+             * multiplyAndReduce and their forward, backward and parallel variants) operate on the compact layout.
+             * Methods that access the rows restore the standard layout on first use, which is logged and keeps both
+             * layouts in memory. Methods that permit changing the entries drop the compact layout. The compact layout
+             * is shared among copies of this matrix and is only supported for double matrices (see
+             * isCompactLayoutSupported).
+             *
+             * @param simdLevel The most powerful vector instruction set extension the multiplications may use. With
+             * SimdLevel::None, the scalar kernels are used, whose results coincide bitwise with the ones obtained
+             * without the compact layout.
+             */
+            void createCompactLayout(storm::storage::kernels::SimdLevel simdLevel);
+            
+            /*!
+             * Requests the compact layout for this matrix and the matrices derived from it (for example its
+             * submatrices) without converting any entries. Solvers that only multiply with a matrix they own convert
+             * it if it carries such a request (see createRequestedCompactLayout).
+             *
+             * @param simdLevel The most powerful vector instruction set extension the multiplications may use.
+             */
+            void requestCompactLayout(storm::storage::kernels::SimdLevel simdLevel);
+            
+            /*!
+             * Retrieves whether the compact layout was requested for this matrix.
+             */
+            bool isCompactLayoutRequested() const;
+            
+            /*!
+             * Converts the entries of this matrix to the compact layout if it was requested and the matrix does not
+             * have a compact layout yet.
+             */
+            void createRequestedCompactLayout();
+            
+            /*!
+             * Retrieves whether the multiplications of this matrix use the compact layout.
+             */
+            bool hasCompactLayout() const;
+            
+            /*!
+             * Retrieves whether the entries of this matrix are only stored in the compact layout, i.e. the standard
+             * layout was released and has not been restored since.
+             */
+            bool isStandardLayoutReleased() const;
+            
+            /*!
+             * Retrieves the compact layout of this matrix. May only be called if there is one.
+             */
+            CompactSparseMatrix<value_type> const& getCompactLayout() const;
+            
+            /*!
+             * Retrieves whether the compact layout is available for matrices of this value type.
+             */
+            static bool isCompactLayoutSupported();
+            
             /*!
              * Multiplies a single row of the matrix with the given vector and returns the result
              *
@@ -1064,6 +1152,7 @@ namespace storm {
 			*/
 			template<typename NewValueType>
 			SparseMatrix<NewValueType> toValueType() const {
+                ensureStandardLayout();
 				std::vector<MatrixEntry<SparseMatrix::index_type, NewValueType>> newColumnsAndValues;
 				std::vector<SparseMatrix::index_type> newRowIndications(rowIndications);
                 boost::optional<std::vector<SparseMatrix::index_type>> newRowGroupIndices(rowGroupIndices);
@@ -1092,6 +1181,33 @@ namespace storm {
              */
             SparseMatrix getSubmatrix(storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint, std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries = false) const;
             
+            /*!
+             * Drops the compact layout of this matrix (if any) after restoring the standard layout. This needs to be
+             * called whenever the entries of the matrix may be changed.
+             */
+            void dropCompactLayout();
+            
+            /*!
+             * Restores the standard layout if the entries are only stored in the compact layout. This needs to be
+             * called before columnsAndValues or rowIndications are accessed directly.
+             */
+            void ensureStandardLayout() const;
+            
+            /*!
+             * Performs the restoration for ensureStandardLayout. Concurrent calls are synchronized.
+             */
+            void restoreStandardLayout() const;
+            
+            /*!
+             * Passes the request for the compact layout (if any) on to the given matrix derived from this one.
+             */
+            void passOnCompactLayoutRequest(SparseMatrix<value_type>& derivedMatrix) const;
+            
+            /*!
+             * Copies the given matrix while holding the given lock on its standard layout.
+             */
+            SparseMatrix(SparseMatrix<value_type> const& other, std::unique_lock<std::mutex> const& lock);
+            
             // The number of rows of the matrix.
             index_type rowCount;
             
@@ -1104,14 +1220,15 @@ namespace storm {
             // The number of nonzero entries in the matrix.
             mutable index_type nonzeroEntryCount;
             
-            // The storage for the columns and values of all entries in the matrix.
-            std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
+            // The storage for the columns and values of all entries in the matrix. This needs to be mutable, because
+            // it is restored on-the-fly if it was released in favor of the compact layout.
+            mutable std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
             
             // A vector containing the indices at which each given row begins. This index is to be interpreted as an
             // index in the valueStorage and the columnIndications vectors. Put differently, the values of the entries
             // in row i are valueStorage[rowIndications[i]] to valueStorage[rowIndications[i + 1]] where the last
-            // entry is not included anymore.
-            std::vector<index_type> rowIndications;
+            // entry is not included anymore. Like columnsAndValues, this is restored on-the-fly if it was released.
+            mutable std::vector<index_type> rowIndications;
             
             // A flag indicating whether the matrix has a trivial row grouping. Note that this may be true and yet
             // there may be row group indices, because they were requested from the outside.
@@ -1119,6 +1236,20 @@ namespace storm {
             
             // A vector indicating the row groups of the matrix. This needs to be mutible in case we create it on-the-fly.
             mutable boost::optional<std::vector<index_type>> rowGroupIndices;
+            
+            // The compact layout of the matrix used by the multiplications (if any).
+            std::shared_ptr<CompactSparseMatrix<value_type> const> compactLayout;
+            
+            // A flag indicating whether the entries are only stored in the compact layout, i.e. columnsAndValues and
+            // rowIndications were released.
+            mutable std::atomic<bool> standardLayoutReleased;
+            
+            // Guards the restoration of the standard layout, which may happen concurrently in const methods.
+            mutable std::mutex standardLayoutMutex;
+            
+            // If the compact layout was requested for this matrix and the matrices derived from it, this holds the
+            // vector instruction set extension its multiplications may use.
+            boost::optional<storm::storage::kernels::SimdLevel> requestedCompactLayout;
         };
         
 #ifdef STORM_HAVE_CARL
@@ -163,6 +163,15 @@ namespace storm {
             return *this;
         }
         
+        SymbolicModelDescription SymbolicModelDescription::defineUndefinedConstants(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) const {
+            if (this->isJaniModel()) {
+                return SymbolicModelDescription(this->asJaniModel().defineUndefinedConstants(constantDefinitions));
+            } else if (this->isPrismProgram()) {
+                return SymbolicModelDescription(this->asPrismProgram().defineUndefinedConstants(constantDefinitions));
+            }
+            return *this;
+        }
+        
         std::map<storm::expressions::Variable, storm::expressions::Expression> SymbolicModelDescription::parseConstantDefinitions(std::string const& constantDefinitionString) const {
             if (this->isJaniModel()) {
                 return storm::utility::cli::parseConstantDefinitionString(this->asJaniModel().getManager(), constantDefinitionString);
@@ -0,0 +1,278 @@
+#include "storm/storage/TreeBitVectorHashMap.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/OutOfRangeException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        TreeBitVectorHashMap<ValueType>::TreeBitVectorHashMapIterator::TreeBitVectorHashMapIterator(TreeBitVectorHashMap const& map, uint64_t index) : map(map), index(index) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        bool TreeBitVectorHashMap<ValueType>::TreeBitVectorHashMapIterator::operator==(TreeBitVectorHashMapIterator const& other) {
+            return &map == &other.map && index == other.index;
+        }
+
+        template<typename ValueType>
+        bool TreeBitVectorHashMap<ValueType>::TreeBitVectorHashMapIterator::operator!=(TreeBitVectorHashMapIterator const& other) {
+            return !(*this == other);
+        }
+
+        template<typename ValueType>
+        typename TreeBitVectorHashMap<ValueType>::TreeBitVectorHashMapIterator& TreeBitVectorHashMap<ValueType>::TreeBitVectorHashMapIterator::operator++() {
+            ++index;
+            return *this;
+        }
+
+        template<typename ValueType>
+        std::pair<storm::storage::BitVector, ValueType> TreeBitVectorHashMap<ValueType>::TreeBitVectorHashMapIterator::operator*() const {
+            return std::make_pair(map.getKey(index), map.getValue(index));
+        }
+
+        template<typename ValueType>
+        TreeBitVectorHashMap<ValueType>::WordTable::WordTable() : words(), buckets(16, 0), logNumberOfBuckets(4) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        uint64_t TreeBitVectorHashMap<ValueType>::WordTable::getBucket(uint64_t word) const {
+            word ^= word >> 32;
+            word *= 0x9E3779B97F4A7C15ull;
+            return word >> (64 - logNumberOfBuckets);
+        }
+
+        template<typename ValueType>
+        uint32_t TreeBitVectorHashMap<ValueType>::WordTable::findOrAdd(uint64_t word) {
+            uint64_t bucket = getBucket(word);
+            uint64_t mask = buckets.size() - 1;
+            while (buckets[bucket] != 0) {
+                if (words[buckets[bucket] - 1] == word) {
+                    return buckets[bucket] - 1;
+                }
+                bucket = (bucket + 1) & mask;
+            }
+
+            STORM_LOG_THROW(words.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::OutOfRangeException, "Too many distinct entries for the tree-compressed hash map.");
+            uint32_t index = static_cast<uint32_t>(words.size());
+            words.push_back(word);
+            buckets[bucket] = index + 1;
+
+            // Keep the load factor of the table below 3/4.
+            if (4 * words.size() >= 3 * buckets.size()) {
+                increaseSize();
+            }
+            return index;
+        }
+
+        template<typename ValueType>
+        std::pair<bool, uint32_t> TreeBitVectorHashMap<ValueType>::WordTable::find(uint64_t word) const {
+            uint64_t bucket = getBucket(word);
+            uint64_t mask = buckets.size() - 1;
+            while (buckets[bucket] != 0) {
+                if (words[buckets[bucket] - 1] == word) {
+                    return std::make_pair(true, buckets[bucket] - 1);
+                }
+                bucket = (bucket + 1) & mask;
+            }
+            return std::make_pair(false, 0);
+        }
+
+        template<typename ValueType>
+        void TreeBitVectorHashMap<ValueType>::WordTable::increaseSize() {
+            ++logNumberOfBuckets;
+            buckets = std::vector<uint32_t>(1ull << logNumberOfBuckets, 0);
+            uint64_t mask = buckets.size() - 1;
+            for (uint64_t index = 0; index < words.size(); ++index) {
+                uint64_t bucket = getBucket(words[index]);
+                while (buckets[bucket] != 0) {
+                    bucket = (bucket + 1) & mask;
+                }
+                buckets[bucket] = index + 1;
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t TreeBitVectorHashMap<ValueType>::WordTable::get(uint32_t index) const {
+            return words[index];
+        }
+
+        template<typename ValueType>
+        uint64_t TreeBitVectorHashMap<ValueType>::WordTable::size() const {
+            return words.size();
+        }
+
+        template<typename ValueType>
+        uint64_t TreeBitVectorHashMap<ValueType>::WordTable::getSizeInMemory() const {
+            return words.capacity() * sizeof(uint64_t) + buckets.capacity() * sizeof(uint32_t);
+        }
+
+        template<typename ValueType>
+        bool TreeBitVectorHashMap<ValueType>::Node::isLeaf() const {
+            return bitWidth > 0;
+        }
+
+        template<typename ValueType>
+        TreeBitVectorHashMap<ValueType>::TreeBitVectorHashMap(uint64_t bucketSize, std::vector<uint64_t> const& sliceOffsets) : bucketSize(bucketSize) {
+            STORM_LOG_THROW(bucketSize > 0, storm::exceptions::InvalidArgumentException, "The keys of the tree-compressed hash map must not be empty.");
+
+            // Determine the slices of the keys.
+            std::vector<uint64_t> offsets = sliceOffsets;
+            offsets.push_back(0);
+            std::sort(offsets.begin(), offsets.end());
+            offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+            offsets.erase(std::remove_if(offsets.begin(), offsets.end(), [bucketSize] (uint64_t offset) { return offset >= bucketSize; }), offsets.end());
+            offsets.push_back(bucketSize);
+
+            std::vector<std::pair<uint64_t, uint64_t>> slices;
+            for (uint64_t index = 0; index + 1 < offsets.size(); ++index) {
+                for (uint64_t offset = offsets[index]; offset < offsets[index + 1]; offset += 64) {
+                    slices.emplace_back(offset, std::min<uint64_t>(64, offsets[index + 1] - offset));
+                }
+            }
+
+            createTree(slices, 0, slices.size());
+            tables.resize(nodes.size());
+        }
+
+        template<typename ValueType>
+        uint64_t TreeBitVectorHashMap<ValueType>::createTree(std::vector<std::pair<uint64_t, uint64_t>> const& slices, uint64_t first, uint64_t last) {
+            uint64_t node = nodes.size();
+            nodes.push_back(Node());
+            if (last - first == 1) {
+                nodes[node].bitOffset = slices[first].first;
+                nodes[node].bitWidth = slices[first].second;
+            } else {
+                uint64_t middle = first + (last - first) / 2;
+                uint64_t leftChild = createTree(slices, first, middle);
+                uint64_t rightChild = createTree(slices, middle, last);
+                nodes[node].bitWidth = 0;
+                nodes[node].leftChild = leftChild;
+                nodes[node].rightChild = rightChild;
+            }
+            return node;
+        }
+
+        template<typename ValueType>
+        uint32_t TreeBitVectorHashMap<ValueType>::findOrAddNode(uint64_t node, storm::storage::BitVector const& key) {
+            Node const& currentNode = nodes[node];
+            if (currentNode.isLeaf()) {
+                return tables[node].findOrAdd(key.getAsInt(currentNode.bitOffset, currentNode.bitWidth));
+            }
+            uint64_t leftIndex = findOrAddNode(currentNode.leftChild, key);
+            uint64_t rightIndex = findOrAddNode(currentNode.rightChild, key);
+            return tables[node].findOrAdd((leftIndex << 32) | rightIndex);
+        }
+
+        template<typename ValueType>
+        std::pair<bool, uint32_t> TreeBitVectorHashMap<ValueType>::findNode(uint64_t node, storm::storage::BitVector const& key) const {
+            Node const& currentNode = nodes[node];
+            if (currentNode.isLeaf()) {
+                return tables[node].find(key.getAsInt(currentNode.bitOffset, currentNode.bitWidth));
+            }
+            std::pair<bool, uint32_t> left = findNode(currentNode.leftChild, key);
+            if (!left.first) {
+                return left;
+            }
+            std::pair<bool, uint32_t> right = findNode(currentNode.rightChild, key);
+            if (!right.first) {
+                return right;
+            }
+            return tables[node].find((static_cast<uint64_t>(left.second) << 32) | right.second);
+        }
+
+        template<typename ValueType>
+        void TreeBitVectorHashMap<ValueType>::decodeNode(uint64_t node, uint32_t index, storm::storage::BitVector& key) const {
+            Node const& currentNode = nodes[node];
+            uint64_t word = tables[node].get(index);
+            if (currentNode.isLeaf()) {
+                key.setFromInt(currentNode.bitOffset, currentNode.bitWidth, word);
+            } else {
+                decodeNode(currentNode.leftChild, static_cast<uint32_t>(word >> 32), key);
+                decodeNode(currentNode.rightChild, static_cast<uint32_t>(word & 0xFFFFFFFFull), key);
+            }
+        }
+
+        template<typename ValueType>
+        ValueType TreeBitVectorHashMap<ValueType>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            uint32_t index = findOrAddNode(0, key);
+
+            // Since every key has a unique root entry, a new root entry means that the key was not yet contained.
+            if (index == values.size()) {
+                values.push_back(value);
+            }
+            return values[index];
+        }
+
+        template<typename ValueType>
+        bool TreeBitVectorHashMap<ValueType>::contains(storm::storage::BitVector const& key) const {
+            return findNode(0, key).first;
+        }
+
+        template<typename ValueType>
+        boost::optional<ValueType> TreeBitVectorHashMap<ValueType>::find(storm::storage::BitVector const& key) const {
+            std::pair<bool, uint32_t> flagIndexPair = findNode(0, key);
+            if (flagIndexPair.first) {
+                return values[flagIndexPair.second];
+            }
+            return boost::none;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector TreeBitVectorHashMap<ValueType>::getKey(uint64_t index) const {
+            storm::storage::BitVector result(bucketSize);
+            decodeNode(0, static_cast<uint32_t>(index), result);
+            return result;
+        }
+
+        template<typename ValueType>
+        ValueType TreeBitVectorHashMap<ValueType>::getValue(uint64_t index) const {
+            return values[index];
+        }
+
+        template<typename ValueType>
+        typename TreeBitVectorHashMap<ValueType>::const_iterator TreeBitVectorHashMap<ValueType>::begin() const {
+            return const_iterator(*this, 0);
+        }
+
+        template<typename ValueType>
+        typename TreeBitVectorHashMap<ValueType>::const_iterator TreeBitVectorHashMap<ValueType>::end() const {
+            return const_iterator(*this, values.size());
+        }
+
+        template<typename ValueType>
+        std::size_t TreeBitVectorHashMap<ValueType>::size() const {
+            return values.size();
+        }
+
+        template<typename ValueType>
+        uint64_t TreeBitVectorHashMap<ValueType>::getNumberOfSlices() const {
+            return (nodes.size() + 1) / 2;
+        }
+
+        template<typename ValueType>
+        uint64_t TreeBitVectorHashMap<ValueType>::getSizeInMemory() const {
+            uint64_t result = values.capacity() * sizeof(ValueType);
+            for (auto const& table : tables) {
+                result += table.getSizeInMemory();
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        void TreeBitVectorHashMap<ValueType>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            for (auto& value : values) {
+                value = remapping(value);
+            }
+        }
+
+        template class TreeBitVectorHashMap<uint32_t>;
+        template class TreeBitVectorHashMap<uint_fast64_t>;
+    }
+}
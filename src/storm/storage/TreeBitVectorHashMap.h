@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a hash-map whose keys are bit vectors of a fixed length, similar to BitVectorHashMap.
+         * Instead of storing every key in full, the keys are split into a number of slices (e.g. the variables of one
+         * module) that are arranged as the leaves of a balanced binary tree. Every node of the tree has its own table in
+         * which the distinct contents of the node are stored exactly once: leaves store the slice of the key and inner
+         * nodes store the pair of indices of the contents of their children. A key is thereby represented by the index
+         * of its root entry and keys that share slices also share the storage for these slices.
+         *
+         * Keys are identified by the order in which they were inserted. Like for BitVectorHashMap, only queries and
+         * insertions are supported.
+         */
+        template<typename ValueType>
+        class TreeBitVectorHashMap {
+        public:
+            class TreeBitVectorHashMapIterator {
+            public:
+                /*!
+                 * Creates an iterator that points to the key with the given index in the given map.
+                 *
+                 * @param map The map of the iterator.
+                 * @param index The index of the key the iterator points to.
+                 */
+                TreeBitVectorHashMapIterator(TreeBitVectorHashMap const& map, uint64_t index);
+
+                // Methods to compare two iterators.
+                bool operator==(TreeBitVectorHashMapIterator const& other);
+                bool operator!=(TreeBitVectorHashMapIterator const& other);
+
+                // Methods to move iterator forward.
+                TreeBitVectorHashMapIterator& operator++();
+
+                // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+                std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+            private:
+                // The map this iterator refers to.
+                TreeBitVectorHashMap const& map;
+
+                // The index of the key this iterator points to.
+                uint64_t index;
+            };
+
+            typedef TreeBitVectorHashMapIterator const_iterator;
+
+            /*!
+             * Creates a new map for keys of the given size.
+             *
+             * @param bucketSize The size of the keys that this map can hold.
+             * @param sliceOffsets The bit offsets at which new slices of the keys start. Slices that are wider than 64
+             * bits are split further. If empty, the keys are split into slices of 64 bits.
+             */
+            TreeBitVectorHashMap(uint64_t bucketSize, std::vector<uint64_t> const& sliceOffsets = {});
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Checks if the given key is already contained in the map.
+             *
+             * @param key The key to search
+             * @return True if the key is already contained in the map
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Searches for the given key in the map. This may be called by several threads at the same time (as long
+             * as the map is not modified concurrently).
+             *
+             * @param key The key to search.
+             * @return The value of the key if it is contained in the map and nothing otherwise.
+             */
+            boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the key that was inserted with the given index (i.e. the index-th inserted key).
+             */
+            storm::storage::BitVector getKey(uint64_t index) const;
+
+            /*!
+             * Retrieves the value of the key that was inserted with the given index.
+             */
+            ValueType getValue(uint64_t index) const;
+
+            /*!
+             * Retrieves an iterator to the elements of the map.
+             *
+             * @return The iterator.
+             */
+            const_iterator begin() const;
+
+            /*!
+             * Retrieves an iterator that points one past the elements of the map.
+             *
+             * @return The iterator.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+             *
+             * @return The size of the map.
+             */
+            std::size_t size() const;
+
+            /*!
+             * Retrieves the number of slices into which the keys are split.
+             */
+            uint64_t getNumberOfSlices() const;
+
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the map.
+             */
+            uint64_t getSizeInMemory() const;
+
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+        private:
+            /*!
+             * A table that stores 64-bit words and assigns consecutive indices to them.
+             */
+            class WordTable {
+            public:
+                WordTable();
+
+                /*!
+                 * Searches for the given word and inserts it if it is not yet contained in the table.
+                 *
+                 * @return The index of the word.
+                 */
+                uint32_t findOrAdd(uint64_t word);
+
+                /*!
+                 * Searches for the given word.
+                 *
+                 * @return A pair whose first component indicates whether the word was found and whose second component
+                 * is its index (if it was found).
+                 */
+                std::pair<bool, uint32_t> find(uint64_t word) const;
+
+                uint64_t get(uint32_t index) const;
+                uint64_t size() const;
+                uint64_t getSizeInMemory() const;
+
+            private:
+                uint64_t getBucket(uint64_t word) const;
+                void increaseSize();
+
+                // The words in the order of their insertion.
+                std::vector<uint64_t> words;
+
+                // The buckets of the hash table. Every bucket stores the index of its word plus one (zero marks an empty bucket).
+                std::vector<uint32_t> buckets;
+
+                // The base two logarithm of the number of buckets.
+                uint64_t logNumberOfBuckets;
+            };
+
+            /*!
+             * A node of the tree. For leaves, the slice of the keys is stored, for inner nodes the children.
+             */
+            struct Node {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                uint64_t leftChild;
+                uint64_t rightChild;
+
+                bool isLeaf() const;
+            };
+
+            /*!
+             * Creates the subtree over the given (half-open) range of slices and returns the index of its root.
+             */
+            uint64_t createTree(std::vector<std::pair<uint64_t, uint64_t>> const& slices, uint64_t first, uint64_t last);
+
+            /*!
+             * Finds (or inserts) the contents of the given node for the given key.
+             */
+            uint32_t findOrAddNode(uint64_t node, storm::storage::BitVector const& key);
+
+            /*!
+             * Finds the contents of the given node for the given key.
+             */
+            std::pair<bool, uint32_t> findNode(uint64_t node, storm::storage::BitVector const& key) const;
+
+            /*!
+             * Writes the contents with the given index of the given node into the key.
+             */
+            void decodeNode(uint64_t node, uint32_t index, storm::storage::BitVector& key) const;
+
+            // The size of the keys.
+            uint64_t bucketSize;
+
+            // The nodes of the tree. The first node is the root.
+            std::vector<Node> nodes;
+
+            // The table of each node.
+            std::vector<WordTable> tables;
+
+            // The values of the keys in the order of their insertion.
+            std::vector<ValueType> values;
+        };
+
+    }
+}
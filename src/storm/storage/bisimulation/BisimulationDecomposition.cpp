@@ -2,6 +2,8 @@
 
 #include <chrono>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -18,6 +20,7 @@
 #include "storm/logic/FormulaInformation.h"
 #include "storm/logic/FragmentSpecification.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
@@ -47,7 +50,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), signatureRefinement(false), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
             // Intentionally left empty.
         }
         
@@ -170,6 +173,7 @@ namespace storm {
             STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || model.hasUniqueRewardModel(), storm::exceptions::IllegalFunctionCallException, "Bisimulation currently only supports models with at most one reward model.");
             STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || model.getUniqueRewardModel().hasOnlyStateRewards(), storm::exceptions::IllegalFunctionCallException, "Bisimulation is currently supported for models with state rewards only. Consider converting the transition rewards to state rewards (via suitable function calls).");
             STORM_LOG_THROW(options.getType() != BisimulationType::Weak || !options.getBounded(), storm::exceptions::IllegalFunctionCallException, "Weak bisimulation cannot preserve bounded properties.");
+            STORM_LOG_THROW(options.getType() == BisimulationType::Strong || !options.signatureRefinement, storm::exceptions::IllegalFunctionCallException, "Signature-based refinement is only available for strong bisimulation.");
             
             // Fix the respected atomic propositions if they were not explicitly given.
             if (!this->options.respectedAtomicPropositions) {
@@ -195,7 +199,11 @@ namespace storm {
             this->initialize();
             
             std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-            this->performPartitionRefinement();
+            if (options.signatureRefinement) {
+                this->performSignatureBasedPartitionRefinement();
+            } else {
+                this->performPartitionRefinement();
+            }
             std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
             
             std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -252,6 +260,162 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+            std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            uint_fast64_t numberOfStates = model.getNumberOfStates();
+            
+            // The signature of a row consists of the probabilities to move to the blocks of the current partition,
+            // ordered by the block. As it has at most as many entries as the row itself, it is stored at the position
+            // of the row's entries.
+            std::vector<std::pair<uint_fast64_t, ValueType>> signatureEntries(transitionMatrix.getEntryCount());
+            std::vector<uint_fast64_t> signatureEnds(transitionMatrix.getRowCount());
+            auto signatureBegin = [&transitionMatrix] (uint_fast64_t row) -> uint_fast64_t { return std::distance(transitionMatrix.begin(0), transitionMatrix.begin(row)); };
+            
+            // The signature of a state is the ordered set of the signatures of its rows. For every state, we store its
+            // rows ordered by their signatures (dropping duplicates) as well as a hash of its signature.
+            std::vector<uint_fast64_t> orderedRows(transitionMatrix.getRowCount());
+            std::vector<uint_fast64_t> numberOfDistinctRows(numberOfStates);
+            std::vector<std::size_t> signatureHashes(numberOfStates);
+            
+            auto compareRows = [&] (uint_fast64_t row1, uint_fast64_t row2) -> int {
+                uint_fast64_t begin1 = signatureBegin(row1);
+                uint_fast64_t begin2 = signatureBegin(row2);
+                uint_fast64_t size1 = signatureEnds[row1] - begin1;
+                uint_fast64_t size2 = signatureEnds[row2] - begin2;
+                if (size1 != size2) {
+                    return size1 < size2 ? -1 : 1;
+                }
+                for (uint_fast64_t offset = 0; offset < size1; ++offset) {
+                    std::pair<uint_fast64_t, ValueType> const& entry1 = signatureEntries[begin1 + offset];
+                    std::pair<uint_fast64_t, ValueType> const& entry2 = signatureEntries[begin2 + offset];
+                    if (entry1.first != entry2.first) {
+                        return entry1.first < entry2.first ? -1 : 1;
+                    }
+                    if (comparator.isLess(entry1.second, entry2.second)) {
+                        return -1;
+                    } else if (comparator.isLess(entry2.second, entry1.second)) {
+                        return 1;
+                    }
+                }
+                return 0;
+            };
+            
+            auto computeRowSignature = [&] (uint_fast64_t row) {
+                uint_fast64_t begin = signatureBegin(row);
+                uint_fast64_t end = begin;
+                for (auto const& entry : transitionMatrix.getRow(row)) {
+                    if (!comparator.isZero(entry.getValue())) {
+                        signatureEntries[end] = std::make_pair(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                        ++end;
+                    }
+                }
+                std::sort(signatureEntries.begin() + begin, signatureEntries.begin() + end, [] (std::pair<uint_fast64_t, ValueType> const& a, std::pair<uint_fast64_t, ValueType> const& b) { return a.first < b.first; });
+                
+                // Sum the probabilities of transitions to the same block.
+                uint_fast64_t current = begin;
+                for (uint_fast64_t position = begin; position < end; ++position) {
+                    if (current > begin && signatureEntries[current - 1].first == signatureEntries[position].first) {
+                        signatureEntries[current - 1].second += signatureEntries[position].second;
+                    } else {
+                        signatureEntries[current] = signatureEntries[position];
+                        ++current;
+                    }
+                }
+                signatureEnds[row] = current;
+            };
+            
+            auto computeStateSignature = [&] (storm::storage::sparse::state_type state) {
+                for (uint_fast64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    computeRowSignature(row);
+                    orderedRows[row] = row;
+                }
+                auto rowsBegin = orderedRows.begin() + rowGroupIndices[state];
+                auto rowsEnd = orderedRows.begin() + rowGroupIndices[state + 1];
+                std::sort(rowsBegin, rowsEnd, [&compareRows] (uint_fast64_t row1, uint_fast64_t row2) { return compareRows(row1, row2) < 0; });
+                rowsEnd = std::unique(rowsBegin, rowsEnd, [&compareRows] (uint_fast64_t row1, uint_fast64_t row2) { return compareRows(row1, row2) == 0; });
+                numberOfDistinctRows[state] = std::distance(rowsBegin, rowsEnd);
+                
+                // As values are only compared up to the precision of the comparator, only the blocks enter the hash.
+                std::size_t seed = numberOfDistinctRows[state];
+                for (auto rowIt = rowsBegin; rowIt != rowsEnd; ++rowIt) {
+                    boost::hash_combine(seed, signatureEnds[*rowIt] - signatureBegin(*rowIt));
+                    for (uint_fast64_t position = signatureBegin(*rowIt); position < signatureEnds[*rowIt]; ++position) {
+                        boost::hash_combine(seed, signatureEntries[position].first);
+                    }
+                }
+                signatureHashes[state] = seed;
+            };
+            
+            auto signatureLess = [&] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                if (signatureHashes[state1] != signatureHashes[state2]) {
+                    return signatureHashes[state1] < signatureHashes[state2];
+                }
+                if (numberOfDistinctRows[state1] != numberOfDistinctRows[state2]) {
+                    return numberOfDistinctRows[state1] < numberOfDistinctRows[state2];
+                }
+                for (uint_fast64_t offset = 0; offset < numberOfDistinctRows[state1]; ++offset) {
+                    int comparison = compareRows(orderedRows[rowGroupIndices[state1] + offset], orderedRows[rowGroupIndices[state2] + offset]);
+                    if (comparison != 0) {
+                        return comparison < 0;
+                    }
+                }
+                return false;
+            };
+            
+            storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+            uint_fast64_t iterations = 0;
+            bool partitionChanged = true;
+            while (partitionChanged) {
+                ++iterations;
+                partitionChanged = false;
+                
+                // Absorbing blocks and blocks with a single state are never split.
+                std::vector<Block<BlockDataType>*> blocksToRefine;
+                std::vector<uint_fast64_t> prefixSizes = {0};
+                for (auto const& block : partition.getBlocks()) {
+                    if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                        blocksToRefine.push_back(block.get());
+                        prefixSizes.push_back(prefixSizes.back() + block->getNumberOfStates());
+                    }
+                }
+                
+                // Compute the signatures of all states and sort the blocks according to them. Since the blocks occupy
+                // disjoint ranges of the partition, this can be done in parallel. Only the splitting itself, which
+                // creates the new blocks, is sequential.
+                auto sortBlocks = [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        Block<BlockDataType> const& block = *blocksToRefine[index];
+                        for (auto stateIt = partition.begin(block), stateIte = partition.end(block); stateIt != stateIte; ++stateIt) {
+                            computeStateSignature(*stateIt);
+                        }
+                        partition.sortRange(block.getBeginIndex(), block.getEndIndex(), signatureLess, false);
+                    }
+                };
+                if (storm::utility::ThreadPool::supportsParallelComputations<ValueType>()) {
+                    pool.parallelFor(blocksToRefine.size(), [&prefixSizes] (uint64_t index) { return prefixSizes[index]; }, sortBlocks);
+                } else {
+                    sortBlocks(0, blocksToRefine.size());
+                }
+                
+                for (auto block : blocksToRefine) {
+                    partitionChanged |= partition.splitBlock(*block, signatureLess, [&block] (Block<BlockDataType>& newBlock) {
+                        // Keep track of whether this is a block with reward states.
+                        newBlock.data().setHasRewards(block->data().hasRewards());
+                    }, true);
+                }
+            }
+            STORM_LOG_DEBUG("Signature-based refinement terminated after " << iterations << " iterations with " << partition.size() << " blocks.");
+            
+            this->updateAfterSignatureBasedRefinement();
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::updateAfterSignatureBasedRefinement() {
+            // Intentionally left empty.
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
@@ -132,6 +132,10 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// A flag that governs whether the partition is refined by computing the signatures of all states in
+                /// parallel rather than by processing splitters one by one. This is only available for strong bisimulation.
+                bool signatureRefinement;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -211,6 +215,19 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs the partition refinement by splitting all blocks according to the signatures of their states
+             * until the partition is stable. The signature of a state is the set of its distributions over the blocks
+             * of the current partition. In every round, the signatures are computed in parallel.
+             */
+            void performSignatureBasedPartitionRefinement();
+            
+            /*!
+             * A function that is called after a signature-based refinement, so that data structures that are
+             * otherwise kept up-to-date while processing the splitters can be rebuilt.
+             */
+            virtual void updateAfterSignatureBasedRefinement();
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
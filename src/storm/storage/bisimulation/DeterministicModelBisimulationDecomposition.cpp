@@ -16,6 +16,7 @@
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -172,7 +173,7 @@ namespace storm {
         }
         
         template<typename ModelType>
-        void DeterministicModelBisimulationDecomposition<ModelType>::refinePredecessorBlockOfSplitterStrong(bisimulation::Block<BlockDataType>& block, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) {
+        void DeterministicModelBisimulationDecomposition<ModelType>::refinePredecessorBlockOfSplitterStrong(bisimulation::Block<BlockDataType>& block, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue, bool presorted) {
             STORM_LOG_TRACE("Refining predecessor " << block.getId() << " of splitter");
             
             // Depending on the actions we need to take, the block to refine changes, so we need to keep track of it.
@@ -199,7 +200,7 @@ namespace storm {
 
                                                     // Keep track of whether this is a block with reward states.
                                                     newBlock.data().setHasRewards(block.data().hasRewards());
-                                                });
+                                                }, presorted);
             
             
             // If the predecessor block was split, we need to insert it into the splitter vector if it is not already
@@ -212,8 +213,35 @@ namespace storm {
         
         template<typename ModelType>
         void DeterministicModelBisimulationDecomposition<ModelType>::refinePredecessorBlocksOfSplitterStrong(std::list<Block<BlockDataType>*> const& predecessorBlocks, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) {
+            // Sorting the states by their probability to the splitter dominates the refinement. Since the predecessor
+            // blocks occupy disjoint ranges of the partition, we sort them in parallel and only split them sequentially.
+            storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+            bool presorted = storm::utility::ThreadPool::supportsParallelComputations<ValueType>() && pool.getThreadCount() > 1 && predecessorBlocks.size() > 1;
+            if (presorted) {
+                std::vector<Block<BlockDataType>*> blocks(predecessorBlocks.begin(), predecessorBlocks.end());
+                std::vector<uint64_t> prefixSizes(blocks.size() + 1);
+                for (uint64_t index = 0; index < blocks.size(); ++index) {
+                    prefixSizes[index + 1] = prefixSizes[index] + blocks[index]->getNumberOfStates();
+                }
+                
+                pool.parallelFor(blocks.size(), [&prefixSizes] (uint64_t index) { return prefixSizes[index]; }, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        Block<BlockDataType> const& block = *blocks[index];
+                        
+                        // Only the states before marker1 are refined probabilistically if the block is split at marker1.
+                        storm::storage::sparse::state_type endIndex = block.getEndIndex();
+                        if (block.getBeginIndex() != block.data().marker1() && block.getEndIndex() != block.data().marker1()) {
+                            endIndex = block.data().marker1();
+                        }
+                        this->partition.sortRange(block.getBeginIndex(), endIndex, [this] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                            return this->comparator.isLess(getProbabilityToSplitter(state1), getProbabilityToSplitter(state2));
+                        }, false);
+                    }
+                });
+            }
+            
             for (auto block : predecessorBlocks) {
-                refinePredecessorBlockOfSplitterStrong(*block, splitterQueue);
+                refinePredecessorBlockOfSplitterStrong(*block, splitterQueue, presorted);
                 
                 // If the block was *not* split, we need to reset the markers by notifying the data.
                 block->resetMarkers();
@@ -45,8 +45,9 @@ namespace storm {
             // Post-processes the initial partition to properly initialize it.
             void postProcessInitialPartition();
             
-            // Refines the given block wrt to strong bisimulation.
-            void refinePredecessorBlockOfSplitterStrong(bisimulation::Block<BlockDataType>& block, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue);
+            // Refines the given block wrt to strong bisimulation. If the flag is set, the states of the block that have a
+            // positive probability to go to the splitter are assumed to be sorted by that probability already.
+            void refinePredecessorBlockOfSplitterStrong(bisimulation::Block<BlockDataType>& block, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue, bool presorted = false);
 
             // Refines the predecessor blocks wrt. strong bisimulation.
             void refinePredecessorBlocksOfSplitterStrong(std::list<bisimulation::Block<BlockDataType>*> const& predecessorBlocks, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue);
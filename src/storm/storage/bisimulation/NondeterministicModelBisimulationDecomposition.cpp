@@ -36,6 +36,14 @@ namespace storm {
             this->initializeQuotientDistributions();
         }
         
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::updateAfterSignatureBasedRefinement() {
+            // The quotient distributions are not maintained during signature-based refinement, so we recompute them
+            // wrt. the final partition.
+            quotientDistributions = std::vector<storm::storage::Distribution<ValueType>>(this->model.getNumberOfChoices());
+            this->initializeQuotientDistributions();
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToStateMapping() {
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -234,9 +234,11 @@ namespace storm {
             }
             
             template<typename DataType>
-            bool Partition<DataType>::splitBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, std::function<void (Block<DataType>&)> const& newBlockCallback) {
+            bool Partition<DataType>::splitBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, std::function<void (Block<DataType>&)> const& newBlockCallback, bool blockIsSorted) {
                 // Sort the block, but leave the positions untouched.
-                this->sortBlock(block, less, false);
+                if (!blockIsSorted) {
+                    this->sortBlock(block, less, false);
+                }
                 
                 auto originalBegin = block.getBeginIndex();
                 auto originalEnd = block.getEndIndex();
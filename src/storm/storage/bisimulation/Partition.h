@@ -63,8 +63,9 @@ namespace storm {
                 std::vector<uint_fast64_t> computeRangesOfEqualValue(uint_fast64_t startIndex, uint_fast64_t endIndex, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less);
                 
                 // Splits the block by sorting the states according to the given function and then identifying the split
-                // points. The callback function is called for every newly created block.
-                bool splitBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, std::function<void (Block<DataType>&)> const& newBlockCallback);
+                // points. The callback function is called for every newly created block. If the block is known to be
+                // sorted already (without the positions being updated), sorting is skipped.
+                bool splitBlock(Block<DataType>& block, std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, std::function<void (Block<DataType>&)> const& newBlockCallback, bool blockIsSorted = false);
 
                 // Splits the block by sorting the states according to the given function and then identifying the split
                 // points.
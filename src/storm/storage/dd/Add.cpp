@@ -607,7 +607,7 @@ namespace storm {
             
             // Prepare the vectors that represent the matrix.
             std::vector<uint_fast64_t> rowIndications(rowOdd.getTotalOffset() + 1);
-            std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(this->getNonZeroCount());
+            std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues;
             
             // Create a trivial row grouping.
             std::vector<uint_fast64_t> trivialRowGroupIndices(rowIndications.size());
@@ -617,9 +617,8 @@ namespace storm {
                 ++i;
             }
             
-            // Count the number of elements in the rows.
-            rowIndications = this->notZero().template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-            rowIndications.emplace_back();
+            // Count the number of elements in the rows by a first traversal of the DD that does not write any entries.
+            internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices, false);
             
             // Now that we computed the number of entries in each row, compute the corresponding offsets in the entry vector.
             uint_fast64_t tmp = 0;
@@ -632,6 +631,7 @@ namespace storm {
             rowIndications[0] = 0;
             
             // Now actually fill the entry vector.
+            columnsAndValues.resize(rowIndications.back());
             internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices, true);
             
             // Since the last call to toMatrixRec modified the rowIndications, we need to restore the correct values.
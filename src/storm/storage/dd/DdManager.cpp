@@ -4,6 +4,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/file.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -12,7 +13,9 @@
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <iostream>
 
 namespace storm {
@@ -417,6 +420,11 @@ namespace storm {
             return result;
         }
         
+        template<DdType LibraryType>
+        bool DdManager<LibraryType>::supportsDynamicReordering() const {
+            return internalDdManager.supportsDynamicReordering();
+        }
+        
         template<DdType LibraryType>
         void DdManager<LibraryType>::allowDynamicReordering(bool value) {
             internalDdManager.allowDynamicReordering(value);
@@ -432,6 +440,35 @@ namespace storm {
             internalDdManager.triggerReordering();
         }
         
+        template<DdType LibraryType>
+        std::vector<std::string> DdManager<LibraryType>::getMetaVariableOrder() const {
+            std::vector<std::pair<uint64_t, std::string>> levelsAndNames;
+            for (auto const& variablePair : metaVariableMap) {
+                uint64_t topLevel = std::numeric_limits<uint64_t>::max();
+                for (auto const& indexLevelPair : variablePair.second.getIndicesAndLevels()) {
+                    topLevel = std::min(topLevel, indexLevelPair.second);
+                }
+                levelsAndNames.emplace_back(topLevel, variablePair.first.getName());
+            }
+            std::sort(levelsAndNames.begin(), levelsAndNames.end());
+            
+            std::vector<std::string> result;
+            for (auto const& levelNamePair : levelsAndNames) {
+                result.push_back(levelNamePair.second);
+            }
+            return result;
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::exportMetaVariableOrder(std::string const& filename) const {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream);
+            for (auto const& name : this->getMetaVariableOrder()) {
+                stream << name << std::endl;
+            }
+            storm::utility::closeFile(stream);
+        }
+        
         template<DdType LibraryType>
         std::set<storm::expressions::Variable> DdManager<LibraryType>::getAllMetaVariables() const {
             std::set<storm::expressions::Variable> result;
@@ -251,6 +251,13 @@ namespace storm {
              */
             bool supportsOrderedInsertion() const;
             
+            /*!
+             * Checks whether this manager supports reordering the variables of the DDs it manages.
+             *
+             * @return True iff the manager supports reordering.
+             */
+            bool supportsDynamicReordering() const;
+            
             /*!
              * Sets whether or not dynamic reordering is allowed for the DDs managed by this manager (if supported).
              *
@@ -270,6 +277,23 @@ namespace storm {
              */
             void triggerReordering();
             
+            /*!
+             * Retrieves the names of all meta variables ordered by the position of their top-most DD variable in the
+             * current variable order.
+             *
+             * @return The names of the meta variables in the current order.
+             */
+            std::vector<std::string> getMetaVariableOrder() const;
+            
+            /*!
+             * Writes the current order of the meta variables (one name per line) to the given file. Builders can be
+             * instructed to create their meta variables in this order (see storm::utility::dd::importMetaVariableOrder)
+             * no matter which DD library is used.
+             *
+             * @param filename The name of the file to write.
+             */
+            void exportMetaVariableOrder(std::string const& filename) const;
+            
             /*!
              * Retrieves the meta variable with the given name if it exists.
              *
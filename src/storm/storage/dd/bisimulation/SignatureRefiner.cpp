@@ -2,6 +2,9 @@
 
 #include <cstdio>
 
+#include <atomic>
+#include <limits>
+#include <mutex>
 #include <unordered_map>
 #include <boost/container/flat_map.hpp>
 
@@ -250,226 +253,395 @@ namespace storm {
                 spp::sparse_hash_map<DdNode const*, ReuseWrapper> reuseBlocksCache;
             };
             
+            /*!
+             * The state of a refinement with Sylvan that is shared by all workers participating in the refinement.
+             *
+             * Since the workers discover the signatures in an arbitrary order, the parallel traversal only assigns
+             * temporary block numbers. Afterwards, the blocks are renumbered in the order in which a sequential
+             * traversal (visiting then-successors first) encounters them, so the resulting partition does not depend
+             * on the scheduling of the workers.
+             */
+            class SylvanRefinementContext {
+            public:
+                // A marker indicating that a signature keeps the number of its old block.
+                static const uint64_t REUSED_BLOCK = std::numeric_limits<uint64_t>::max();
+
+                SylvanRefinementContext(BDD blockCube, uint64_t numberOfBlockVariables, bool shiftStateVariables) : blockCube(blockCube), numberOfBlockVariables(numberOfBlockVariables), shiftStateVariables(shiftStateVariables), refinementId(0), nextFreeBlockIndex(0), nextTemporaryBlockIndex(0), signatureShards(NUMBER_OF_SHARDS) {
+                    for (BDD variables = blockCube; !sylvan_isconst(variables); variables = sylvan_high(variables)) {
+                        blockVariables.insert(sylvan_var(variables));
+                    }
+                }
+
+                /*!
+                 * Prepares a new refinement of a partition.
+                 */
+                void startRefinement(uint64_t nextFreeBlockIndex, uint64_t numberOfOldBlocks) {
+                    refinementId = nextRefinementId++;
+                    this->nextFreeBlockIndex = nextFreeBlockIndex;
+                    nextTemporaryBlockIndex = 0;
+                    for (uint64_t shard = 0; shard < NUMBER_OF_SHARDS; ++shard) {
+                        std::size_t oldSize = signatureShards[shard].signatureToBlock.size();
+                        signatureShards[shard].signatureToBlock.clear();
+                        signatureShards[shard].signatureToBlock.reserve(3 * oldSize);
+                    }
+                    reusedBlocks.clear();
+                    reusedBlocks.reserve(3 * numberOfOldBlocks);
+                }
+
+                /*!
+                 * Retrieves the temporary block index for the states with the given signature in the given old block.
+                 */
+                uint64_t getTemporaryBlockIndex(MTBDD signatureNode, BDD partitionNode) {
+                    auto nodePair = std::make_pair(signatureNode, partitionNode);
+                    SignatureShard& signatureShard = signatureShards[SylvanMTBDDPairHash()(nodePair) % NUMBER_OF_SHARDS];
+
+                    std::lock_guard<std::mutex> signatureLock(signatureShard.mutex);
+                    auto it = signatureShard.signatureToBlock.find(nodePair);
+                    if (it != signatureShard.signatureToBlock.end()) {
+                        return it->second;
+                    }
+
+                    uint64_t result = nextTemporaryBlockIndex++;
+                    signatureShard.signatureToBlock.emplace(nodePair, result);
+                    return result;
+                }
+
+                /*!
+                 * Assigns the final block numbers to the temporary blocks occurring in the given result of the parallel
+                 * traversal. This must be called by a single thread after all workers are done.
+                 */
+                void assignBlockIndices(BDD temporaryPartition) {
+                    // Recover the old block of each temporary block.
+                    temporaryBlockToOldBlock.resize(nextTemporaryBlockIndex);
+                    for (auto const& signatureShard : signatureShards) {
+                        for (auto const& entry : signatureShard.signatureToBlock) {
+                            temporaryBlockToOldBlock[entry.second] = entry.first.second;
+                        }
+                    }
+
+                    temporaryBlockToBlock.assign(nextTemporaryBlockIndex, REUSED_BLOCK);
+                    std::vector<bool> assigned(nextTemporaryBlockIndex, false);
+                    spp::sparse_hash_set<BDD> visited;
+                    assignBlockIndicesRec(temporaryPartition, visited, assigned);
+                }
+
+                /*!
+                 * Retrieves the BDD of the final block that corresponds to the temporary block encoded by the given cube.
+                 * This may create nodes and must therefore not be called while holding any of the locks.
+                 */
+                BDD getBlock(BDD temporaryBlockCube) const {
+                    uint64_t temporaryBlockIndex = decodeBlock(temporaryBlockCube);
+                    uint64_t blockIndex = temporaryBlockToBlock[temporaryBlockIndex];
+                    if (blockIndex == REUSED_BLOCK) {
+                        return temporaryBlockToOldBlock[temporaryBlockIndex];
+                    }
+                    return encodeBlock(blockIndex);
+                }
+
+                /*!
+                 * Encodes the block with the given index as a BDD. This may create nodes and must therefore not be
+                 * called while holding any of the locks.
+                 */
+                BDD encodeBlock(uint64_t blockIndex) const {
+                    std::vector<uint8_t> e(numberOfBlockVariables);
+                    for (uint64_t i = 0; i < numberOfBlockVariables; ++i) {
+                        e[i] = blockIndex & 1 ? 1 : 0;
+                        blockIndex >>= 1;
+                    }
+                    return sylvan_cube(blockCube, e.data());
+                }
+
+                /*!
+                 * Retrieves whether the given node is labeled with a block variable, i.e. whether it is the root of a
+                 * block encoding.
+                 */
+                bool isBlockEncoding(BDD node) const {
+                    return !sylvan_isconst(node) && blockVariables.find(sylvan_var(node)) != blockVariables.end();
+                }
+
+                uint64_t getNextFreeBlockIndex() const {
+                    return nextFreeBlockIndex;
+                }
+
+                // The cube of the block variables.
+                BDD blockCube;
+                uint64_t numberOfBlockVariables;
+                bool shiftStateVariables;
+
+                // An identifier of the current refinement that is unique among all refinements. It is used to
+                // separate the entries of different refinements in Sylvan's operation cache.
+                uint64_t refinementId;
+
+            private:
+                // The number of shards into which the signature table is split to reduce lock contention.
+                static const uint64_t NUMBER_OF_SHARDS = 256;
+
+                struct SignatureShard {
+                    std::mutex mutex;
+                    spp::sparse_hash_map<std::pair<MTBDD, MTBDD>, uint64_t, SylvanMTBDDPairHash> signatureToBlock;
+                };
+
+                /*!
+                 * Decodes the index of the block encoded by the given cube (the inverse of encodeBlock).
+                 */
+                uint64_t decodeBlock(BDD cube) const {
+                    uint64_t blockIndex = 0;
+                    for (uint64_t i = 0; i < numberOfBlockVariables; ++i) {
+                        if (sylvan_low(cube) == sylvan_false) {
+                            blockIndex |= 1ull << i;
+                            cube = sylvan_high(cube);
+                        } else {
+                            cube = sylvan_low(cube);
+                        }
+                    }
+                    return blockIndex;
+                }
+
+                void assignBlockIndicesRec(BDD node, spp::sparse_hash_set<BDD>& visited, std::vector<bool>& assigned) {
+                    if (node == sylvan_false || !visited.insert(node).second) {
+                        return;
+                    }
+
+                    // If we hit a block, the first signature found in an old block may keep the old block number.
+                    if (isBlockEncoding(node)) {
+                        uint64_t temporaryBlockIndex = decodeBlock(node);
+                        if (!assigned[temporaryBlockIndex]) {
+                            assigned[temporaryBlockIndex] = true;
+                            if (!reusedBlocks.insert(temporaryBlockToOldBlock[temporaryBlockIndex]).second) {
+                                temporaryBlockToBlock[temporaryBlockIndex] = nextFreeBlockIndex++;
+                            }
+                        }
+                        return;
+                    }
+
+                    assignBlockIndicesRec(sylvan_high(node), visited, assigned);
+                    assignBlockIndicesRec(sylvan_low(node), visited, assigned);
+                }
+
+                // The next refinement identifier to hand out.
+                static std::atomic<uint64_t> nextRefinementId;
+
+                // The variables of the block encoding.
+                spp::sparse_hash_set<BDDVAR> blockVariables;
+
+                // The current number of blocks of the new partition.
+                uint64_t nextFreeBlockIndex;
+
+                // The number of temporary blocks handed out in the parallel traversal.
+                std::atomic<uint64_t> nextTemporaryBlockIndex;
+
+                // The table used to identify states with identical signature.
+                std::vector<SignatureShard> signatureShards;
+
+                // The old blocks that have already been reused.
+                spp::sparse_hash_set<BDD> reusedBlocks;
+
+                // The old block of each temporary block.
+                std::vector<BDD> temporaryBlockToOldBlock;
+
+                // The final index of each temporary block (or REUSED_BLOCK if it keeps the number of its old block).
+                std::vector<uint64_t> temporaryBlockToBlock;
+            };
+
+            std::atomic<uint64_t> SylvanRefinementContext::nextRefinementId(1);
+
+            uint64_t getSylvanRefinementOperationId() {
+                // Operation identifiers may only be requested after Sylvan was initialized.
+                static const uint64_t operationId = cache_next_opid();
+                return operationId;
+            }
+
+            uint64_t getSylvanRenumberingOperationId() {
+                static const uint64_t operationId = cache_next_opid();
+                return operationId;
+            }
+
+            /*!
+             * Refines the given partition node wrt. the given signature node and encodes the temporary block numbers in
+             * the result. The two branches of every node are refined in parallel.
+             */
+            TASK_5(BDD, sylvan_refine_partition, BDD, partitionNode, MTBDD, signatureNode, BDD, nondeterminismVariablesNode, BDD, nonBlockVariablesNode, void*, contextPointer) {
+                SylvanRefinementContext& context = *static_cast<SylvanRefinementContext*>(contextPointer);
+
+                // If we arrived at the constant zero node, then this was an illegal state encoding (we require
+                // all states to be non-deadlock).
+                if (partitionNode == sylvan_false) {
+                    return partitionNode;
+                }
+
+                STORM_LOG_ASSERT(partitionNode != mtbdd_false, "Expected non-false node.");
+
+                sylvan_gc_test();
+
+                // If there are no more non-block variables, we hit the signature.
+                if (sylvan_isconst(nonBlockVariablesNode)) {
+                    return context.encodeBlock(context.getTemporaryBlockIndex(signatureNode, partitionNode));
+                }
+
+                // Check the cache whether we have seen the same node before.
+                uint64_t const operationId = getSylvanRefinementOperationId();
+                BDD result;
+                if (cache_get3(operationId, partitionNode, signatureNode, context.refinementId, &result)) {
+                    return result;
+                }
+
+                // If there are more variables that belong to the non-block part of the encoding, we need to recursively descend.
+                bool skippedBoth = true;
+                BDD partitionThen;
+                BDD partitionElse;
+                MTBDD signatureThen;
+                MTBDD signatureElse;
+                short offset;
+                bool isNondeterminismVariable = false;
+                while (skippedBoth && !sylvan_isconst(nonBlockVariablesNode)) {
+                    // Remember an offset that indicates whether the top variable is a nondeterminism variable or not.
+                    offset = context.shiftStateVariables ? 1 : 0;
+                    isNondeterminismVariable = false;
+                    if (!sylvan_isconst(nondeterminismVariablesNode) && sylvan_var(nondeterminismVariablesNode) == sylvan_var(nonBlockVariablesNode)) {
+                        offset = 0;
+                        isNondeterminismVariable = true;
+                    }
+
+                    if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, double>::matchesVariableIndex(partitionNode, sylvan_var(nonBlockVariablesNode), -offset)) {
+                        partitionThen = sylvan_high(partitionNode);
+                        partitionElse = sylvan_low(partitionNode);
+                        skippedBoth = false;
+                    } else {
+                        partitionThen = partitionElse = partitionNode;
+                    }
+
+                    if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, double>::matchesVariableIndex(signatureNode, sylvan_var(nonBlockVariablesNode))) {
+                        signatureThen = sylvan_high(signatureNode);
+                        signatureElse = sylvan_low(signatureNode);
+                        skippedBoth = false;
+                    } else {
+                        signatureThen = signatureElse = signatureNode;
+                    }
+
+                    // If both (signature and partition) skipped the next variable, we fast-forward.
+                    if (skippedBoth) {
+                        // If the current variable is a nondeterminism variable, we need to advance both variable sets otherwise just the non-block variables.
+                        nonBlockVariablesNode = sylvan_high(nonBlockVariablesNode);
+                        if (isNondeterminismVariable) {
+                            nondeterminismVariablesNode = sylvan_high(nondeterminismVariablesNode);
+                        }
+                    }
+                }
+
+                // If there are no more non-block variables remaining, make a recursive call to enter the base case.
+                if (sylvan_isconst(nonBlockVariablesNode)) {
+                    return CALL(sylvan_refine_partition, partitionNode, signatureNode, nondeterminismVariablesNode, nonBlockVariablesNode, contextPointer);
+                }
+
+                BDD nextNondeterminismVariablesNode = isNondeterminismVariable ? sylvan_high(nondeterminismVariablesNode) : nondeterminismVariablesNode;
+                BDD nextNonBlockVariablesNode = sylvan_high(nonBlockVariablesNode);
+                bdd_refs_spawn(SPAWN(sylvan_refine_partition, partitionThen, signatureThen, nextNondeterminismVariablesNode, nextNonBlockVariablesNode, contextPointer));
+                BDD elseResult = bdd_refs_push(CALL(sylvan_refine_partition, partitionElse, signatureElse, nextNondeterminismVariablesNode, nextNonBlockVariablesNode, contextPointer));
+                BDD thenResult = bdd_refs_sync(SYNC(sylvan_refine_partition));
+                bdd_refs_pop(1);
+
+                if (thenResult == elseResult) {
+                    result = thenResult;
+                } else {
+                    // Get the node to connect the subresults.
+                    result = sylvan_makenode(sylvan_var(nonBlockVariablesNode) + offset, elseResult, thenResult);
+                }
+
+                // Store the result in the cache.
+                cache_put3(operationId, partitionNode, signatureNode, context.refinementId, result);
+
+                return result;
+            }
+
+            /*!
+             * Replaces the temporary blocks in the given result of the parallel refinement by their final blocks.
+             */
+            TASK_2(BDD, sylvan_renumber_blocks, BDD, node, void*, contextPointer) {
+                SylvanRefinementContext const& context = *static_cast<SylvanRefinementContext const*>(contextPointer);
+
+                if (node == sylvan_false) {
+                    return node;
+                }
+                if (context.isBlockEncoding(node)) {
+                    return context.getBlock(node);
+                }
+
+                sylvan_gc_test();
+
+                uint64_t const operationId = getSylvanRenumberingOperationId();
+                BDD result;
+                if (cache_get3(operationId, node, 0, context.refinementId, &result)) {
+                    return result;
+                }
+
+                bdd_refs_spawn(SPAWN(sylvan_renumber_blocks, sylvan_high(node), contextPointer));
+                BDD elseResult = bdd_refs_push(CALL(sylvan_renumber_blocks, sylvan_low(node), contextPointer));
+                BDD thenResult = bdd_refs_sync(SYNC(sylvan_renumber_blocks));
+                bdd_refs_pop(1);
+
+                result = sylvan_makenode(sylvan_var(node), elseResult, thenResult);
+                cache_put3(operationId, node, 0, context.refinementId, result);
+
+                return result;
+            }
+
             template<typename ValueType>
             class InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType> {
             public:
-                InternalSignatureRefiner(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager, storm::expressions::Variable const& blockVariable, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nondeterminismVariables, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nonBlockVariables, bool shiftStateVariables) : manager(manager), internalDdManager(manager.getInternalDdManager()), blockVariable(blockVariable), nondeterminismVariables(nondeterminismVariables), nonBlockVariables(nonBlockVariables), shiftStateVariables(shiftStateVariables), numberOfBlockVariables(manager.getMetaVariable(blockVariable).getNumberOfDdVariables()), blockCube(manager.getMetaVariable(blockVariable).getCube()), nextFreeBlockIndex(0), numberOfRefinements(0), signatureCache() {
+                InternalSignatureRefiner(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager, storm::expressions::Variable const& blockVariable, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nondeterminismVariables, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& nonBlockVariables, bool shiftStateVariables) : manager(manager), internalDdManager(manager.getInternalDdManager()), blockVariable(blockVariable), nondeterminismVariables(nondeterminismVariables), nonBlockVariables(nonBlockVariables), blockCube(manager.getMetaVariable(blockVariable).getCube()), numberOfRefinements(0), context(blockCube.getInternalBdd().getSylvanBdd().GetBDD(), manager.getMetaVariable(blockVariable).getNumberOfDdVariables(), shiftStateVariables) {
                     // Perform garbage collection to clean up stuff not needed anymore.
                     LACE_ME;
                     sylvan_gc();
                 }
-                
+
                 Partition<storm::dd::DdType::Sylvan, ValueType> refine(Partition<storm::dd::DdType::Sylvan, ValueType> const& oldPartition, Signature<storm::dd::DdType::Sylvan, ValueType> const& signature) {
                     storm::dd::Bdd<storm::dd::DdType::Sylvan> newPartitionBdd = refine(oldPartition, signature.getSignatureAdd());
-                    return oldPartition.replacePartition(newPartitionBdd, nextFreeBlockIndex);
+                    return oldPartition.replacePartition(newPartitionBdd, context.getNextFreeBlockIndex());
                 }
-                
+
             private:
                 storm::dd::Bdd<storm::dd::DdType::Sylvan> refine(Partition<storm::dd::DdType::Sylvan, ValueType> const& oldPartition, storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& signatureAdd) {
                     STORM_LOG_ASSERT(oldPartition.storedAsBdd(), "Expecting partition to be stored as BDD for Sylvan.");
 
                     LACE_ME;
-                    
+
                     // Set up next refinement.
                     ++numberOfRefinements;
-                    
-                    // Clear the caches.
-                    std::size_t oldSize = signatureCache.size();
-                    signatureCache.clear();
-                    signatureCache.reserve(3 * oldSize);
-                    reuseBlocksCache.clear();
-                    reuseBlocksCache.reserve(3 * oldPartition.getNumberOfBlocks());
-                    nextFreeBlockIndex = oldPartition.getNextFreeBlockIndex();
+                    context.startRefinement(oldPartition.getNextFreeBlockIndex(), oldPartition.getNumberOfBlocks());
 
-                    // Clear performance counters.
-//                    signatureCacheLookups = 0;
-//                    signatureCacheHits = 0;
-//                    numberOfVisitedNodes = 0;
-//                    totalSignatureCacheLookupTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalSignatureCacheStoreTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalReuseBlocksLookupTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalLevelLookupTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalBlockEncodingTime = std::chrono::high_resolution_clock::duration(0);
-//                    totalMakeNodeTime = std::chrono::high_resolution_clock::duration(0);
-                    
-                    // Perform the actual recursive refinement step.
-                    BDD result = refine(oldPartition.asBdd().getInternalBdd().getSylvanBdd().GetBDD(), signatureAdd.getInternalAdd().getSylvanMtbdd().GetMTBDD(), nondeterminismVariables.getInternalBdd().getSylvanBdd().GetBDD(), nonBlockVariables.getInternalBdd().getSylvanBdd().GetBDD());
+                    // Perform the actual recursive refinement step, which the Lace workers carry out in parallel.
+                    sylvan::Bdd temporaryPartition(CALL(sylvan_refine_partition, oldPartition.asBdd().getInternalBdd().getSylvanBdd().GetBDD(), signatureAdd.getInternalAdd().getSylvanMtbdd().GetMTBDD(), nondeterminismVariables.getInternalBdd().getSylvanBdd().GetBDD(), nonBlockVariables.getInternalBdd().getSylvanBdd().GetBDD(), &context));
+
+                    // Number the new blocks canonically and substitute the final numbers for the temporary ones.
+                    context.assignBlockIndices(temporaryPartition.GetBDD());
+                    BDD result = CALL(sylvan_renumber_blocks, temporaryPartition.GetBDD(), &context);
 
                     // Construct resulting BDD from the obtained node and the meta information.
                     storm::dd::InternalBdd<storm::dd::DdType::Sylvan> internalNewPartitionBdd(&internalDdManager, sylvan::Bdd(result));
                     storm::dd::Bdd<storm::dd::DdType::Sylvan> newPartitionBdd(oldPartition.asBdd().getDdManager(), internalNewPartitionBdd, oldPartition.asBdd().getContainedMetaVariables());
-                    
-//                    // Display some statistics.
-//                    STORM_LOG_TRACE("Refinement visited " << numberOfVisitedNodes << " nodes.");
-//                    STORM_LOG_TRACE("Current #nodes in table: " << llmsset_count_marked(nodes) << " of " << llmsset_get_size(nodes) << ", cache: " << cache_getused() << " of " << cache_getsize() << ".");
-//                    STORM_LOG_TRACE("Signature cache hits: " << signatureCacheHits << ", misses: " << (signatureCacheLookups - signatureCacheHits) << ".");
-//                    STORM_LOG_TRACE("Signature cache lookup time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSignatureCacheLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Signature cache store time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSignatureCacheStoreTime).count() << "ms");
-//                    STORM_LOG_TRACE("Signature cache total time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSignatureCacheStoreTime + totalSignatureCacheLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Reuse blocks lookup time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalReuseBlocksLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Level lookup time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalLevelLookupTime).count() << "ms");
-//                    STORM_LOG_TRACE("Block encoding time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalBlockEncodingTime).count() << "ms");
-//                    STORM_LOG_TRACE("Make node time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalMakeNodeTime).count() << "ms");
-                    
-                    return newPartitionBdd;
-                }
-                
-                BDD encodeBlock(uint64_t blockIndex) {
-                    std::vector<uint8_t> e(numberOfBlockVariables);
-                    for (uint64_t i = 0; i < numberOfBlockVariables; ++i) {
-                        e[i] = blockIndex & 1 ? 1 : 0;
-                        blockIndex >>= 1;
-                    }
-                    return sylvan_cube(blockCube.getInternalBdd().getSylvanBdd().GetBDD(), e.data());
-                }
-                
-                BDD refine(BDD partitionNode, MTBDD signatureNode, BDD nondeterminismVariablesNode, BDD nonBlockVariablesNode) {
-                    LACE_ME;
-                    
-                    // If we arrived at the constant zero node, then this was an illegal state encoding (we require
-                    // all states to be non-deadlock).
-                    if (partitionNode == sylvan_false) {
-                        return partitionNode;
-                    }
-                    
-                    STORM_LOG_ASSERT(partitionNode != mtbdd_false, "Expected non-false node.");
 
-                    // Check the cache whether we have seen the same node before.
-                    auto nodePair = std::make_pair(signatureNode, partitionNode);
-                    auto it = signatureCache.find(nodePair);
-                    if (it != signatureCache.end()) {
-                        // If so, we return the corresponding result.
-                        return it->second;
-                    }
-                    
-                    sylvan_gc_test();
-                    
-                    // If there are no more non-block variables, we hit the signature.
-                    if (sylvan_isconst(nonBlockVariablesNode)) {
-                        // If this is the first time (in this traversal) that we encounter this signature, we check
-                        // whether we can assign the old block number to it.
-
-                        auto& reuseBlockEntry = reuseBlocksCache[partitionNode];
-                        if (!reuseBlockEntry.isReused()) {
-                            reuseBlockEntry.setReused();
-                            reuseBlocksCache.emplace(partitionNode, true);
-                            signatureCache[nodePair] = partitionNode;
-                            return partitionNode;
-                        } else {
-                            BDD result = encodeBlock(nextFreeBlockIndex++);
-                            signatureCache[nodePair] = result;
-                            return result;
-                        }
-                    } else {
-                        // If there are more variables that belong to the non-block part of the encoding, we need to recursively descend.
-                        
-                        bool skippedBoth = true;
-                        BDD partitionThen;
-                        BDD partitionElse;
-                        MTBDD signatureThen;
-                        MTBDD signatureElse;
-                        short offset;
-                        bool isNondeterminismVariable = false;
-                        while (skippedBoth && !sylvan_isconst(nonBlockVariablesNode)) {
-                            // Remember an offset that indicates whether the top variable is a nondeterminism variable or not.
-                            offset = shiftStateVariables ? 1 : 0;
-                            if (!sylvan_isconst(nondeterminismVariablesNode) && sylvan_var(nondeterminismVariablesNode) == sylvan_var(nonBlockVariablesNode)) {
-                                offset = 0;
-                                isNondeterminismVariable = true;
-                            }
+                    STORM_LOG_TRACE("Refinement " << numberOfRefinements << " yielded " << context.getNextFreeBlockIndex() << " blocks.");
 
-                            if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::matchesVariableIndex(partitionNode, sylvan_var(nonBlockVariablesNode), -offset)) {
-                                partitionThen = sylvan_high(partitionNode);
-                                partitionElse = sylvan_low(partitionNode);
-                                skippedBoth = false;
-                            } else {
-                                partitionThen = partitionElse = partitionNode;
-                            }
-                            
-                            if (storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::matchesVariableIndex(signatureNode, sylvan_var(nonBlockVariablesNode))) {
-                                signatureThen = sylvan_high(signatureNode);
-                                signatureElse = sylvan_low(signatureNode);
-                                skippedBoth = false;
-                            } else {
-                                signatureThen = signatureElse = signatureNode;
-                            }
-                            
-                            // If both (signature and partition) skipped the next variable, we fast-forward.
-                            if (skippedBoth) {
-                                // If the current variable is a nondeterminism variable, we need to advance both variable sets otherwise just the non-block variables.
-                                nonBlockVariablesNode = sylvan_high(nonBlockVariablesNode);
-                                if (isNondeterminismVariable) {
-                                    nondeterminismVariablesNode = sylvan_high(nondeterminismVariablesNode);
-                                }
-                            }
-                        }
-                        
-                        // If there are no more non-block variables remaining, make a recursive call to enter the base case.
-                        if (sylvan_isconst(nonBlockVariablesNode)) {
-                            return refine(partitionNode, signatureNode, nondeterminismVariablesNode, nonBlockVariablesNode);
-                        }
-                        
-                        BDD thenResult = refine(partitionThen, signatureThen, isNondeterminismVariable ? sylvan_high(nondeterminismVariablesNode) : nondeterminismVariablesNode, sylvan_high(nonBlockVariablesNode));
-                        bdd_refs_push(thenResult);
-                        BDD elseResult = refine(partitionElse, signatureElse, isNondeterminismVariable ? sylvan_high(nondeterminismVariablesNode) : nondeterminismVariablesNode, sylvan_high(nonBlockVariablesNode));
-                        bdd_refs_push(elseResult);
-                        
-                        BDD result;
-                        if (thenResult == elseResult) {
-                            result = thenResult;
-                        } else {
-                            // Get the node to connect the subresults.
-                            result = sylvan_makenode(sylvan_var(nonBlockVariablesNode) + offset, elseResult, thenResult);
-                        }
-                        
-                        // Dispose of the intermediate results.
-                        bdd_refs_pop(2);
-                        
-                        // Store the result in the cache.
-                        signatureCache[nodePair] = result;
-                        
-                        return result;
-                    }
+                    return newPartitionBdd;
                 }
-                
+
                 storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager;
                 storm::dd::InternalDdManager<storm::dd::DdType::Sylvan> const& internalDdManager;
                 storm::expressions::Variable const& blockVariable;
 
                 storm::dd::Bdd<storm::dd::DdType::Sylvan> nondeterminismVariables;
                 storm::dd::Bdd<storm::dd::DdType::Sylvan> nonBlockVariables;
-                
-                bool shiftStateVariables;
-                
-                uint64_t numberOfBlockVariables;
-                
+
+                // The cube of the block variables. This also keeps the nodes referenced by the context alive.
                 storm::dd::Bdd<storm::dd::DdType::Sylvan> blockCube;
-                
-                // The current number of blocks of the new partition.
-                uint64_t nextFreeBlockIndex;
-                
+
                 // The number of completed refinements.
                 uint64_t numberOfRefinements;
-                
-                // The cache used to identify states with identical signature.
-                spp::sparse_hash_map<std::pair<MTBDD, MTBDD>, MTBDD, SylvanMTBDDPairHash> signatureCache;
-                
-                // The cache used to identify which old block numbers have already been reused.
-                spp::sparse_hash_map<MTBDD, ReuseWrapper> reuseBlocksCache;
-                
-                // Performance counters.
-//                uint64_t signatureCacheLookups;
-//                uint64_t signatureCacheHits;
-//                uint64_t numberOfVisitedNodes;
-//                std::chrono::high_resolution_clock::duration totalSignatureCacheLookupTime;
-//                std::chrono::high_resolution_clock::duration totalSignatureCacheStoreTime;
-//                std::chrono::high_resolution_clock::duration totalReuseBlocksLookupTime;
-//                std::chrono::high_resolution_clock::duration totalLevelLookupTime;
-//                std::chrono::high_resolution_clock::duration totalBlockEncodingTime;
-//                std::chrono::high_resolution_clock::duration totalMakeNodeTime;
-                
+
+                // The state shared by the workers performing a refinement.
+                SylvanRefinementContext context;
             };
-            
+
             template<storm::dd::DdType DdType, typename ValueType>
             SignatureRefiner<DdType, ValueType>::SignatureRefiner(storm::dd::DdManager<DdType> const& manager, storm::expressions::Variable const& blockVariable, std::set<storm::expressions::Variable> const& stateVariables, bool shiftStateVariables, std::set<storm::expressions::Variable> const& nondeterminismVariables) : manager(&manager), stateVariables(stateVariables) {
                 
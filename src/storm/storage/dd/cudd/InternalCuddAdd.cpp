@@ -8,12 +8,21 @@
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace dd {
+        namespace {
+            // The number of rows below which translating an ADD to a matrix is not worth being parallelized.
+            uint_fast64_t const MINIMAL_ROW_COUNT_FOR_PARALLEL_TRANSLATION = 1ull << 14;
+            
+            // The number of row subtrees per thread into which the translation is split, so that idle threads can steal work.
+            uint_fast64_t const ROW_SUBTREES_PER_THREAD = 8;
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::CUDD, ValueType>::InternalAdd(InternalDdManager<DdType::CUDD> const* ddManager, cudd::ADD cuddAdd) : ddManager(ddManager), cuddAdd(cuddAdd) {
             // Intentionally left empty.
@@ -577,11 +586,31 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            // The subtrees of the row ODD cover disjoint sets of rows, so they can be translated independently. Within
+            // each subtree, the recursion visits the entries in the order of the rows and columns.
+            storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+            uint_fast64_t rowSubtreeLevel = 0;
+            // Translating the values of the exact and parametric types is not thread-safe, so their matrices are built by one
+            // recursion over the whole ODD.
+            if (storm::utility::ThreadPool::supportsParallelComputations<ValueType>() && pool.getThreadCount() > 1 && rowOdd.getTotalOffset() >= MINIMAL_ROW_COUNT_FOR_PARALLEL_TRANSLATION) {
+                while (rowSubtreeLevel < ddRowVariableIndices.size() && (1ull << rowSubtreeLevel) < ROW_SUBTREES_PER_THREAD * pool.getThreadCount()) {
+                    ++rowSubtreeLevel;
+                }
+            }
+            
+            std::vector<uint64_t> boundaries;
+            for (uint64_t subtree = 0; subtree <= (1ull << rowSubtreeLevel); ++subtree) {
+                boundaries.push_back(subtree);
+            }
+            pool.execute(boundaries, [&] (uint64_t begin, uint64_t end) {
+                for (uint64_t subtree = begin; subtree < end; ++subtree) {
+                    toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues, subtree, rowSubtreeLevel);
+                }
+            });
         }
 
         template<typename ValueType>
-        void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+        void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues, uint_fast64_t rowSubtree, uint_fast64_t rowSubtreeLevel) const {
             // For the empty DD, we do not need to add any entries.
             if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
                 return;
@@ -622,14 +651,26 @@ namespace storm {
                     }
                 }
                 
-                // Visit else-else.
-                toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-                // Visit else-then.
-                toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-                // Visit then-else.
-                toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-                // Visit then-then.
-                toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                // Above the given level, only the rows of the given subtree are considered.
+                bool visitElseRows = true;
+                bool visitThenRows = true;
+                if (currentRowLevel < rowSubtreeLevel) {
+                    visitThenRows = (rowSubtree >> (rowSubtreeLevel - currentRowLevel - 1)) & 1;
+                    visitElseRows = !visitThenRows;
+                }
+                
+                if (visitElseRows) {
+                    // Visit else-else.
+                    toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, rowSubtree, rowSubtreeLevel);
+                    // Visit else-then.
+                    toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, rowSubtree, rowSubtreeLevel);
+                }
+                if (visitThenRows) {
+                    // Visit then-else.
+                    toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, rowSubtree, rowSubtreeLevel);
+                    // Visit then-then.
+                    toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, rowSubtree, rowSubtreeLevel);
+                }
             }
         }
         
@@ -582,6 +582,7 @@ namespace storm {
             
             /*!
              * Translates the ADD into the components needed for constructing a matrix.
+             * The rows of disjoint subtrees of the row ODD are translated in parallel.
              *
              * @param rowGroupIndices The row group indices.
              * @param rowIndications The vector that is to be filled with the row indications.
@@ -692,8 +693,12 @@ namespace storm {
              * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
              * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
              * this flag needs to be false.
+             * @param rowSubtree The index of the subtree of the row ODD (at the given level) whose rows are to be
+             * considered.
+             * @param rowSubtreeLevel The level of the row ODD at which the subtree is located. If this is zero, all rows
+             * are considered.
              */
-            void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+            void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues, uint_fast64_t rowSubtree, uint_fast64_t rowSubtreeLevel) const;
             
             /*!
              * Builds an ADD representing the given vector.
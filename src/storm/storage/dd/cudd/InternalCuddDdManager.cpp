@@ -135,6 +135,10 @@ namespace storm {
             return true;
         }
         
+        bool InternalDdManager<DdType::CUDD>::supportsDynamicReordering() const {
+            return true;
+        }
+        
         void InternalDdManager<DdType::CUDD>::allowDynamicReordering(bool value) {
             if (value) {
                 this->getCuddManager().AutodynEnable(this->reorderingTechnique);
@@ -228,6 +228,10 @@ namespace storm {
             return false;
         }
         
+        bool InternalDdManager<DdType::Sylvan>::supportsDynamicReordering() const {
+            return false;
+        }
+        
         void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
         }
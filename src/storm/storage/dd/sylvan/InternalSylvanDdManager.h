@@ -108,6 +108,13 @@ namespace storm {
              */
             bool supportsOrderedInsertion() const;
             
+            /*!
+             * Checks whether this manager supports reordering the variables of the DDs it manages.
+             *
+             * @return True iff the manager supports reordering.
+             */
+            bool supportsDynamicReordering() const;
+            
             /*!
              * Sets whether or not dynamic reordering is allowed for the DDs managed by this manager.
              *
@@ -3,7 +3,7 @@
 namespace storm {
     namespace expressions {
         
-        ExprtkCompiledExpression::ExprtkCompiledExpression(CompiledExpressionType const& exprtkCompiledExpression) : exprtkCompiledExpression(exprtkCompiledExpression) {
+        ExprtkCompiledExpression::ExprtkCompiledExpression(CompiledExpressionType const& exprtkCompiledExpression, uint64_t evaluatorId) : exprtkCompiledExpression(exprtkCompiledExpression), evaluatorId(evaluatorId) {
             // Intentionally left empty.
         }
         
@@ -11,6 +11,10 @@ namespace storm {
             return exprtkCompiledExpression;
         }
         
+        bool ExprtkCompiledExpression::isCompiledFor(uint64_t evaluatorId) const {
+            return this->evaluatorId == evaluatorId;
+        }
+        
         bool ExprtkCompiledExpression::isExprtkCompiledExpression() const {
             return true;
         }
@@ -11,14 +11,21 @@ namespace storm {
         public:
             typedef exprtk::expression<double> CompiledExpressionType;
 
-            ExprtkCompiledExpression(CompiledExpressionType const& exprtkCompiledExpression);
+            ExprtkCompiledExpression(CompiledExpressionType const& exprtkCompiledExpression, uint64_t evaluatorId);
             
             CompiledExpressionType const& getCompiledExpression() const;
+            
+            /*!
+             * Retrieves whether the expression was compiled by (i.e. reads its variables from) the evaluator with the
+             * given id. Evaluators must not use expressions that were compiled by another evaluator.
+             */
+            bool isCompiledFor(uint64_t evaluatorId) const;
 
             virtual bool isExprtkCompiledExpression() const override;
             
         private:
             CompiledExpressionType exprtkCompiledExpression;
+            uint64_t evaluatorId;
         };
         
     }
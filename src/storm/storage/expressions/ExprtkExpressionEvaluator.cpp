@@ -1,3 +1,4 @@
+#include <atomic>
 #include <string>
 
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
@@ -10,8 +11,12 @@
 
 namespace storm {
     namespace expressions {
+        namespace {
+            std::atomic<uint64_t> nextEvaluatorId(0);
+        }
+        
         template<typename RationalType>
-        ExprtkExpressionEvaluatorBase<RationalType>::ExprtkExpressionEvaluatorBase(storm::expressions::ExpressionManager const& manager) : ExpressionEvaluatorBase<RationalType>(manager), parser(std::make_unique<exprtk::parser<ValueType>>()), symbolTable(std::make_unique<exprtk::symbol_table<ValueType>>()), booleanValues(manager.getNumberOfBooleanVariables()), integerValues(manager.getNumberOfIntegerVariables()), rationalValues(manager.getNumberOfRationalVariables()) {
+        ExprtkExpressionEvaluatorBase<RationalType>::ExprtkExpressionEvaluatorBase(storm::expressions::ExpressionManager const& manager) : ExpressionEvaluatorBase<RationalType>(manager), evaluatorId(nextEvaluatorId++), parser(std::make_unique<exprtk::parser<ValueType>>()), symbolTable(std::make_unique<exprtk::symbol_table<ValueType>>()), booleanValues(manager.getNumberOfBooleanVariables()), integerValues(manager.getNumberOfIntegerVariables()), rationalValues(manager.getNumberOfRationalVariables()) {
 
             for (auto const& variableTypePair : manager) {
                 if (variableTypePair.second.isBooleanType()) {
@@ -38,12 +43,14 @@ namespace storm {
         
         template<typename RationalType>
         typename ExprtkExpressionEvaluatorBase<RationalType>::CompiledExpressionType const& ExprtkExpressionEvaluatorBase<RationalType>::getCompiledExpression(storm::expressions::Expression const& expression) const {
-            if (!expression.hasCompiledExpression() || !expression.getCompiledExpression().isExprtkCompiledExpression()) {
+            // Expressions may have been compiled by another evaluator (e.g. one that is used by another thread), in
+            // which case they refer to the variable values of that evaluator.
+            if (!expression.hasCompiledExpression() || !expression.getCompiledExpression().isExprtkCompiledExpression() || !expression.getCompiledExpression().asExprtkCompiledExpression().isCompiledFor(evaluatorId)) {
                 CompiledExpressionType compiledExpression;
                 compiledExpression.register_symbol_table(*symbolTable);
                 bool parsingOk = parser->compile(ToExprtkStringVisitor().toString(expression), compiledExpression);
                 STORM_LOG_THROW(parsingOk, storm::exceptions::UnexpectedException, "Expression was not properly parsed by ExprTk: " << expression << ". (Returned error: " << parser->error() << ")");
-                expression.setCompiledExpression(std::make_shared<ExprtkCompiledExpression>(compiledExpression));
+                expression.setCompiledExpression(std::make_shared<ExprtkCompiledExpression>(compiledExpression, evaluatorId));
             }
             return expression.getCompiledExpression().asExprtkCompiledExpression().getCompiledExpression();
         }
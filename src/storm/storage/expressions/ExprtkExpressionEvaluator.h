@@ -37,6 +37,9 @@ namespace storm {
              */
             CompiledExpressionType const& getCompiledExpression(storm::expressions::Expression const& expression) const;
             
+            // A unique id of this evaluator that is used to recognize the expressions it compiled.
+            uint64_t evaluatorId;
+            
             // The parser used.
             mutable std::unique_ptr<exprtk::parser<ValueType>> parser;
             
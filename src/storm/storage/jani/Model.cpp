@@ -865,14 +865,23 @@ namespace storm {
         }
         
         Model Model::substituteConstants() const {
+            return substituteConstants(std::set<storm::expressions::Variable>());
+        }
+        
+        Model Model::substituteConstants(std::set<storm::expressions::Variable> const& constantsToKeep) const {
             Model result(*this);
 
-            // Gather all defining expressions of constants.
+            // Gather all defining expressions of constants. The definitions of all constants are needed to fully
+            // substitute the definitions, but the kept constants must not be substituted in the rest of the model.
+            std::map<storm::expressions::Variable, storm::expressions::Expression> definitions;
             std::map<storm::expressions::Variable, storm::expressions::Expression> constantSubstitution;
             for (auto& constant : result.getConstants()) {
                 if (constant.isDefined()) {
-                    constant.define(constant.getExpression().substitute(constantSubstitution));
-                    constantSubstitution[constant.getExpressionVariable()] = constant.getExpression();
+                    constant.define(constant.getExpression().substitute(definitions));
+                    definitions[constant.getExpressionVariable()] = constant.getExpression();
+                    if (constantsToKeep.find(constant.getExpressionVariable()) == constantsToKeep.end()) {
+                        constantSubstitution[constant.getExpressionVariable()] = constant.getExpression();
+                    }
                 }
             }
             
@@ -892,6 +901,44 @@ namespace storm {
             return result;
         }
         
+        std::set<storm::expressions::Variable> Model::getNonStructuralConstants() const {
+            std::set<storm::expressions::Variable> structuralVariables;
+            auto insertVariablesOf = [&structuralVariables] (storm::expressions::Expression const& expression) {
+                std::set<storm::expressions::Variable> variables = expression.getVariables();
+                structuralVariables.insert(variables.begin(), variables.end());
+            };
+            auto insertStructuralVariablesOf = [&insertVariablesOf] (VariableSet const& variableSet) {
+                for (auto const& variable : variableSet) {
+                    if (variable.hasInitExpression()) {
+                        insertVariablesOf(variable.getInitExpression());
+                    }
+                }
+                for (auto const& variable : variableSet.getBoundedIntegerVariables()) {
+                    insertVariablesOf(variable.getLowerBound());
+                    insertVariablesOf(variable.getUpperBound());
+                }
+            };
+            
+            insertStructuralVariablesOf(this->getGlobalVariables());
+            if (this->hasInitialStatesRestriction()) {
+                insertVariablesOf(this->getInitialStatesRestriction());
+            }
+            for (auto const& automaton : this->getAutomata()) {
+                insertStructuralVariablesOf(automaton.getVariables());
+                if (automaton.hasInitialStatesRestriction()) {
+                    insertVariablesOf(automaton.getInitialStatesRestriction());
+                }
+            }
+            
+            std::set<storm::expressions::Variable> result;
+            for (auto const& constant : this->getConstants()) {
+                if (constant.isDefined() && structuralVariables.find(constant.getExpressionVariable()) == structuralVariables.end()) {
+                    result.insert(constant.getExpressionVariable());
+                }
+            }
+            return result;
+        }
+        
         std::map<storm::expressions::Variable, storm::expressions::Expression> Model::getConstantsSubstitution() const {
             std::map<storm::expressions::Variable, storm::expressions::Expression> result;
             
@@ -328,6 +328,22 @@ namespace storm {
              */
             Model substituteConstants() const;
             
+            /*!
+             * Substitutes all constants except for the given ones in all expressions of the model. The definitions of
+             * the kept constants are substituted as well, so they only refer to other constants if these are undefined.
+             * The original model is not modified, but instead a new model is created.
+             *
+             * @param constantsToKeep The expression variables of the constants that are not to be substituted.
+             */
+            Model substituteConstants(std::set<storm::expressions::Variable> const& constantsToKeep) const;
+            
+            /*!
+             * Retrieves the defined constants of the model that neither appear in the domains or initial values of
+             * variables nor in the initial states restrictions. The values of these constants do not influence which
+             * states the model has, but only its transitions and their values.
+             */
+            std::set<storm::expressions::Variable> getNonStructuralConstants() const;
+            
             /*!
              * Retrieves a mapping from expression variables associated with defined constants of the model to their
              * (the constants') defining expression.
@@ -5,15 +5,74 @@ namespace storm {
         namespace sparse {
                         
             template <typename StateType>
-            StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : stateToId(bitsPerState, 10000000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+            StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState), stateToId(bitsPerState, 10000000) {
+                // Intentionally left empty.
+            }
+
+            template <typename StateType>
+            StateStorage<StateType>::StateStorage(uint64_t bitsPerState, std::vector<uint64_t> const& sliceOffsets) : initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState), stateToId(bitsPerState, 1), compressedStateToId(storm::storage::TreeBitVectorHashMap<StateType>(bitsPerState, sliceOffsets)) {
                 // Intentionally left empty.
             }
 
             template <typename StateType>
             uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
+                if (compressedStateToId) {
+                    return compressedStateToId.get().size();
+                }
                 return stateToId.size();
             }
             
+            template <typename StateType>
+            bool StateStorage<StateType>::isTreeCompressed() const {
+                return static_cast<bool>(compressedStateToId);
+            }
+            
+            template <typename StateType>
+            StateType StateStorage<StateType>::findOrAddState(storm::storage::BitVector const& state, StateType newIndex) {
+                if (compressedStateToId) {
+                    return compressedStateToId.get().findOrAdd(state, newIndex);
+                }
+                return stateToId.findOrAdd(state, newIndex);
+            }
+            
+            template <typename StateType>
+            boost::optional<StateType> StateStorage<StateType>::findState(storm::storage::BitVector const& state) const {
+                if (compressedStateToId) {
+                    return compressedStateToId.get().find(state);
+                }
+                return stateToId.find(state);
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::remapStateIndices(std::function<StateType (StateType const&)> const& remapping) {
+                if (compressedStateToId) {
+                    compressedStateToId.get().remap(remapping);
+                } else {
+                    stateToId.remap(remapping);
+                }
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::forEachState(std::function<void (storm::storage::BitVector const&, StateType)> const& function) const {
+                if (compressedStateToId) {
+                    for (auto const& stateIndexPair : compressedStateToId.get()) {
+                        function(stateIndexPair.first, stateIndexPair.second);
+                    }
+                } else {
+                    for (auto const& stateIndexPair : stateToId) {
+                        function(stateIndexPair.first, stateIndexPair.second);
+                    }
+                }
+            }
+            
+            template <typename StateType>
+            uint64_t StateStorage<StateType>::getSizeInMemory() const {
+                if (compressedStateToId) {
+                    return compressedStateToId.get().getSizeInMemory();
+                }
+                return stateToId.getSizeInMemory();
+            }
+            
             template struct StateStorage<uint32_t>;
             template struct StateStorage<uint_fast64_t>;
         }
@@ -2,8 +2,12 @@
 #define STORM_STORAGE_SPARSE_STATESTORAGE_H_
 
 #include <cstdint>
+#include <functional>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/TreeBitVectorHashMap.h"
 
 namespace storm {
     namespace storage {
@@ -15,8 +19,9 @@ namespace storm {
                 // Creates an empty state storage structure for storing states of the given bit width.
                 StateStorage(uint64_t bitsPerState);
                 
-                // This member stores all the states and maps them to their unique indices.
-                storm::storage::BitVectorHashMap<StateType> stateToId;
+                // Creates an empty state storage structure that keeps the states in a tree-compressed map. The states
+                // are split into slices starting at the given bit offsets (e.g. one slice per module).
+                StateStorage(uint64_t bitsPerState, std::vector<uint64_t> const& sliceOffsets);
                 
                 // A list of initial states in terms of their global indices.
                 std::vector<StateType> initialStateIndices;
@@ -29,6 +34,35 @@ namespace storm {
                 
                 // Get the number of states that were found in the exploration so far.
                 uint_fast64_t getNumberOfStates() const;
+                
+                // Retrieves whether the states are stored in a tree-compressed map.
+                bool isTreeCompressed() const;
+                
+                // Searches for the given state and inserts it with the given index if it is not yet contained. Returns
+                // the index of the state.
+                StateType findOrAddState(storm::storage::BitVector const& state, StateType newIndex);
+                
+                // Searches for the given state and returns its index if it is contained. Several threads may search
+                // at the same time as long as no state is added concurrently.
+                boost::optional<StateType> findState(storm::storage::BitVector const& state) const;
+                
+                // Applies the given remapping to the indices of all states.
+                void remapStateIndices(std::function<StateType (StateType const&)> const& remapping);
+                
+                // Calls the given function for all states along with their indices.
+                void forEachState(std::function<void (storm::storage::BitVector const&, StateType)> const& function) const;
+                
+                // Retrieves the (approximate) number of bytes that are used to store the states.
+                uint64_t getSizeInMemory() const;
+                
+            private:
+                // This member stores all the states and maps them to their unique indices. It is not used if the
+                // states are stored in a tree-compressed map. The states are only accessible through the methods above,
+                // so that callers work with both kinds of storage.
+                storm::storage::BitVectorHashMap<StateType> stateToId;
+                
+                // If set, this member stores all the states (instead of stateToId).
+                boost::optional<storm::storage::TreeBitVectorHashMap<StateType>> compressedStateToId;
             };
             
         }
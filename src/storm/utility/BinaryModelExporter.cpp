@@ -0,0 +1,193 @@
+#include "storm/utility/BinaryModelExporter.h"
+
+#include <vector>
+
+#include "storm/utility/BinaryModelFormat.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace exporter {
+
+        namespace {
+            class BinaryWriter {
+            public:
+                BinaryWriter(std::ostream& os) : os(os) {
+                    // Intentionally left empty.
+                }
+
+                void writeWord(uint64_t word) {
+                    os.write(reinterpret_cast<char const*>(&word), sizeof(word));
+                }
+
+                template<typename T>
+                void writeArray(T const* data, uint64_t count) {
+                    static_assert(sizeof(T) == sizeof(uint64_t), "Only arrays of 64-bit words can be written.");
+                    os.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+                }
+
+                /*!
+                 * Writes the elements of the given range after applying the given function to each of them.
+                 */
+                template<typename T, typename Iterator, typename Function>
+                void writeTransformed(Iterator first, Iterator last, Function const& function) {
+                    std::vector<T> buffer;
+                    buffer.reserve(BUFFER_SIZE);
+                    for (; first != last; ++first) {
+                        buffer.push_back(function(*first));
+                        if (buffer.size() == BUFFER_SIZE) {
+                            writeArray(buffer.data(), buffer.size());
+                            buffer.clear();
+                        }
+                    }
+                    writeArray(buffer.data(), buffer.size());
+                }
+
+                void writeBitVector(storm::storage::BitVector const& bitVector) {
+                    uint64_t index = 0;
+                    for (; index + 64 <= bitVector.size(); index += 64) {
+                        writeWord(bitVector.getAsInt(index, 64));
+                    }
+                    if (index < bitVector.size()) {
+                        writeWord(bitVector.getAsInt(index, bitVector.size() - index));
+                    }
+                }
+
+                void writeSectionHeader(storm::utility::binaryformat::SectionType type, std::string const& name, uint64_t payloadLength) {
+                    writeWord(static_cast<uint64_t>(type));
+                    writeWord(name.size());
+                    writeWord(payloadLength);
+                    os.write(name.data(), name.size());
+                    writePadding(name.size());
+                }
+
+                void writePadding(uint64_t numberOfBytes) {
+                    for (uint64_t byte = numberOfBytes; byte < storm::utility::binaryformat::padToWord(numberOfBytes); ++byte) {
+                        os.put(0);
+                    }
+                }
+
+            private:
+                static const uint64_t BUFFER_SIZE = 4096;
+
+                std::ostream& os;
+            };
+
+            uint64_t getBitVectorPayloadLength(uint64_t size) {
+                return ((size + 63) / 64) * sizeof(uint64_t);
+            }
+
+            template<typename ValueType>
+            uint64_t getMatrixPayloadLength(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                uint64_t words = 4 + matrix.getRowCount() + 1 + 2 * matrix.getEntryCount();
+                if (!matrix.hasTrivialRowGrouping()) {
+                    words += matrix.getRowGroupCount() + 1;
+                }
+                return words * sizeof(uint64_t);
+            }
+
+            template<typename ValueType>
+            void writeMatrix(BinaryWriter& writer, storm::utility::binaryformat::SectionType type, std::string const& name, storm::storage::SparseMatrix<ValueType> const& matrix) {
+                writer.writeSectionHeader(type, name, getMatrixPayloadLength(matrix));
+                writer.writeWord(matrix.getRowCount());
+                writer.writeWord(matrix.getColumnCount());
+                writer.writeWord(matrix.getEntryCount());
+                writer.writeWord(matrix.hasTrivialRowGrouping() ? 0 : matrix.getRowGroupCount());
+
+                std::vector<uint64_t> rowIndications;
+                rowIndications.reserve(matrix.getRowCount() + 1);
+                for (uint64_t row = 0; row <= matrix.getRowCount(); ++row) {
+                    rowIndications.push_back(std::distance(matrix.begin(), matrix.begin(row)));
+                }
+                writer.writeArray(rowIndications.data(), rowIndications.size());
+                writer.writeTransformed<uint64_t>(matrix.begin(), matrix.end(), [] (storm::storage::MatrixEntry<uint_fast64_t, ValueType> const& entry) { return static_cast<uint64_t>(entry.getColumn()); });
+                writer.writeTransformed<ValueType>(matrix.begin(), matrix.end(), [] (storm::storage::MatrixEntry<uint_fast64_t, ValueType> const& entry) { return entry.getValue(); });
+                if (!matrix.hasTrivialRowGrouping()) {
+                    writer.writeTransformed<uint64_t>(matrix.getRowGroupIndices().begin(), matrix.getRowGroupIndices().end(), [] (uint_fast64_t index) { return static_cast<uint64_t>(index); });
+                }
+            }
+
+            template<typename ValueType>
+            void writeVector(BinaryWriter& writer, storm::utility::binaryformat::SectionType type, std::string const& name, std::vector<ValueType> const& values) {
+                writer.writeSectionHeader(type, name, values.size() * sizeof(ValueType));
+                writer.writeArray(values.data(), values.size());
+            }
+
+            void writeBitVector(BinaryWriter& writer, storm::utility::binaryformat::SectionType type, std::string const& name, storm::storage::BitVector const& bitVector) {
+                writer.writeSectionHeader(type, name, getBitVectorPayloadLength(bitVector.size()));
+                writer.writeBitVector(bitVector);
+            }
+        }
+
+        template<typename ValueType>
+        void exportSparseModelAsBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel) {
+            STORM_LOG_THROW(sparseModel->getType() != storm::models::ModelType::S2pg, storm::exceptions::NotSupportedException, "Stochastic two player games can not be exported in the binary format.");
+            using storm::utility::binaryformat::SectionType;
+
+            // Gather all parts of the model that need to be exported. Their number is part of the header.
+            std::vector<ValueType> const* exitRates = nullptr;
+            storm::storage::BitVector const* markovianStates = nullptr;
+            if (sparseModel->isOfType(storm::models::ModelType::Ctmc)) {
+                exitRates = &sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector();
+            } else if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                auto const& markovAutomaton = *sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+                exitRates = &markovAutomaton.getExitRates();
+                markovianStates = &markovAutomaton.getMarkovianStates();
+            }
+
+            std::set<std::string> stateLabels = sparseModel->getStateLabeling().getLabels();
+            std::set<std::string> choiceLabels;
+            if (sparseModel->hasChoiceLabeling()) {
+                choiceLabels = sparseModel->getChoiceLabeling().getLabels();
+            }
+            uint64_t numberOfSections = 1 + stateLabels.size() + choiceLabels.size() + (exitRates ? 1 : 0) + (markovianStates ? 1 : 0);
+            for (auto const& rewardModel : sparseModel->getRewardModels()) {
+                numberOfSections += (rewardModel.second.hasStateRewards() ? 1 : 0) + (rewardModel.second.hasStateActionRewards() ? 1 : 0) + (rewardModel.second.hasTransitionRewards() ? 1 : 0);
+            }
+
+            BinaryWriter writer(os);
+            os.write(storm::utility::binaryformat::MAGIC, sizeof(storm::utility::binaryformat::MAGIC));
+            writer.writeWord(storm::utility::binaryformat::VERSION);
+            writer.writeWord(storm::utility::binaryformat::BYTE_ORDER_MARK);
+            writer.writeWord(sizeof(ValueType));
+            writer.writeWord(static_cast<uint64_t>(sparseModel->getType()));
+            writer.writeWord(sparseModel->getNumberOfStates());
+            writer.writeWord(sparseModel->getTransitionMatrix().getRowCount());
+            writer.writeWord(numberOfSections);
+
+            writeMatrix(writer, SectionType::TransitionMatrix, "", sparseModel->getTransitionMatrix());
+            for (auto const& label : stateLabels) {
+                writeBitVector(writer, SectionType::StateLabel, label, sparseModel->getStateLabeling().getStates(label));
+            }
+            for (auto const& label : choiceLabels) {
+                writeBitVector(writer, SectionType::ChoiceLabel, label, sparseModel->getChoiceLabeling().getChoices(label));
+            }
+            for (auto const& rewardModel : sparseModel->getRewardModels()) {
+                if (rewardModel.second.hasStateRewards()) {
+                    writeVector(writer, SectionType::StateRewards, rewardModel.first, rewardModel.second.getStateRewardVector());
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    writeVector(writer, SectionType::StateActionRewards, rewardModel.first, rewardModel.second.getStateActionRewardVector());
+                }
+                if (rewardModel.second.hasTransitionRewards()) {
+                    writeMatrix(writer, SectionType::TransitionRewards, rewardModel.first, rewardModel.second.getTransitionRewardMatrix());
+                }
+            }
+            if (exitRates) {
+                writeVector(writer, SectionType::ExitRates, "", *exitRates);
+            }
+            if (markovianStates) {
+                writeBitVector(writer, SectionType::MarkovianStates, "", *markovianStates);
+            }
+
+            STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Error while writing the binary model.");
+        }
+
+        // Only models over floating point numbers have a fixed-size binary representation.
+        template void exportSparseModelAsBinary<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+    }
+}
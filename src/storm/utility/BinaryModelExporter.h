@@ -0,0 +1,23 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+    namespace exporter {
+
+        /*!
+         * Exports a sparse model into the binary model format (see BinaryModelFormat.h). The exported file contains
+         * the transition matrix, the state and choice labelings, all reward models and, for continuous time models,
+         * the exit rates and Markovian states. Other components (e.g. state valuations) are not exported.
+         *
+         * @param os           Stream to export to. It has to be opened in binary mode.
+         * @param sparseModel  Model to export
+         */
+        template<typename ValueType>
+        void exportSparseModelAsBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel);
+
+    }
+}
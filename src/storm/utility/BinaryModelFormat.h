@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+    namespace utility {
+        namespace binaryformat {
+
+            /*
+             * A binary model file consists of a header and a sequence of sections. All numbers are 64-bit words in the
+             * byte order of the machine that wrote the file and every part of the file starts at a multiple of eight
+             * bytes. This way, a reader can map the file into memory and copy the arrays directly into the model.
+             *
+             * Header:  magic number ("STORMBIN"), version, byte order mark, size of a value in bytes, model type,
+             *          number of states, number of choices, number of sections.
+             * Section: section type, length of the name in bytes, length of the payload in bytes, name (padded), payload
+             *          (padded).
+             *
+             * The payloads of the sections are
+             * - matrices: row count, column count, entry count, row group count (zero for a trivial row grouping), the
+             *   row indications, the columns of all entries, the values of all entries and the row group indices,
+             * - labels and Markovian states: the buckets of a bit vector over the states (or choices),
+             * - reward vectors and exit rates: one value per state (or choice).
+             *
+             * Readers skip sections of unknown type, so new sections can be added without changing the version.
+             */
+
+            // The characters at the beginning of each binary model file.
+            char const MAGIC[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+
+            // The version of the format. It needs to be increased whenever the layout of existing parts changes.
+            uint64_t const VERSION = 1;
+
+            // A word whose bytes reveal the byte order of the machine that wrote the file.
+            uint64_t const BYTE_ORDER_MARK = 0x0102030405060708ull;
+
+            // The number of words of the header (the magic number counts as one word).
+            uint64_t const HEADER_WORDS = 8;
+
+            enum class SectionType : uint64_t {
+                TransitionMatrix = 1, StateLabel = 2, ChoiceLabel = 3, StateRewards = 4, StateActionRewards = 5, TransitionRewards = 6, ExitRates = 7, MarkovianStates = 8
+            };
+
+            /*!
+             * Rounds the given number of bytes up to the next multiple of eight.
+             */
+            inline uint64_t padToWord(uint64_t numberOfBytes) {
+                return (numberOfBytes + 7) & ~static_cast<uint64_t>(7);
+            }
+
+        }
+    }
+}
@@ -0,0 +1,187 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <map>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+
+        namespace {
+            // The pool and the queue index of the worker that is executed by the current thread (if any).
+            thread_local ThreadPool const* currentPool = nullptr;
+            thread_local uint64_t currentQueueIndex = 0;
+        }
+
+        const uint64_t ThreadPool::DEFAULT_MINIMAL_RANGE_WEIGHT = 4096;
+
+        ThreadPool::Submission::Submission(RangeFunction const& function, uint64_t taskCount) : function(function), remainingTasks(taskCount) {
+            // Intentionally left empty.
+        }
+
+        ThreadPool::ThreadPool(uint64_t threadCount) : threadCount(threadCount), queuedTasks(0), stop(false) {
+            if (this->threadCount == 0) {
+                this->threadCount = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+            }
+
+            for (uint64_t index = 0; index < this->threadCount; ++index) {
+                queues.emplace_back(std::make_unique<TaskQueue>());
+            }
+            for (uint64_t index = 0; index + 1 < this->threadCount; ++index) {
+                workers.emplace_back([this, index] () { work(index); });
+            }
+            STORM_LOG_TRACE("Created thread pool with " << this->threadCount << " threads.");
+        }
+
+        ThreadPool::~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                stop = true;
+            }
+            wakeUp.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        uint64_t ThreadPool::getThreadCount() const {
+            return threadCount;
+        }
+
+        void ThreadPool::execute(std::vector<uint64_t> const& boundaries, RangeFunction const& function) {
+            if (boundaries.size() < 2) {
+                return;
+            }
+
+            // If there is nothing to distribute, avoid the synchronization overhead.
+            uint64_t taskCount = boundaries.size() - 1;
+            if (threadCount == 1 || taskCount == 1) {
+                for (uint64_t index = 0; index < taskCount; ++index) {
+                    function(boundaries[index], boundaries[index + 1]);
+                }
+                return;
+            }
+
+            Submission submission(function, taskCount);
+            uint64_t ownQueueIndex = getQueueIndexOfCurrentThread();
+            for (uint64_t index = 0; index < taskCount; ++index) {
+                // Distribute the tasks round-robin, starting with the queue of the submitting thread.
+                TaskQueue& queue = *queues[(ownQueueIndex + index) % queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                ++queuedTasks;
+                queue.tasks.push_back(Task{&submission, boundaries[index], boundaries[index + 1]});
+            }
+            {
+                // Acquiring the mutex makes sure that no worker misses the notification between checking for tasks
+                // and going to sleep.
+                std::lock_guard<std::mutex> lock(sleepMutex);
+            }
+            wakeUp.notify_all();
+
+            // Help with the work until all tasks of this submission are done. If there is nothing left to take, the
+            // remaining tasks are being executed by other threads, so we sleep until they are finished or new tasks
+            // (e.g. nested submissions of them) arrive.
+            Task task;
+            while (submission.remainingTasks.load(std::memory_order_acquire) > 0) {
+                if (tryTakeTask(ownQueueIndex, task)) {
+                    runTask(task);
+                } else {
+                    std::unique_lock<std::mutex> lock(sleepMutex);
+                    wakeUp.wait(lock, [this, &submission] () { return submission.remainingTasks.load(std::memory_order_acquire) == 0 || queuedTasks.load() > 0; });
+                }
+            }
+
+            if (submission.exception) {
+                std::rethrow_exception(submission.exception);
+            }
+        }
+
+        void ThreadPool::work(uint64_t queueIndex) {
+            currentPool = this;
+            currentQueueIndex = queueIndex;
+
+            Task task;
+            while (true) {
+                if (tryTakeTask(queueIndex, task)) {
+                    runTask(task);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wakeUp.wait(lock, [this] () { return stop || queuedTasks.load() > 0; });
+                if (stop && queuedTasks.load() == 0) {
+                    return;
+                }
+            }
+        }
+
+        bool ThreadPool::tryTakeTask(uint64_t queueIndex, Task& task) {
+            // First try to take the most recently added task of the own queue.
+            {
+                TaskQueue& queue = *queues[queueIndex];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.tasks.empty()) {
+                    task = queue.tasks.back();
+                    queue.tasks.pop_back();
+                    --queuedTasks;
+                    return true;
+                }
+            }
+
+            // Otherwise, steal the oldest task of another queue.
+            for (uint64_t offset = 1; offset < queues.size(); ++offset) {
+                TaskQueue& queue = *queues[(queueIndex + offset) % queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.tasks.empty()) {
+                    task = queue.tasks.front();
+                    queue.tasks.pop_front();
+                    --queuedTasks;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void ThreadPool::runTask(Task const& task) {
+            Submission& submission = *task.submission;
+            try {
+                submission.function(task.begin, task.end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(submission.exceptionMutex);
+                if (!submission.exception) {
+                    submission.exception = std::current_exception();
+                }
+            }
+            // The submission must not be accessed after its last task is finished, as the submitting thread may
+            // return from execute immediately.
+            if (submission.remainingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                wakeUp.notify_all();
+            }
+        }
+
+        uint64_t ThreadPool::getQueueIndexOfCurrentThread() const {
+            // Threads that do not belong to this pool share the last queue.
+            return currentPool == this ? currentQueueIndex : queues.size() - 1;
+        }
+
+        ThreadPool& ThreadPool::getGlobalPool() {
+            static std::mutex poolMutex;
+            static std::map<uint64_t, std::unique_ptr<ThreadPool>> pools;
+
+            // Algorithms may hold on to the pool while the settings change (e.g. in tests), so we never replace a
+            // pool but keep one per requested number of threads.
+            uint64_t threadCount = storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount();
+            std::lock_guard<std::mutex> lock(poolMutex);
+            std::unique_ptr<ThreadPool>& pool = pools[threadCount];
+            if (!pool) {
+                pool = std::make_unique<ThreadPool>(threadCount);
+            }
+            return *pool;
+        }
+
+    }
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A pool of worker threads that executes ranges of a loop in parallel. Every worker owns a queue of tasks.
+         * Workers take tasks from the back of their own queue and, once it is empty, steal tasks from the front of
+         * the other queues. The thread that submits the work participates in its execution until all tasks of the
+         * submission are finished, so nested submissions from within a task are fine.
+         */
+        class ThreadPool {
+        public:
+            typedef std::function<void (uint64_t, uint64_t)> RangeFunction;
+
+            /*!
+             * Creates a pool that executes work with the given number of threads (including the submitting thread).
+             *
+             * @param threadCount The number of threads. If zero, the number of hardware threads is used.
+             */
+            explicit ThreadPool(uint64_t threadCount);
+
+            ThreadPool(ThreadPool const&) = delete;
+            ThreadPool& operator=(ThreadPool const&) = delete;
+
+            ~ThreadPool();
+
+            /*!
+             * Retrieves the number of threads that execute the submitted work (including the submitting thread).
+             */
+            uint64_t getThreadCount() const;
+
+            /*!
+             * Executes the given function for all ranges [boundaries[i], boundaries[i + 1]) and returns once all of
+             * them have been processed. If the function throws, the first exception is rethrown after all ranges are
+             * finished.
+             */
+            void execute(std::vector<uint64_t> const& boundaries, RangeFunction const& function);
+
+            /*!
+             * Splits [0, count) into ranges of roughly equal weight. There are a few more ranges than threads, so that
+             * idle threads can steal work from busy ones, but ranges are not made lighter than the given minimal
+             * weight.
+             *
+             * @param count The number of items.
+             * @param prefixWeight A function that maps i in [0, count] to the total weight of the items before i. It
+             * needs to be monotone. For the rows of a matrix, for example, this is the number of entries before the
+             * row.
+             * @param minimalRangeWeight The weight below which work is not worth being distributed.
+             * @return The boundaries of the ranges, starting with 0 and ending with count.
+             */
+            template<typename PrefixWeightFunction>
+            std::vector<uint64_t> partition(uint64_t count, PrefixWeightFunction const& prefixWeight, uint64_t minimalRangeWeight = DEFAULT_MINIMAL_RANGE_WEIGHT) const;
+
+            /*!
+             * Splits [0, count) into ranges of roughly equal weight (see partition) and executes the function for
+             * them in parallel.
+             */
+            template<typename PrefixWeightFunction>
+            void parallelFor(uint64_t count, PrefixWeightFunction const& prefixWeight, RangeFunction const& function, uint64_t minimalRangeWeight = DEFAULT_MINIMAL_RANGE_WEIGHT);
+
+            /*!
+             * Retrieves the pool that is shared by all parallelized algorithms. Its number of threads is the one
+             * selected in the core settings. If that number changes, a separate pool is used from then on; pools are
+             * never destroyed before the end of the program, so references obtained earlier stay valid.
+             */
+            static ThreadPool& getGlobalPool();
+
+            /*!
+             * Retrieves whether computations on the given value type may be distributed among several threads. This
+             * is only the case for built-in arithmetic types: the exact types (rational numbers and functions) use
+             * reference counting and caches that are not synchronized.
+             */
+            template<typename ValueType>
+            static constexpr bool supportsParallelComputations() {
+                return std::is_arithmetic<ValueType>::value;
+            }
+
+            // The default for the minimal weight of a range.
+            static const uint64_t DEFAULT_MINIMAL_RANGE_WEIGHT;
+
+        private:
+            // The state of one call to execute.
+            struct Submission {
+                Submission(RangeFunction const& function, uint64_t taskCount);
+
+                RangeFunction const& function;
+                std::atomic<uint64_t> remainingTasks;
+                std::mutex exceptionMutex;
+                std::exception_ptr exception;
+            };
+
+            struct Task {
+                Submission* submission;
+                uint64_t begin;
+                uint64_t end;
+            };
+
+            struct TaskQueue {
+                std::mutex mutex;
+                std::deque<Task> tasks;
+            };
+
+            void work(uint64_t queueIndex);
+            bool tryTakeTask(uint64_t queueIndex, Task& task);
+            void runTask(Task const& task);
+            uint64_t getQueueIndexOfCurrentThread() const;
+
+            uint64_t threadCount;
+
+            // One queue per worker plus a queue for the threads that are not part of the pool.
+            std::vector<std::unique_ptr<TaskQueue>> queues;
+            std::vector<std::thread> workers;
+
+            // The number of tasks in all queues, used to let idle workers sleep. It is incremented before a task is
+            // pushed, so it never drops below the actual number of tasks. The condition variable is notified whenever
+            // tasks are added or the last task of a submission is finished.
+            std::atomic<uint64_t> queuedTasks;
+            std::mutex sleepMutex;
+            std::condition_variable wakeUp;
+            bool stop;
+        };
+
+        template<typename PrefixWeightFunction>
+        std::vector<uint64_t> ThreadPool::partition(uint64_t count, PrefixWeightFunction const& prefixWeight, uint64_t minimalRangeWeight) const {
+            std::vector<uint64_t> boundaries = {0};
+            uint64_t offset = prefixWeight(0);
+            uint64_t totalWeight = prefixWeight(count) - offset;
+            uint64_t rangeCount = std::min<uint64_t>(threadCount * 4, std::max<uint64_t>(1, totalWeight / std::max<uint64_t>(minimalRangeWeight, 1)));
+            rangeCount = std::min(rangeCount, std::max<uint64_t>(count, 1));
+
+            for (uint64_t range = 1; range < rangeCount; ++range) {
+                // Find the first index whose prefix weight reaches the desired portion of the total weight.
+                uint64_t targetWeight = offset + totalWeight / rangeCount * range;
+                uint64_t low = boundaries.back(), high = count;
+                while (low < high) {
+                    uint64_t middle = low + (high - low) / 2;
+                    if (prefixWeight(middle) < targetWeight) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                if (low > boundaries.back() && low < count) {
+                    boundaries.push_back(low);
+                }
+            }
+            if (count > 0) {
+                boundaries.push_back(count);
+            }
+            return boundaries;
+        }
+
+        template<typename PrefixWeightFunction>
+        void ThreadPool::parallelFor(uint64_t count, PrefixWeightFunction const& prefixWeight, RangeFunction const& function, uint64_t minimalRangeWeight) {
+            execute(partition(count, prefixWeight, minimalRangeWeight), function);
+        }
+
+    }
+}
@@ -9,19 +9,17 @@
 #include "storm-config.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/utility/macros.h"
-#include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace utility {
         
         template<typename ValueType>
-        VectorHelper<ValueType>::VectorHelper() : doParallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
-#ifndef STORM_HAVE_INTELTBB
-            STORM_LOG_THROW(!doParallelize, storm::exceptions::InvalidSettingsException, "Cannot parallelize without TBB.");
-#endif
+        VectorHelper<ValueType>::VectorHelper() : doParallelize(storm::utility::ThreadPool::supportsParallelComputations<ValueType>() && storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount() > 1) {
+            // Intentionally left empty.
         }
         
         template<typename ValueType>
@@ -31,15 +29,14 @@ namespace storm {
 
         template<typename ValueType>
         void VectorHelper<ValueType>::reduceVector(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& source, std::vector<ValueType>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
             if (this->parallelize()) {
-                storm::utility::vector::reduceVectorMinOrMaxParallel(dir, source, target, rowGrouping, choices);
+                // Reduce the groups of each range into the corresponding part of the target.
+                storm::utility::ThreadPool::getGlobalPool().parallelFor(target.size(), [&rowGrouping] (uint64_t group) { return rowGrouping[group]; }, [&] (uint64_t startGroup, uint64_t endGroup) {
+                    storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices, startGroup, endGroup);
+                });
             } else {
                 storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
             }
-#else
-            storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
-#endif
         }
 
         template<>
@@ -1,5 +1,7 @@
 #include "storm/utility/dd.h"
 
+#include <boost/algorithm/string/trim.hpp>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -7,6 +9,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/file.h"
 
 namespace storm {
     namespace utility {
@@ -50,6 +53,24 @@ namespace storm {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs);
             }
             
+            std::vector<std::string> importMetaVariableOrder(std::string const& filename) {
+                std::ifstream stream;
+                storm::utility::openFile(filename, stream);
+                
+                std::vector<std::string> result;
+                std::string line;
+                while (std::getline(stream, line)) {
+                    boost::trim(line);
+                    if (!line.empty()) {
+                        result.push_back(line);
+                    }
+                }
+                storm::utility::closeFile(stream);
+                
+                STORM_LOG_TRACE("Read order of " << result.size() << " meta variables from '" << filename << "'.");
+                return result;
+            }
+            
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "storm/storage/dd/DdType.h"
@@ -31,7 +34,47 @@ namespace storm {
 
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
-                        
+            
+            /*!
+             * Reads an order of meta variables (one name per line) as written by DdManager::exportMetaVariableOrder.
+             * Empty lines are ignored.
+             *
+             * @param filename The name of the file to read.
+             * @return The names of the meta variables in the order given in the file.
+             */
+            std::vector<std::string> importMetaVariableOrder(std::string const& filename);
+            
+            /*!
+             * Combines the given elements with the given associative operation. Instead of folding the elements into
+             * an accumulator one by one, neighbouring elements are combined pairwise in a balanced binary tree. For
+             * decision diagrams, this keeps the operands of the individual operations similar in size and avoids
+             * traversing the ever growing accumulator once per element. Also, it gives the multi-threaded DD libraries
+             * (Sylvan) fewer but larger operations to distribute over their workers. Since the order of the elements
+             * is preserved, the operation does not need to be commutative.
+             *
+             * @param elements The elements to combine.
+             * @param neutralElement The result if there are no elements.
+             * @param operation The operation that is used to combine two elements.
+             * @return The combination of all elements.
+             */
+            template <typename ElementType, typename OperationType>
+            ElementType combineBalanced(std::vector<ElementType> elements, ElementType const& neutralElement, OperationType const& operation) {
+                if (elements.empty()) {
+                    return neutralElement;
+                }
+                while (elements.size() > 1) {
+                    uint64_t numberOfCombinedElements = 0;
+                    for (uint64_t index = 0; index + 1 < elements.size(); index += 2) {
+                        elements[numberOfCombinedElements++] = operation(elements[index], elements[index + 1]);
+                    }
+                    if (elements.size() % 2 == 1) {
+                        elements[numberOfCombinedElements++] = std::move(elements.back());
+                    }
+                    elements.resize(numberOfCombinedElements, neutralElement);
+                }
+                return std::move(elements.front());
+            }
+            
         }
     }
 }
@@ -21,6 +21,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
 #include <queue>
@@ -29,10 +30,85 @@ namespace storm {
     namespace utility {
         namespace graph {
             
+            namespace {
+                // The ways in which a state that is found by a parallel search is treated.
+                enum class SearchAction { Ignore, Add, AddAndExpand };
+                
+                /*!
+                 * Searches the graph of the given matrix level by level, starting from the given states. The states of
+                 * each level are distributed among the threads of the pool, which collect the candidate successors. These
+                 * are then merged sequentially into the set of visited states and the next level.
+                 *
+                 * @param matrix The matrix whose graph to search.
+                 * @param useRowGroups If set, the successors of a state are given by its row group, otherwise by its row.
+                 * @param visited The set of visited states. States are added to it according to the actions.
+                 * @param frontier The states from which to start the search.
+                 * @param getAction A function that maps an entry of the matrix to the action for its column.
+                 */
+                template<typename T, typename ActionFunction>
+                void performParallelSearch(storm::utility::ThreadPool& pool, storm::storage::SparseMatrix<T> const& matrix, bool useRowGroups, storm::storage::BitVector& visited, std::vector<uint_fast64_t> frontier, ActionFunction const& getAction) {
+                    auto getSuccessors = [&matrix, useRowGroups] (uint_fast64_t state) { return useRowGroups ? matrix.getRowGroup(state) : matrix.getRow(state); };
+                    std::vector<uint64_t> prefixWeights;
+                    std::vector<uint_fast64_t> nextFrontier;
+                    
+                    while (!frontier.empty()) {
+                        prefixWeights.resize(frontier.size() + 1);
+                        prefixWeights[0] = 0;
+                        for (uint64_t index = 0; index < frontier.size(); ++index) {
+                            prefixWeights[index + 1] = prefixWeights[index] + 1 + getSuccessors(frontier[index]).getNumberOfEntries();
+                        }
+                        std::vector<uint64_t> boundaries = pool.partition(frontier.size(), [&prefixWeights] (uint64_t index) { return prefixWeights[index]; });
+                        
+                        // Collect the candidates of every range separately, so no synchronization is needed.
+                        std::vector<std::vector<std::pair<uint_fast64_t, bool>>> candidates(boundaries.size() - 1);
+                        pool.execute(boundaries, [&] (uint64_t begin, uint64_t end) {
+                            auto& rangeCandidates = candidates[std::distance(boundaries.begin(), std::lower_bound(boundaries.begin(), boundaries.end(), begin))];
+                            for (uint64_t index = begin; index < end; ++index) {
+                                for (auto const& entry : getSuccessors(frontier[index])) {
+                                    if (!visited.get(entry.getColumn())) {
+                                        SearchAction action = getAction(entry);
+                                        if (action != SearchAction::Ignore) {
+                                            rangeCandidates.emplace_back(entry.getColumn(), action == SearchAction::AddAndExpand);
+                                        }
+                                    }
+                                }
+                            }
+                        });
+                        
+                        nextFrontier.clear();
+                        for (auto const& rangeCandidates : candidates) {
+                            for (auto const& candidate : rangeCandidates) {
+                                if (!visited.get(candidate.first)) {
+                                    visited.set(candidate.first);
+                                    if (candidate.second) {
+                                        nextFrontier.push_back(candidate.first);
+                                    }
+                                }
+                            }
+                        }
+                        std::swap(frontier, nextFrontier);
+                    }
+                }
+            }
+            
             template<typename T>
             storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps) {
                 storm::storage::BitVector reachableStates(initialStates);
                 
+                // The search inspects the values of the entries, so it is only parallelized for thread-safe value types.
+                storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+                if (!useStepBound && pool.getThreadCount() > 1 && storm::utility::ThreadPool::supportsParallelComputations<T>()) {
+                    performParallelSearch(pool, transitionMatrix, true, reachableStates, std::vector<uint_fast64_t>(initialStates.begin(), initialStates.end()), [&] (storm::storage::MatrixEntry<uint_fast64_t, T> const& entry) {
+                        if (storm::utility::isZero(entry.getValue())) {
+                            return SearchAction::Ignore;
+                        } else if (targetStates.get(entry.getColumn())) {
+                            return SearchAction::Add;
+                        }
+                        return constraintStates.get(entry.getColumn()) ? SearchAction::AddAndExpand : SearchAction::Ignore;
+                    });
+                    return reachableStates;
+                }
+                
                 uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
                 
                 // Initialize the stack used for the DFS with the states.
@@ -246,6 +322,14 @@ namespace storm {
                 // Add all psi states as they already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+                if (!useStepBound && pool.getThreadCount() > 1) {
+                    performParallelSearch(pool, backwardTransitions, false, statesWithProbabilityGreater0, std::vector<uint_fast64_t>(psiStates.begin(), psiStates.end()), [&phiStates] (storm::storage::MatrixEntry<uint_fast64_t, T> const& entry) {
+                        return phiStates.get(entry.getColumn()) ? SearchAction::AddAndExpand : SearchAction::Ignore;
+                    });
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states.
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
@@ -542,6 +626,14 @@ namespace storm {
                 // Add all psi states as the already satisfy the condition.
                 statesWithProbabilityGreater0 |= psiStates;
                 
+                storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+                if (!useStepBound && pool.getThreadCount() > 1) {
+                    performParallelSearch(pool, backwardTransitions, false, statesWithProbabilityGreater0, std::vector<uint_fast64_t>(psiStates.begin(), psiStates.end()), [&phiStates] (storm::storage::MatrixEntry<uint_fast64_t, T> const& entry) {
+                        return phiStates.get(entry.getColumn()) ? SearchAction::AddAndExpand : SearchAction::Ignore;
+                    });
+                    return statesWithProbabilityGreater0;
+                }
+                
                 // Initialize the stack used for the DFS with the states
                 std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
                 
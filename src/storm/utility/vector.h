@@ -207,6 +207,51 @@ namespace storm {
                 }
             }
             
+            /*!
+             * Stores the given vectors (of equal size) interleaved in a single vector, i.e. entry j of the i-th vector
+             * is written to position i + j * vectors.size().
+             *
+             * @param vectors The vectors to interleave.
+             * @return The interleaved vector.
+             */
+            template<class T>
+            std::vector<T> interleaveVectors(std::vector<std::vector<T>> const& vectors) {
+                std::vector<T> result;
+                if (vectors.empty()) {
+                    return result;
+                }
+                uint_fast64_t blockSize = vectors.size();
+                result.resize(vectors.front().size() * blockSize);
+                for (uint_fast64_t vectorIndex = 0; vectorIndex < blockSize; ++vectorIndex) {
+                    STORM_LOG_ASSERT(vectors[vectorIndex].size() == vectors.front().size(), "Vectors have different sizes.");
+                    for (uint_fast64_t entry = 0; entry < vectors[vectorIndex].size(); ++entry) {
+                        result[vectorIndex + entry * blockSize] = vectors[vectorIndex][entry];
+                    }
+                }
+                return result;
+            }
+            
+            /*!
+             * Reverses interleaveVectors, i.e. splits the given interleaved vector into the given number of vectors.
+             *
+             * @param interleaved The interleaved vector.
+             * @param vectors The target vectors. Their number determines the block size and they are resized as needed.
+             */
+            template<class T>
+            void deinterleaveVectors(std::vector<T> const& interleaved, std::vector<std::vector<T>>& vectors) {
+                if (vectors.empty()) {
+                    return;
+                }
+                uint_fast64_t blockSize = vectors.size();
+                uint_fast64_t vectorSize = interleaved.size() / blockSize;
+                for (uint_fast64_t vectorIndex = 0; vectorIndex < blockSize; ++vectorIndex) {
+                    vectors[vectorIndex].resize(vectorSize);
+                    for (uint_fast64_t entry = 0; entry < vectorSize; ++entry) {
+                        vectors[vectorIndex][entry] = interleaved[vectorIndex + entry * blockSize];
+                    }
+                }
+            }
+            
             /*!
              * Selects values from a vector at the specified positions and writes them into another vector as often as given by
              * the size of the corresponding group of elements.
@@ -664,19 +709,25 @@ namespace storm {
              * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
              * return true iff v1 is supposed to be taken instead of v2.
              * @param choices If non-null, this vector is used to store the choices made during the selection.
+             * @param startGroup The first row group that is to be reduced.
+             * @param endGroup The row group after the last one that is to be reduced. The entries of the target (and
+             * choices) vector that belong to other groups are left untouched.
              */
             template<class T, class Filter>
-            void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
+            void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices, uint_fast64_t startGroup, uint_fast64_t endGroup) {
+                if (startGroup == endGroup) {
+                    return;
+                }
                 Filter f;
-                typename std::vector<T>::iterator targetIt = target.begin();
-                typename std::vector<T>::iterator targetIte = target.end();
-                typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin();
-                typename std::vector<T>::const_iterator sourceIt = source.begin();
+                typename std::vector<T>::iterator targetIt = target.begin() + startGroup;
+                typename std::vector<T>::iterator targetIte = target.begin() + endGroup;
+                typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startGroup;
+                typename std::vector<T>::const_iterator sourceIt = source.begin() + *rowGroupingIt;
                 typename std::vector<T>::const_iterator sourceIte;
                 typename std::vector<uint_fast64_t>::iterator choiceIt;
                 uint_fast64_t localChoice;
                 if (choices != nullptr) {
-                    choiceIt = choices->begin();
+                    choiceIt = choices->begin() + startGroup;
                 }
                 
                 for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt, ++choiceIt) {
@@ -702,6 +753,21 @@ namespace storm {
                 }
             }
             
+            /*!
+             * Reduces the given source vector by selecting an element according to the given filter out of each row group.
+             *
+             * @param source The source vector which is to be reduced.
+             * @param target The target vector into which a single element from each row group is written.
+             * @param rowGrouping A vector that specifies the begin and end of each group of elements in the values vector.
+             * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
+             * return true iff v1 is supposed to be taken instead of v2.
+             * @param choices If non-null, this vector is used to store the choices made during the selection.
+             */
+            template<class T, class Filter>
+            void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
+                reduceVector<T, Filter>(source, target, rowGrouping, choices, 0, target.size());
+            }
+            
 #ifdef STORM_HAVE_INTELTBB
             template<class T, class Filter>
             void reduceVectorParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
@@ -767,6 +833,20 @@ namespace storm {
                 }
             }
             
+            /*!
+             * Reduces the row groups in [startGroup, endGroup) of the given source vector by selecting either the
+             * smallest or the largest element out of each of them. The other entries of the target (and choices)
+             * vector are left untouched.
+             */
+            template<class T>
+            void reduceVectorMinOrMax(storm::solver::OptimizationDirection dir, std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices, uint_fast64_t startGroup, uint_fast64_t endGroup) {
+                if (dir == storm::solver::OptimizationDirection::Minimize) {
+                    reduceVector<T, std::less<T>>(source, target, rowGrouping, choices, startGroup, endGroup);
+                } else {
+                    reduceVector<T, std::greater<T>>(source, target, rowGrouping, choices, startGroup, endGroup);
+                }
+            }
+            
 #ifdef STORM_HAVE_INTELTBB
             template<class T>
             void reduceVectorMinOrMaxParallel(storm::solver::OptimizationDirection dir, std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) {
@@ -319,3 +319,44 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+
+TEST(DdPrismModelBuilderTest_Sylvan, MetaVariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    
+    // Reverse the order in which the variables are declared.
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.metaVariableOrder = std::vector<std::string>({"d", "s"});
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    
+    std::vector<std::string> order = model->getManager().getMetaVariableOrder();
+    auto dIt = std::find(order.begin(), order.end(), "d");
+    auto sIt = std::find(order.begin(), order.end(), "s");
+    ASSERT_TRUE(dIt != order.end() && sIt != order.end());
+    EXPECT_TRUE(dIt < sIt);
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, MetaVariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    
+    // Reverse the order in which the variables are declared.
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+    options.metaVariableOrder = std::vector<std::string>({"d", "s"});
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    
+    std::vector<std::string> order = model->getManager().getMetaVariableOrder();
+    auto dIt = std::find(order.begin(), order.end(), "d");
+    auto sIt = std::find(order.begin(), order.end(), "s");
+    ASSERT_TRUE(dIt != order.end() && sIt != order.end());
+    EXPECT_TRUE(dIt < sIt);
+    
+    // Reordering must not change the model.
+    model->getManager().triggerReordering();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+}
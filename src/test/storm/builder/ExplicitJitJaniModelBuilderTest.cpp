@@ -8,6 +8,10 @@
 #include "storm/storage/jani/Model.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/JitBuilderSettings.h"
+#include "storm/utility/cli.h"
+
+#include <boost/filesystem.hpp>
 
 TEST(ExplicitJitJaniModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -158,3 +162,61 @@ TEST(ExplicitJitJaniModelBuilderTest, IllegalSynchronizingWrites) {
     ASSERT_THROW(storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel, options).build(), storm::exceptions::WrongFormatException);
 }
 
+namespace {
+    uint64_t getNumberOfCachedFiles() {
+        // The builders are cached in the default cache directory as the tests do not set a different one.
+        boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / "storm-jit-cache";
+        if (!boost::filesystem::exists(cacheDirectory)) {
+            return 0;
+        }
+        return std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator());
+    }
+    
+    bool rowContainsValue(storm::storage::SparseMatrix<double> const& matrix, uint64_t row, double value) {
+        for (auto const& entry : matrix.getRow(row)) {
+            if (std::abs(entry.getValue() - value) < 1e-12) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TEST(ExplicitJitJaniModelBuilderTest, Cache) {
+    std::unique_ptr<storm::settings::SettingMemento> cache = storm::settings::mutableJitBuilderSettings().overrideCacheSet(true);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm");
+    storm::jani::Model janiModel = program.toJani();
+    storm::jani::Model definedModel = janiModel.defineUndefinedConstants(storm::utility::cli::parseConstantDefinitionString(janiModel.getManager(), "p=0.5"));
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(definedModel).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    uint64_t initialState = *model->getInitialStates().begin();
+    EXPECT_TRUE(rowContainsValue(model->getTransitionMatrix(), initialState, 0.5));
+    uint64_t numberOfCachedFiles = getNumberOfCachedFiles();
+    EXPECT_LT(0ul, numberOfCachedFiles);
+    
+    // Building the same model again must reuse the cached builder.
+    model = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(definedModel).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    EXPECT_EQ(numberOfCachedFiles, getNumberOfCachedFiles());
+    
+    // The probability p does not influence the state space, so it is passed to the cached builder at runtime.
+    definedModel = janiModel.defineUndefinedConstants(storm::utility::cli::parseConstantDefinitionString(janiModel.getManager(), "p=0.3"));
+    model = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(definedModel).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    EXPECT_EQ(numberOfCachedFiles, getNumberOfCachedFiles());
+    initialState = *model->getInitialStates().begin();
+    EXPECT_TRUE(rowContainsValue(model->getTransitionMatrix(), initialState, 0.3));
+    EXPECT_TRUE(rowContainsValue(model->getTransitionMatrix(), initialState, 0.7));
+    
+    // The same holds if the structural constants were already substituted as done when preprocessing the input.
+    definedModel = definedModel.substituteConstants(definedModel.getNonStructuralConstants());
+    model = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(definedModel).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    initialState = *model->getInitialStates().begin();
+    EXPECT_TRUE(rowContainsValue(model->getTransitionMatrix(), initialState, 0.3));
+}
@@ -120,6 +120,76 @@ TEST(ExplicitPrismModelBuilderTest, Ma) {
     EXPECT_EQ(7ul, model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates().getNumberOfSetBits());
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    std::vector<std::pair<std::string, bool>> files = {{"/dtmc/crowds-5-5.pm", false}, {"/dtmc/brp-16-2.pm", false}, {"/ctmc/embedded2.sm", true}, {"/mdp/coin2-2.nm", false}, {"/ma/stream2.ma", false}};
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.explorationThreads = 4;
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions = parallelOptions;
+    sequentialOptions.explorationThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options compressedParallelOptions = parallelOptions;
+    compressedParallelOptions.treeCompressedStateStorage = true;
+    
+    for (auto const& fileCtmcPair : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + fileCtmcPair.first, fileCtmcPair.second);
+        storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        
+        // The parallel exploration must not only find the same model, but also number the states in the same way.
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+        
+        // The threads also need to look up the known states in a tree-compressed state storage.
+        std::shared_ptr<storm::models::sparse::Model<double>> compressedParallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, compressedParallelOptions).build();
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == compressedParallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == compressedParallelModel->getStateLabeling());
+        
+        ASSERT_EQ(sequentialModel->getRewardModels().size(), parallelModel->getRewardModels().size());
+        for (auto const& nameRewardModelPair : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(nameRewardModelPair.first);
+            ASSERT_EQ(nameRewardModelPair.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(nameRewardModelPair.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, TreeCompressedStateStorage) {
+    std::vector<std::pair<std::string, bool>> files = {{"/dtmc/crowds-5-5.pm", false}, {"/ctmc/embedded2.sm", true}, {"/mdp/coin2-2.nm", false}, {"/ma/stream2.ma", false}};
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    // Use the depth-first order, such that the state indices need to be remapped.
+    options.explorationOrder = storm::builder::ExplorationOrder::Dfs;
+    storm::builder::ExplicitModelBuilder<double>::Options compressedOptions = options;
+    compressedOptions.treeCompressedStateStorage = true;
+    
+    for (auto const& fileCtmcPair : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + fileCtmcPair.first, fileCtmcPair.second);
+        storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+        generatorOptions.setBuildStateValuations(true);
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> compressedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, compressedOptions).build();
+        
+        // The way the states are stored must not influence the model.
+        EXPECT_EQ(model->getNumberOfStates(), compressedModel->getNumberOfStates());
+        EXPECT_TRUE(model->getTransitionMatrix() == compressedModel->getTransitionMatrix());
+        EXPECT_EQ(model->getInitialStates(), compressedModel->getInitialStates());
+        EXPECT_TRUE(model->getStateLabeling() == compressedModel->getStateLabeling());
+        for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+            EXPECT_EQ(model->getStateValuations().getStateInfo(state), compressedModel->getStateValuations().getStateInfo(state));
+        }
+    }
+}
+
 TEST(ExplicitPrismModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
 
@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(GuardIndexTest, ProgramCounter) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable pc = manager->declareIntegerVariable("pc");
+    
+    // Pack b into the first bit and pc (ranging from 1 to 4) into the two following bits.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(b, 0);
+    variableInformation.integerVariables.emplace_back(pc, 1, 4, 1, 2);
+    variableInformation.totalBitOffset = 3;
+    
+    std::vector<storm::expressions::Expression> guards;
+    guards.push_back(pc == manager->integer(1) && b);
+    guards.push_back(manager->integer(2) == pc);
+    guards.push_back(!b);
+    guards.push_back(b && pc == manager->integer(2) && pc > manager->integer(0));
+    guards.push_back(pc == manager->integer(7));
+    std::vector<uint64_t> items = {10, 11, 12, 13, 14};
+    
+    storm::generator::GuardIndex index(items, guards, variableInformation);
+    EXPECT_TRUE(index.isDiscriminating());
+    
+    storm::generator::CompressedState state(3);
+    state.setFromInt(1, 2, 0);
+    EXPECT_EQ(std::vector<uint64_t>({10, 12}), index.getCandidates(state));
+    state.setFromInt(1, 2, 1);
+    EXPECT_EQ(std::vector<uint64_t>({11, 12, 13}), index.getCandidates(state));
+    state.setFromInt(1, 2, 3);
+    EXPECT_EQ(std::vector<uint64_t>({12}), index.getCandidates(state));
+    
+    // If no guard fixes a variable, all items are candidates.
+    storm::generator::GuardIndex trivialIndex({0, 1}, {pc > manager->integer(1), pc < manager->integer(3)}, variableInformation);
+    EXPECT_FALSE(trivialIndex.isDiscriminating());
+    EXPECT_EQ(std::vector<uint64_t>({0, 1}), trivialIndex.getCandidates(state));
+}
+
+TEST(GuardIndexTest, Degenerate) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    
+    // Pack x (ranging from 0 to 65535) into the first 16 bits and y (ranging from 0 to 3) into the two following bits.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.integerVariables.emplace_back(x, 0, 65535, 0, 16);
+    variableInformation.integerVariables.emplace_back(y, 0, 3, 16, 2);
+    variableInformation.totalBitOffset = 18;
+    
+    storm::generator::CompressedState state(18);
+    state.setFromInt(0, 16, 3);
+    
+    // If most guards do not fix the variable, the index barely discriminates the items.
+    std::vector<storm::expressions::Expression> guards;
+    std::vector<uint64_t> items;
+    guards.push_back(x == manager->integer(3));
+    items.push_back(0);
+    for (uint64_t i = 1; i < 10; ++i) {
+        guards.push_back(y == manager->integer(i % 4) || x > manager->integer(i));
+        items.push_back(i);
+    }
+    storm::generator::GuardIndex unselectiveIndex(items, guards, variableInformation);
+    EXPECT_FALSE(unselectiveIndex.isDiscriminating());
+    EXPECT_EQ(items, unselectiveIndex.getCandidates(state));
+    
+    // If a few guards that do not fix the variable had to be copied to the candidates of every value of the wide
+    // variable, the index would grow too large.
+    guards.clear();
+    items.clear();
+    for (uint64_t i = 0; i < 40; ++i) {
+        guards.push_back(x == manager->integer(i));
+        items.push_back(i);
+    }
+    guards.push_back(y == manager->integer(1));
+    items.push_back(40);
+    storm::generator::GuardIndex compactIndex(items, guards, variableInformation);
+    EXPECT_TRUE(compactIndex.isDiscriminating());
+    EXPECT_EQ(std::vector<uint64_t>({3, 40}), compactIndex.getCandidates(state));
+    state.setFromInt(0, 16, 1000);
+    EXPECT_EQ(std::vector<uint64_t>({40}), compactIndex.getCandidates(state));
+    
+    guards.push_back(x == manager->integer(65535));
+    items.push_back(41);
+    storm::generator::GuardIndex wideIndex(items, guards, variableInformation);
+    EXPECT_FALSE(wideIndex.isDiscriminating());
+    EXPECT_EQ(items, wideIndex.getCandidates(state));
+}
@@ -10,6 +10,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
+#include "storm/settings/modules/AbstractionSettings.h"
 
 #include "storm/api/storm.h"
 
@@ -154,3 +155,39 @@ TEST(GameBasedMdpModelCheckerTest, DISABLED_Dice_Sylvan) {
     
     EXPECT_NEAR(0.083333283662796020508, quantitativeResult6[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+#if defined STORM_HAVE_MSAT
+TEST(GameBasedMdpModelCheckerTest, WarmStartMatchesColdStart_Cudd) {
+#else
+TEST(GameBasedMdpModelCheckerTest, DISABLED_WarmStartMatchesColdStart_Cudd) {
+#endif
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm";
+    
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [F \"three\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [F \"four\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [F \"done\"]"));
+    
+    // The quantitative results of previous refinement steps are only used as starting point, so the results must
+    // not depend on whether they are reused.
+    storm::settings::mutableAbstractionSettings().setReuseMode(storm::settings::modules::AbstractionSettings::ReuseMode::All);
+    auto warmStartModelchecker = std::make_shared<storm::modelchecker::GameBasedMdpModelChecker<storm::dd::DdType::CUDD, storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>>(program);
+    storm::settings::mutableAbstractionSettings().setReuseMode(storm::settings::modules::AbstractionSettings::ReuseMode::None);
+    auto coldStartModelchecker = std::make_shared<storm::modelchecker::GameBasedMdpModelChecker<storm::dd::DdType::CUDD, storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>>(program);
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+    
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+        
+        std::unique_ptr<storm::modelchecker::CheckResult> warmStartResult = warmStartModelchecker->check(task);
+        std::unique_ptr<storm::modelchecker::CheckResult> coldStartResult = coldStartModelchecker->check(task);
+        
+        EXPECT_NEAR(coldStartResult->asExplicitQuantitativeCheckResult<double>()[0], warmStartResult->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision()) << *formula;
+    }
+}
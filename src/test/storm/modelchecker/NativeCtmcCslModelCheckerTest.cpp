@@ -9,6 +9,7 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
@@ -224,3 +225,49 @@ TEST(NativeCtmcCslModelCheckerTest, Tandem) {
     storm::modelchecker::ExplicitQuantitativeCheckResult<double> quantitativeCheckResult6 = checkResult->asExplicitQuantitativeCheckResult<double>();
     EXPECT_NEAR(262.78584491454814, quantitativeCheckResult6[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+TEST(NativeCtmcCslModelCheckerTest, LongTimeBound) {
+    // State 0 reaches the absorbing state 1 with rate 0.001 and state 2 reaches it with rate 10. The states 3 and 4
+    // alternate with rate 10 and never reach it, which forces a large uniformization rate.
+    storm::storage::SparseMatrixBuilder<double> builder(5, 5, 4);
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.001));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 10));
+    ASSERT_NO_THROW(builder.addNextValue(3, 4, 10));
+    ASSERT_NO_THROW(builder.addNextValue(4, 3, 10));
+    storm::storage::SparseMatrix<double> rateMatrix;
+    ASSERT_NO_THROW(rateMatrix = builder.build());
+    std::vector<double> exitRates = {0.001, 0, 10, 10, 10};
+    
+    storm::storage::BitVector maybeStates(5, true);
+    maybeStates.set(1, false);
+    std::vector<double> initialValues = {0, 1, 0, 0, 0};
+    double uniformizationRate = 10.2;
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    
+    // With lambda = 10200, the time horizon is split into several segments. The value of state 0 changes slowly, so
+    // none of the iterations may be skipped.
+    std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(rateMatrix, maybeStates, exitRates, 1000.0, uniformizationRate, initialValues);
+    EXPECT_NEAR(1 - std::exp(-1.0), result[0], precision);
+    EXPECT_NEAR(1, result[1], precision);
+    EXPECT_NEAR(1, result[2], precision);
+    EXPECT_NEAR(0, result[3], precision);
+    EXPECT_NEAR(0, result[4], precision);
+    
+    // For a much longer horizon, the values become stationary and the remaining iterations are skipped.
+    result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(rateMatrix, maybeStates, exitRates, 100000.0, uniformizationRate, initialValues);
+    EXPECT_NEAR(1, result[0], precision);
+    EXPECT_NEAR(1, result[2], precision);
+    EXPECT_NEAR(0, result[3], precision);
+    
+    // Without state 0, the values are stationary after a few iterations of the first segment, so the following segments are skipped.
+    maybeStates.set(0, false);
+    result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(rateMatrix, maybeStates, exitRates, 1000.0, uniformizationRate, initialValues);
+    EXPECT_NEAR(0, result[0], precision);
+    EXPECT_NEAR(1, result[2], precision);
+    EXPECT_NEAR(0, result[4], precision);
+    
+    // A short horizon that is not split, compared with the closed form of state 0.
+    maybeStates.set(0, true);
+    result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(rateMatrix, maybeStates, exitRates, 100.0, uniformizationRate, initialValues);
+    EXPECT_NEAR(1 - std::exp(-0.1), result[0], precision);
+}
@@ -517,3 +517,94 @@ TEST(NativeMdpPrctlModelCheckerTest, LRA) {
         EXPECT_NEAR(0.3 / 3., quantitativeResult2[14], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
     }
 }
+
+TEST(NativeMdpPrctlModelCheckerTest, SharedPrecomputationCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Mdp);
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+
+    // Several of the properties share their precomputations, e.g. the Prob01 sets of "two" or the maximal end components.
+    std::vector<std::string> formulasAsString = {"Pmin=? [F \"two\"]", "Pmax=? [F \"two\"]", "Pmin=? [F \"two\"]", "Pmax=? [!\"three\" U \"two\"]", "Rmin=? [F \"done\"]", "Rmax=? [F \"done\"]", "Rmin=? [F \"done\"]", "LRAmax=? [\"done\"]", "LRAmin=? [\"done\"]", "LRAmax=? [\"two\"]"};
+
+    auto precomputationCache = std::make_shared<storm::modelchecker::helper::SparseMdpPrecomputationCache<double>>();
+    for (auto const& formulaAsString : formulasAsString) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaAsString);
+
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> uncachedChecker(*mdp, std::make_unique<storm::solver::NativeMinMaxLinearEquationSolverFactory<double>>());
+        std::unique_ptr<storm::modelchecker::CheckResult> uncachedResult = uncachedChecker.check(*formula);
+
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> cachedChecker(*mdp, std::make_unique<storm::solver::NativeMinMaxLinearEquationSolverFactory<double>>());
+        cachedChecker.setPrecomputationCache(precomputationCache);
+        std::unique_ptr<storm::modelchecker::CheckResult> cachedResult = cachedChecker.check(*formula);
+
+        std::vector<double> const& uncachedValues = uncachedResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        std::vector<double> const& cachedValues = cachedResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(uncachedValues.size(), cachedValues.size());
+        for (uint64_t state = 0; state < uncachedValues.size(); ++state) {
+            EXPECT_EQ(uncachedValues[state], cachedValues[state]) << formulaAsString << " in state " << state;
+        }
+    }
+}
+
+TEST(NativeMdpPrctlModelCheckerTest, AnnouncedRewardsWithSameTarget) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 3, 7, true, true, 3);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(0, 2, 0.5);
+    matrixBuilder.addNextValue(1, 0, 0.5);
+    matrixBuilder.addNextValue(1, 2, 0.5);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 1.0);
+    matrixBuilder.addNextValue(3, 2, 1.0);
+    matrixBuilder.newRowGroup(4);
+    matrixBuilder.addNextValue(4, 2, 1.0);
+    
+    storm::models::sparse::StateLabeling stateLabeling(3);
+    stateLabeling.addLabel("init");
+    stateLabeling.addLabelToState("init", 0);
+    stateLabeling.addLabel("target");
+    stateLabeling.addLabelToState("target", 2);
+    
+    // The two reward models are maximized by different choices in state 1.
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("first", storm::models::sparse::StandardRewardModel<double>(boost::none, std::vector<double>({1.0, 2.0, 3.0, 0.0, 0.0})));
+    rewardModels.emplace("second", storm::models::sparse::StandardRewardModel<double>(boost::none, std::vector<double>({2.0, 1.0, 0.0, 4.0, 0.0})));
+    storm::models::sparse::Mdp<double> mdp(matrixBuilder.build(), stateLabeling, rewardModels);
+    
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> firstFormula = formulaParser.parseSingleFormulaFromString("R{\"first\"}max=? [F \"target\"]");
+    std::shared_ptr<storm::logic::Formula const> secondFormula = formulaParser.parseSingleFormulaFromString("R{\"second\"}max=? [F \"target\"]");
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> firstTask(*firstFormula);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> secondTask(*secondFormula);
+    
+    auto precomputationCache = std::make_shared<storm::modelchecker::helper::SparseMdpPrecomputationCache<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(mdp, std::make_unique<storm::solver::NativeMinMaxLinearEquationSolverFactory<double>>());
+    checker.setPrecomputationCache(precomputationCache);
+    checker.announceTask(firstTask);
+    checker.announceTask(secondTask);
+    
+    // Checking the first task also computes the second one.
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(firstTask);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(5.0, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(8.0, quantitativeResult1[1], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    storm::storage::BitVector targetStates(3);
+    targetStates.set(2);
+    std::vector<double> secondChoiceRewards = mdp.getRewardModel("second").getTotalRewardVector(mdp.getTransitionMatrix().getRowCount(), mdp.getTransitionMatrix(), storm::storage::BitVector(3, true));
+    boost::optional<std::vector<double>> secondValues = precomputationCache->retrieveReachabilityRewards(storm::OptimizationDirection::Maximize, targetStates, secondChoiceRewards);
+    ASSERT_TRUE(static_cast<bool>(secondValues));
+    EXPECT_NEAR(4.0, secondValues.get()[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(4.0, secondValues.get()[1], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    
+    // Without a stored result, the second task is computed on its own.
+    result = checker.check(secondTask);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(4.0, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+    EXPECT_NEAR(4.0, quantitativeResult2[1], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+}
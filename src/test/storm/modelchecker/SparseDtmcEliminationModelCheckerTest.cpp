@@ -9,6 +9,8 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/parser/AutoParser.h"
 
@@ -135,3 +137,46 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeaderParallelScc) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/leader4_8.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4_8.lab", "", STORM_TEST_RESOURCES_DIR "/rew/leader4_8.pick.trans.rew");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"elected\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("R=? [F \"elected\"]"));
+
+    // The mementos restore the settings even if an assertion fails.
+    std::unique_ptr<storm::settings::SettingMemento> threadCount = storm::settings::mutableCoreSettings().overrideThreadCount(4);
+
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> stateResult = checker.check(*formula);
+
+        // The leaf SCCs are only eliminated in parallel by the hybrid elimination.
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult;
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> eliminationMethod = storm::settings::mutableEliminationSettings().overrideEliminationMethod(storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid);
+            sequentialResult = checker.check(*formula);
+            std::unique_ptr<storm::settings::SettingMemento> parallelScc = storm::settings::mutableEliminationSettings().overrideParallelSccEliminationSet(true);
+            parallelResult = checker.check(*formula);
+        }
+
+        std::vector<double> const& stateValues = stateResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        std::vector<double> const& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        std::vector<double> const& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(stateValues.size(), sequentialValues.size());
+        ASSERT_EQ(stateValues.size(), parallelValues.size());
+        for (uint_fast64_t state = 0; state < stateValues.size(); ++state) {
+            EXPECT_NEAR(stateValues[state], sequentialValues[state], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+            EXPECT_NEAR(sequentialValues[state], parallelValues[state], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/parser/FormulaParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> buildMarkovAutomaton(storm::prism::Program const& program, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(formulas)).build();
+        EXPECT_EQ(storm::models::ModelType::MarkovAutomaton, model->getType());
+        return model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    }
+
+    double checkTimeBoundedProperty(storm::models::sparse::MarkovAutomaton<double> const& ma, storm::logic::Formula const& formula, storm::solver::MaBoundedReachabilityMethod const& method) {
+        storm::settings::mutableMinMaxEquationSolverSettings().setMarkovAutomatonBoundedReachabilityMethod(method);
+        storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(ma);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(formula);
+        storm::settings::mutableMinMaxEquationSolverSettings().setMarkovAutomatonBoundedReachabilityMethod(storm::solver::MaBoundedReachabilityMethod::Imca);
+        return result->asExplicitQuantitativeCheckResult<double>()[*ma.getInitialStates().begin()];
+    }
+}
+
+TEST(SparseMaCslModelCheckerTest, SimpleTimeBounded) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+    storm::parser::FormulaParser formulaParser(program);
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [ F<=1 s=4 ]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [ F<=1 s=4 ]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [ F<=1 s=3 ]"));
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> ma = buildMarkovAutomaton(program, formulas);
+
+    // Unif+ guarantees the precision, whereas digitization only approximately does.
+    double precision = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    double digitizationPrecision = 10 * precision;
+
+    // Taking beta until state 2 is reached leaves a single Markovian transition with rate 12.
+    EXPECT_NEAR(1 - std::exp(-12.0), checkTimeBoundedProperty(*ma, *formulas[0], storm::solver::MaBoundedReachabilityMethod::Imca), digitizationPrecision);
+    EXPECT_NEAR(1 - std::exp(-12.0), checkTimeBoundedProperty(*ma, *formulas[0], storm::solver::MaBoundedReachabilityMethod::UnifPlus), precision);
+
+    // Always taking alpha never reaches state 4.
+    EXPECT_NEAR(0, checkTimeBoundedProperty(*ma, *formulas[1], storm::solver::MaBoundedReachabilityMethod::Imca), digitizationPrecision);
+    EXPECT_NEAR(0, checkTimeBoundedProperty(*ma, *formulas[1], storm::solver::MaBoundedReachabilityMethod::UnifPlus), precision);
+
+    // Always taking alpha leaves state 1 towards state 3 with rate 1.
+    EXPECT_NEAR(1 - std::exp(-1.0), checkTimeBoundedProperty(*ma, *formulas[2], storm::solver::MaBoundedReachabilityMethod::Imca), digitizationPrecision);
+    EXPECT_NEAR(1 - std::exp(-1.0), checkTimeBoundedProperty(*ma, *formulas[2], storm::solver::MaBoundedReachabilityMethod::UnifPlus), precision);
+}
+
+TEST(SparseMaCslModelCheckerTest, ServerTimeBoundedImcaMatchesUnifPlus) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/server.ma");
+    storm::parser::FormulaParser formulaParser(program);
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [ F<=1 \"error\" ]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [ F<=1 \"error\" ]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [ F<=2 \"processB\" ]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [ F<=2 \"processB\" ]"));
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> ma = buildMarkovAutomaton(program, formulas);
+
+    // Unif+ guarantees the precision, whereas digitization only approximately does.
+    double digitizationPrecision = 10 * storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision();
+    for (auto const& formula : formulas) {
+        double imcaValue = checkTimeBoundedProperty(*ma, *formula, storm::solver::MaBoundedReachabilityMethod::Imca);
+        double unifPlusValue = checkTimeBoundedProperty(*ma, *formula, storm::solver::MaBoundedReachabilityMethod::UnifPlus);
+        EXPECT_NEAR(imcaValue, unifPlusValue, digitizationPrecision) << *formula;
+    }
+}
@@ -6,8 +6,11 @@
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/MultiObjectiveSettings.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/api/storm.h"
 
@@ -108,6 +111,39 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, dpm) {
 }
 
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, paretoParallelWeightVectors) {
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_consensus2_3_2.nm";
+    std::string formulasAsString = "multi(Pmax=? [ F \"one_proc_err\" ], Pmax=? [ G \"one_coin_ok\" ])"; // pareto
+    
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    
+    // With a single thread, the weight vectors of a round are checked one after another by the same checker.
+    storm::settings::mutableMultiObjectiveSettings().setNumberOfParallelWeightVectors(3);
+    storm::settings::mutableCoreSettings().setThreadCount(1);
+    std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(*mdp, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    storm::settings::mutableCoreSettings().setThreadCount(4);
+    std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(*mdp, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    storm::settings::mutableCoreSettings().setThreadCount(1);
+    storm::settings::mutableMultiObjectiveSettings().setNumberOfParallelWeightVectors(1);
+    
+    ASSERT_TRUE(sequentialResult->isExplicitParetoCurveCheckResult());
+    ASSERT_TRUE(parallelResult->isExplicitParetoCurveCheckResult());
+    std::vector<std::vector<double>> const& sequentialPoints = sequentialResult->asExplicitParetoCurveCheckResult<double>().getPoints();
+    std::vector<std::vector<double>> const& parallelPoints = parallelResult->asExplicitParetoCurveCheckResult<double>().getPoints();
+    ASSERT_EQ(sequentialPoints.size(), parallelPoints.size());
+    for (uint_fast64_t pointIndex = 0; pointIndex < sequentialPoints.size(); ++pointIndex) {
+        ASSERT_EQ(sequentialPoints[pointIndex].size(), parallelPoints[pointIndex].size());
+        for (uint_fast64_t objIndex = 0; objIndex < sequentialPoints[pointIndex].size(); ++objIndex) {
+            EXPECT_NEAR(sequentialPoints[pointIndex][objIndex], parallelPoints[pointIndex][objIndex], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+        }
+    }
+}
+
 
 
 #endif /* STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE */
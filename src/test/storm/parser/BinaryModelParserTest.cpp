@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/parser/BinaryModelParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/utility/BinaryModelExporter.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    std::vector<uint64_t> exportToBuffer(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        std::ostringstream stream;
+        storm::exporter::exportSparseModelAsBinary(stream, model);
+        std::string data = stream.str();
+
+        // Copy the data to a properly aligned buffer.
+        std::vector<uint64_t> buffer((data.size() + 7) / 8);
+        std::memcpy(buffer.data(), data.data(), data.size());
+        return buffer;
+    }
+}
+
+TEST(BinaryModelParserTest, RoundTrip) {
+    std::vector<std::pair<std::string, bool>> files = {{"/dtmc/brp-16-2.pm", false}, {"/ctmc/embedded2.sm", true}, {"/mdp/coin2-2.nm", false}, {"/ma/stream2.ma", false}};
+    for (auto const& fileCtmcPair : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + fileCtmcPair.first, fileCtmcPair.second);
+        storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+        generatorOptions.setBuildChoiceLabels(true);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+
+        std::vector<uint64_t> buffer = exportToBuffer(model);
+        std::shared_ptr<storm::models::sparse::Model<double>> loadedModel = storm::parser::BinaryModelParser<double>::parseModelFromBuffer(reinterpret_cast<char const*>(buffer.data()), buffer.size() * sizeof(uint64_t));
+
+        ASSERT_EQ(model->getType(), loadedModel->getType());
+        EXPECT_EQ(model->getNumberOfStates(), loadedModel->getNumberOfStates());
+        EXPECT_TRUE(model->getTransitionMatrix() == loadedModel->getTransitionMatrix());
+        EXPECT_EQ(model->getTransitionMatrix().hasTrivialRowGrouping(), loadedModel->getTransitionMatrix().hasTrivialRowGrouping());
+        EXPECT_EQ(model->getInitialStates(), loadedModel->getInitialStates());
+        EXPECT_TRUE(model->getStateLabeling() == loadedModel->getStateLabeling());
+        ASSERT_TRUE(model->hasChoiceLabeling());
+        if (model->getChoiceLabeling().getNumberOfLabels() > 0) {
+            ASSERT_TRUE(loadedModel->hasChoiceLabeling());
+            EXPECT_TRUE(model->getChoiceLabeling() == loadedModel->getChoiceLabeling());
+        }
+
+        ASSERT_EQ(model->getRewardModels().size(), loadedModel->getRewardModels().size());
+        for (auto const& nameRewardModelPair : model->getRewardModels()) {
+            auto const& loadedRewardModel = loadedModel->getRewardModel(nameRewardModelPair.first);
+            ASSERT_EQ(nameRewardModelPair.second.hasStateRewards(), loadedRewardModel.hasStateRewards());
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), loadedRewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(nameRewardModelPair.second.hasStateActionRewards(), loadedRewardModel.hasStateActionRewards());
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), loadedRewardModel.getStateActionRewardVector());
+            }
+        }
+
+        if (model->isOfType(storm::models::ModelType::Ctmc)) {
+            EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), loadedModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+        } else if (model->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            auto markovAutomaton = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+            auto loadedMarkovAutomaton = loadedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+            EXPECT_EQ(markovAutomaton->getExitRates(), loadedMarkovAutomaton->getExitRates());
+            EXPECT_EQ(markovAutomaton->getMarkovianStates(), loadedMarkovAutomaton->getMarkovianStates());
+        }
+    }
+}
+
+TEST(BinaryModelParserTest, Corrupted) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    std::vector<uint64_t> buffer = exportToBuffer(model);
+
+    // A truncated file.
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModelFromBuffer(reinterpret_cast<char const*>(buffer.data()), (buffer.size() - 1) * sizeof(uint64_t)), storm::exceptions::WrongFormatException);
+
+    // A file of an unsupported version.
+    ++buffer[1];
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModelFromBuffer(reinterpret_cast<char const*>(buffer.data()), buffer.size() * sizeof(uint64_t)), storm::exceptions::WrongFormatException);
+
+    // Not a binary model at all.
+    buffer[0] = 0;
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModelFromBuffer(reinterpret_cast<char const*>(buffer.data()), buffer.size() * sizeof(uint64_t)), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryModelParserTest, CorruptedRowGroups) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    std::vector<uint64_t> buffer = exportToBuffer(model);
+
+    // Find the row group indices of the transition matrix in the exported data.
+    std::vector<uint_fast64_t> const& rowGroupIndices = model->getTransitionMatrix().getRowGroupIndices();
+    auto rowGroupIt = std::search(buffer.begin(), buffer.end(), rowGroupIndices.begin(), rowGroupIndices.end(), [] (uint64_t word, uint_fast64_t index) { return word == index; });
+    ASSERT_TRUE(rowGroupIt != buffer.end());
+
+    // Row groups that are not sorted (but still start at zero and end at the number of rows).
+    std::swap(*(rowGroupIt + 1), *(rowGroupIt + 2));
+    EXPECT_THROW(storm::parser::BinaryModelParser<double>::parseModelFromBuffer(reinterpret_cast<char const*>(buffer.data()), buffer.size() * sizeof(uint64_t)), storm::exceptions::WrongFormatException);
+}
@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/settings/modules/GmmxxEquationSolverSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
 
 TEST(EliminationLinearEquationSolver, Solve) {
     ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
@@ -35,6 +36,42 @@ TEST(EliminationLinearEquationSolver, Solve) {
     ASSERT_LT(std::abs(x[2] - (-1)), 1e-15);
 }
 
+TEST(EliminationLinearEquationSolver, SolveApproximateMinimumDegreeOrder) {
+    // A cyclic fixed point system x = A*x + b with some fill-in during elimination.
+    uint_fast64_t const numberOfStates = 30;
+    storm::storage::SparseMatrixBuilder<double> builder;
+    std::vector<double> b(numberOfStates);
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        std::map<uint_fast64_t, double> row;
+        row[(state + 1) % numberOfStates] += 0.5;
+        row[(7 * state + 3) % numberOfStates] += 0.3;
+        row[(state * state) % numberOfStates] += 0.1;
+        for (auto const& entry : row) {
+            ASSERT_NO_THROW(builder.addNextValue(state, entry.first, entry.second));
+        }
+        b[state] = state % 4 == 0 ? 0.1 : 0.05;
+    }
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    std::vector<double> xDefault(numberOfStates);
+    storm::solver::EliminationLinearEquationSolver<double> defaultSolver(A);
+    ASSERT_NO_THROW(defaultSolver.solveEquations(xDefault, b));
+    
+    storm::solver::EliminationLinearEquationSolverSettings<double> settings;
+    settings.setEliminationOrder(storm::settings::modules::EliminationSettings::EliminationOrder::ApproximateMinimumDegree);
+    std::vector<double> xAmd(numberOfStates);
+    storm::solver::EliminationLinearEquationSolver<double> amdSolver(A, settings);
+    ASSERT_NO_THROW(amdSolver.solveEquations(xAmd, b));
+    
+    std::vector<double> residual(numberOfStates);
+    A.multiplyWithVector(xAmd, residual);
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_NEAR(xDefault[state], xAmd[state], 1e-12);
+        EXPECT_NEAR(xAmd[state], residual[state] + b[state], 1e-12);
+    }
+}
+
 TEST(EliminationLinearEquationSolver, MatrixVectorMultiplication) {
     ASSERT_NO_THROW(storm::storage::SparseMatrixBuilder<double> builder);
     storm::storage::SparseMatrixBuilder<double> builder;
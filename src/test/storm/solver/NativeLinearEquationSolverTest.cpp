@@ -56,3 +56,154 @@ TEST(NativeLinearEquationSolver, MatrixVectorMultiplication) {
     ASSERT_NO_THROW(solver.repeatedMultiply(x, nullptr, 4));
     ASSERT_LT(std::abs(x[0] - 1), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+TEST(NativeLinearEquationSolver, SolveTopological) {
+    // The system x = Px + b has the SCCs {0, 1}, {2}, {3, 4} and {5}. State 5 has a self-loop.
+    std::vector<std::vector<std::pair<uint64_t, double>>> rows = {{{1, 0.5}, {2, 0.25}}, {{0, 0.5}, {3, 0.25}}, {{3, 0.5}, {4, 0.25}}, {{4, 0.5}, {5, 0.25}}, {{3, 0.5}}, {{5, 0.5}}};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    
+    storm::storage::SparseMatrixBuilder<double> fixedPointBuilder;
+    storm::storage::SparseMatrixBuilder<double> equationSystemBuilder;
+    for (uint64_t row = 0; row < rows.size(); ++row) {
+        bool diagonalAdded = false;
+        for (auto const& entry : rows[row]) {
+            if (!diagonalAdded && entry.first >= row) {
+                equationSystemBuilder.addNextValue(row, row, entry.first == row ? 1 - entry.second : 1);
+                diagonalAdded = true;
+            }
+            fixedPointBuilder.addNextValue(row, entry.first, entry.second);
+            if (entry.first != row) {
+                equationSystemBuilder.addNextValue(row, entry.first, -entry.second);
+            }
+        }
+        if (!diagonalAdded) {
+            equationSystemBuilder.addNextValue(row, row, 1);
+        }
+    }
+    storm::storage::SparseMatrix<double> fixedPointMatrix = fixedPointBuilder.build();
+    storm::storage::SparseMatrix<double> equationSystemMatrix = equationSystemBuilder.build();
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::GaussSeidel);
+    settings.setPrecision(1e-10);
+    std::vector<double> expected(rows.size());
+    storm::solver::NativeLinearEquationSolver<double> referenceSolver(equationSystemMatrix, settings);
+    ASSERT_TRUE(referenceSolver.solveEquations(expected, b));
+    
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Topological);
+    for (auto const& sccMethod : {storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::GaussSeidel, storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Jacobi, storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Power}) {
+        settings.setSccSolutionMethod(sccMethod);
+        storm::solver::NativeLinearEquationSolver<double> solver(settings);
+        if (solver.getEquationProblemFormat() == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem) {
+            solver.setMatrix(fixedPointMatrix);
+            solver.setLowerBound(0.0);
+        } else {
+            solver.setMatrix(equationSystemMatrix);
+        }
+        
+        std::vector<double> x(rows.size());
+        ASSERT_TRUE(solver.solveEquations(x, b));
+        for (uint64_t state = 0; state < rows.size(); ++state) {
+            EXPECT_NEAR(expected[state], x[state], 1e-8);
+        }
+    }
+}
+
+TEST(NativeLinearEquationSolver, SolveBlock) {
+    // The fixed point system x = Px + b with substochastic P.
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.25);
+    builder.addNextValue(1, 0, 0.5);
+    builder.addNextValue(1, 2, 0.25);
+    builder.addNextValue(2, 2, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    
+    std::vector<std::vector<double>> b = {{1, 0, 0}, {0, 1, 0}, {0.5, 0.5, 1}};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Power);
+    settings.setPrecision(1e-10);
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    solver.setLowerBound(0.0);
+    
+    std::vector<std::vector<double>> expected(b.size(), std::vector<double>(3));
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        ASSERT_TRUE(solver.solveEquations(expected[i], b[i]));
+    }
+    
+    std::vector<std::vector<double>> x(b.size(), std::vector<double>(3));
+    ASSERT_TRUE(solver.solveEquations(x, b));
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        for (uint64_t state = 0; state < 3; ++state) {
+            EXPECT_NEAR(expected[i][state], x[i][state], 1e-8);
+        }
+    }
+    EXPECT_NEAR(4.0 / 3.0, x[0][0], 1e-8);
+    EXPECT_NEAR(2.0, x[2][2], 1e-8);
+}
+
+TEST(NativeLinearEquationSolver, SolveBlockJacobi) {
+    // The equation system (I-P)x = b for the substochastic matrix P of the SolveBlock test.
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 0, 1);
+    builder.addNextValue(0, 1, -0.5);
+    builder.addNextValue(0, 2, -0.25);
+    builder.addNextValue(1, 0, -0.5);
+    builder.addNextValue(1, 1, 1);
+    builder.addNextValue(1, 2, -0.25);
+    builder.addNextValue(2, 2, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    
+    std::vector<std::vector<double>> b = {{1, 0, 0}, {0, 1, 0}, {0.5, 0.5, 1}};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Jacobi);
+    settings.setPrecision(1e-10);
+    storm::solver::NativeLinearEquationSolver<double> solver(A, settings);
+    
+    std::vector<std::vector<double>> expected(b.size(), std::vector<double>(3));
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        ASSERT_TRUE(solver.solveEquations(expected[i], b[i]));
+    }
+    
+    std::vector<std::vector<double>> x(b.size(), std::vector<double>(3));
+    ASSERT_TRUE(solver.solveEquations(x, b));
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        for (uint64_t state = 0; state < 3; ++state) {
+            EXPECT_NEAR(expected[i][state], x[i][state], 1e-8);
+        }
+    }
+    EXPECT_NEAR(4.0 / 3.0, x[0][0], 1e-8);
+    EXPECT_NEAR(2.0, x[2][2], 1e-8);
+}
+
+TEST(NativeLinearEquationSolver, SolveCompactLayout) {
+    // The fixed point system x = Px + b of the SolveBlock test.
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.25);
+    builder.addNextValue(1, 0, 0.5);
+    builder.addNextValue(1, 2, 0.25);
+    builder.addNextValue(2, 2, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b = {1, 0, 0};
+    
+    storm::solver::NativeLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::NativeLinearEquationSolverSettings<double>::SolutionMethod::Power);
+    settings.setPrecision(1e-10);
+    storm::solver::NativeLinearEquationSolver<double> referenceSolver(A, settings);
+    referenceSolver.setLowerBound(0.0);
+    std::vector<double> expected(3);
+    ASSERT_TRUE(referenceSolver.solveEquations(expected, b));
+    
+    // The solver converts the matrix it owns to the compact layout, whose scalar kernels yield the same result.
+    storm::storage::SparseMatrix<double> compactA = A;
+    compactA.requestCompactLayout(storm::storage::kernels::SimdLevel::None);
+    storm::solver::NativeLinearEquationSolver<double> solver(std::move(compactA), settings);
+    solver.setLowerBound(0.0);
+    EXPECT_TRUE(solver.multipliesWithGivenMatrix());
+    std::vector<double> x(3);
+    ASSERT_TRUE(solver.solveEquations(x, b));
+    EXPECT_EQ(expected, x);
+}
@@ -2,6 +2,8 @@
 #include "storm-config.h"
 
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+#include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
+#include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
@@ -93,3 +95,112 @@ TEST(NativeMinMaxLinearEquationSolver, SolveWithPolicyIteration) {
 	ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
 	ASSERT_LT(std::abs(x[0] - 0.99), storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
 }
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithIntervalIteration) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 0.6));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, 0.5));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(3));
+    
+    std::vector<double> b = {0.2, 0.2, 0.3};
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    
+    for (auto style : {storm::solver::MultiplicationStyle::GaussSeidel, storm::solver::MultiplicationStyle::Regular}) {
+        storm::solver::IterativeMinMaxLinearEquationSolverFactory<double> factory(storm::solver::EquationSolverType::Native, storm::solver::MinMaxMethodSelection::IntervalIteration);
+        factory.getSettings().setValueIterationMultiplicationStyle(style);
+        auto solver = factory.create(A);
+        solver->setHasUniqueSolution();
+        solver->setBounds(0.0, 1.0);
+        
+        // The solver has to insist on bounds.
+        EXPECT_TRUE(solver->getRequirements().requiresLowerBounds());
+        EXPECT_TRUE(solver->getRequirements().requiresUpperBounds());
+        
+        std::vector<double> x(2);
+        ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_LT(std::abs(x[0] - 0.4), precision);
+        EXPECT_LT(std::abs(x[1] - 0.5), precision);
+        
+        ASSERT_NO_THROW(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_LT(std::abs(x[0] - 19.0 / 35.0), precision);
+        EXPECT_LT(std::abs(x[1] - 20.0 / 35.0), precision);
+    }
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveWithOptimisticValueIteration) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 0.6));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, 0.5));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(3));
+    
+    std::vector<double> b = {0.2, 0.2, 0.3};
+    double precision = storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision();
+    
+    for (auto style : {storm::solver::MultiplicationStyle::GaussSeidel, storm::solver::MultiplicationStyle::Regular}) {
+        storm::solver::IterativeMinMaxLinearEquationSolverFactory<double> factory(storm::solver::EquationSolverType::Native, storm::solver::MinMaxMethodSelection::OptimisticValueIteration);
+        factory.getSettings().setValueIterationMultiplicationStyle(style);
+        auto solver = factory.create(A);
+        solver->setHasUniqueSolution();
+        
+        // Only a lower bound is needed as the upper bound is guessed.
+        EXPECT_TRUE(solver->getRequirements().requiresLowerBounds());
+        EXPECT_FALSE(solver->getRequirements().requiresUpperBounds());
+        solver->setLowerBound(0.0);
+        
+        std::vector<double> x(2);
+        ASSERT_TRUE(solver->solveEquations(storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_LT(std::abs(x[0] - 0.4), precision);
+        EXPECT_LT(std::abs(x[1] - 0.5), precision);
+        
+        ASSERT_TRUE(solver->solveEquations(storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_LT(std::abs(x[0] - 19.0 / 35.0), precision);
+        EXPECT_LT(std::abs(x[1] - 20.0 / 35.0), precision);
+    }
+}
+
+TEST(NativeMinMaxLinearEquationSolver, SolveBlock) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 0.9));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 0.5));
+    
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build());
+    
+    // The optimal choice in state 0 differs between the two vectors.
+    std::vector<std::vector<double>> b = {{0.5, 0, 1}, {0, 0.5, 0.2}};
+    
+    storm::solver::IterativeMinMaxLinearEquationSolverSettings<double> settings;
+    settings.setSolutionMethod(storm::solver::IterativeMinMaxLinearEquationSolverSettings<double>::SolutionMethod::ValueIteration);
+    settings.setPrecision(1e-10);
+    storm::solver::IterativeMinMaxLinearEquationSolver<double> solver(A, std::make_unique<storm::solver::NativeLinearEquationSolverFactory<double>>(), settings);
+    solver.setHasUniqueSolution();
+    
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<std::vector<double>> expected(b.size(), std::vector<double>(2));
+        for (uint64_t i = 0; i < b.size(); ++i) {
+            ASSERT_TRUE(solver.solveEquations(dir, expected[i], b[i]));
+        }
+        
+        std::vector<std::vector<double>> x(b.size(), std::vector<double>(2));
+        ASSERT_TRUE(solver.solveEquations(dir, x, b));
+        for (uint64_t i = 0; i < b.size(); ++i) {
+            for (uint64_t state = 0; state < 2; ++state) {
+                EXPECT_NEAR(expected[i][state], x[i][state], 1e-7);
+            }
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/solver/stateelimination/StateEliminator.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+TEST(StateEliminator, MergedPredecessorTakesNewValueOnTie) {
+    // State 1 is eliminated, which makes the existing transition from 0 to 2 more likely.
+    storm::storage::SparseMatrixBuilder<double> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 1.0));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+    
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose());
+    storm::solver::stateelimination::StateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions);
+    eliminator.eliminateState(1, true);
+    
+    // All values are equally complex, so the predecessor entry of state 2 takes the new forward probability.
+    auto const& predecessors = flexibleBackwardTransitions.getRow(2);
+    auto predecessorIt = std::find_if(predecessors.begin(), predecessors.end(), [] (storm::storage::MatrixEntry<uint_fast64_t, double> const& entry) { return entry.getColumn() == 0; });
+    ASSERT_TRUE(predecessorIt != predecessors.end());
+    EXPECT_EQ(1.0, predecessorIt->getValue());
+    EXPECT_TRUE(std::find_if(predecessors.begin(), predecessors.end(), [] (storm::storage::MatrixEntry<uint_fast64_t, double> const& entry) { return entry.getColumn() == 1; }) == predecessors.end());
+}
+
+#ifdef STORM_HAVE_CARL
+TEST(StateEliminator, MergedPredecessorKeepsMoreComplexValue) {
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    carl::StringParser parser;
+    parser.setVariables({"p"});
+    storm::RationalFunction p = storm::RationalFunction(storm::Polynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>("p"), cache));
+    storm::RationalFunction one = storm::RationalFunction(1);
+    
+    // Eliminating state 1 turns the transition from 0 to 2 into 1-p + p*1 = 1, which is a constant.
+    storm::storage::SparseMatrixBuilder<storm::RationalFunction> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, p));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, one - p));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, one));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, one));
+    storm::storage::SparseMatrix<storm::RationalFunction> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+    
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> flexibleBackwardTransitions(matrix.transpose());
+    storm::solver::stateelimination::StateEliminator<storm::RationalFunction> eliminator(flexibleMatrix, flexibleBackwardTransitions);
+    eliminator.eliminateState(1, true);
+    
+    auto const& successors = flexibleMatrix.getRow(0);
+    ASSERT_EQ(1ull, successors.size());
+    EXPECT_EQ(one, successors.front().getValue());
+    
+    // The backward values only estimate the cost of eliminating states, so the more complex value 1-p is kept.
+    auto const& predecessors = flexibleBackwardTransitions.getRow(2);
+    auto predecessorIt = std::find_if(predecessors.begin(), predecessors.end(), [] (storm::storage::MatrixEntry<uint_fast64_t, storm::RationalFunction> const& entry) { return entry.getColumn() == 0; });
+    ASSERT_TRUE(predecessorIt != predecessors.end());
+    EXPECT_EQ(one - p, predecessorIt->getValue());
+}
+#endif
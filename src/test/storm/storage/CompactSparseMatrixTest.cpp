@@ -0,0 +1,352 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace {
+    storm::storage::SparseMatrix<double> createNondeterministicMatrix() {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true, 0);
+        matrixBuilder.newRowGroup(0);
+        matrixBuilder.addNextValue(0, 1, 0.5);
+        matrixBuilder.addNextValue(0, 2, 0.5);
+        matrixBuilder.addNextValue(1, 0, 0.3);
+        matrixBuilder.addNextValue(1, 2, 0.7);
+        matrixBuilder.newRowGroup(2);
+        matrixBuilder.addNextValue(2, 1, 1.0);
+        matrixBuilder.newRowGroup(3);
+        matrixBuilder.addNextValue(3, 0, 0.1);
+        matrixBuilder.addNextValue(3, 2, 0.9);
+        matrixBuilder.addNextValue(4, 2, 1.0);
+        matrixBuilder.addNextValue(5, 0, 0.4);
+        matrixBuilder.addNextValue(5, 1, 0.6);
+        return matrixBuilder.build();
+    }
+}
+
+TEST(CompactSparseMatrix, Creation) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    EXPECT_EQ(matrix.getRowCount(), compactMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), compactMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), compactMatrix.getEntryCount());
+    EXPECT_TRUE(compactMatrix.hasNarrowColumnIndices());
+    EXPECT_EQ(7ul * sizeof(uint64_t) + 10ul * (sizeof(uint32_t) + sizeof(double)), compactMatrix.getSizeInMemory());
+
+    storm::storage::CompactSparseMatrix<double> wideMatrix(matrix, false);
+    EXPECT_FALSE(wideMatrix.hasNarrowColumnIndices());
+    EXPECT_EQ(7ul * sizeof(uint64_t) + 10ul * (sizeof(uint64_t) + sizeof(double)), wideMatrix.getSizeInMemory());
+
+    EXPECT_TRUE(storm::storage::CompactSparseMatrix<double>::fitsNarrowColumnIndices(1ull << 32));
+    EXPECT_FALSE(storm::storage::CompactSparseMatrix<double>::fitsNarrowColumnIndices((1ull << 32) + 1));
+}
+
+TEST(CompactSparseMatrix, MatrixVectorMultiply) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    std::vector<double> x = {0.2, 0.7, 1.3};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+
+    matrix.multiplyWithVector(x, expected, &b);
+    ASSERT_NO_THROW(compactMatrix.multiplyWithVector(x, result, &b));
+    for (std::size_t index = 0; index < expected.size(); ++index) {
+        EXPECT_EQ(expected[index], result[index]);
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, false);
+
+    std::vector<double> x = {0.2, 0.7, 1.3};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount());
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expected, &expectedChoices);
+
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> choices(matrix.getRowGroupCount());
+        ASSERT_NO_THROW(compactMatrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, result, &choices));
+        EXPECT_EQ(expected, result);
+        EXPECT_EQ(expectedChoices, choices);
+
+        // The in-place variant must coincide with the one of the original matrix.
+        std::vector<double> expectedInPlace = x;
+        matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), expectedInPlace, &b, expectedInPlace, &expectedChoices);
+        std::vector<double> resultInPlace = x;
+        ASSERT_NO_THROW(compactMatrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), resultInPlace, &b, resultInPlace, &choices));
+        EXPECT_EQ(expectedInPlace, resultInPlace);
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
+
+TEST(CompactSparseMatrix, AttachedLayout) {
+    storm::storage::SparseMatrix<double> matrix = createNondeterministicMatrix();
+    storm::storage::SparseMatrix<double> reference = createNondeterministicMatrix();
+    ASSERT_TRUE(storm::storage::SparseMatrix<double>::isCompactLayoutSupported());
+    ASSERT_NO_THROW(matrix.createCompactLayout(storm::storage::kernels::SimdLevel::None));
+    ASSERT_TRUE(matrix.hasCompactLayout());
+
+    std::vector<double> x = {0.2, 0.7, 1.3};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+    reference.multiplyWithVector(x, expected, &b);
+    matrix.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+    matrix.multiplyWithVectorParallel(x, result, &b);
+    EXPECT_EQ(expected, result);
+
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> expectedChoices(matrix.getRowGroupCount());
+        reference.multiplyAndReduce(dir, reference.getRowGroupIndices(), x, &b, expectedReduced, &expectedChoices);
+
+        std::vector<double> resultReduced(matrix.getRowGroupCount());
+        std::vector<uint_fast64_t> choices(matrix.getRowGroupCount());
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, resultReduced, &choices);
+        EXPECT_EQ(expectedReduced, resultReduced);
+        EXPECT_EQ(expectedChoices, choices);
+        matrix.multiplyAndReduceParallel(dir, matrix.getRowGroupIndices(), x, &b, resultReduced, &choices);
+        EXPECT_EQ(expectedReduced, resultReduced);
+        EXPECT_EQ(expectedChoices, choices);
+
+        std::vector<double> expectedInPlace = x;
+        reference.multiplyAndReduceBackward(dir, reference.getRowGroupIndices(), expectedInPlace, &b, expectedInPlace, &expectedChoices);
+        std::vector<double> resultInPlace = x;
+        matrix.multiplyAndReduceBackward(dir, matrix.getRowGroupIndices(), resultInPlace, &b, resultInPlace, &choices);
+        EXPECT_EQ(expectedInPlace, resultInPlace);
+        EXPECT_EQ(expectedChoices, choices);
+    }
+
+    // Copies share the layout and submatrices inherit the request for it.
+    storm::storage::SparseMatrix<double> copy = matrix;
+    EXPECT_TRUE(copy.hasCompactLayout());
+    EXPECT_TRUE(copy.isStandardLayoutReleased());
+    EXPECT_EQ(&matrix.getCompactLayout(), &copy.getCompactLayout());
+    storm::storage::BitVector groups(3, true);
+    groups.set(1, false);
+    storm::storage::BitVector columns(3, true);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, groups, columns);
+    EXPECT_FALSE(submatrix.hasCompactLayout());
+    EXPECT_TRUE(submatrix.isCompactLayoutRequested());
+    submatrix.createRequestedCompactLayout();
+    EXPECT_TRUE(submatrix.hasCompactLayout());
+    EXPECT_EQ(submatrix.getEntryCount(), submatrix.getCompactLayout().getEntryCount());
+
+    // Accessing the rows restores the standard layout, but keeps the compact one.
+    EXPECT_FALSE(matrix.isStandardLayoutReleased());
+    EXPECT_TRUE(matrix.hasCompactLayout());
+    EXPECT_EQ(reference, matrix);
+    EXPECT_TRUE(copy.isStandardLayoutReleased());
+
+    // Changing the entries drops the layout, so that the multiplication sees the changes.
+    copy.makeRowDirac(0, 2);
+    EXPECT_FALSE(copy.hasCompactLayout());
+    EXPECT_TRUE(matrix.hasCompactLayout());
+    copy.multiplyWithVector(x, result);
+    EXPECT_EQ(1.3, result[0]);
+    matrix.scaleRowsInPlace(std::vector<double>(matrix.getRowCount(), 2.0));
+    EXPECT_FALSE(matrix.hasCompactLayout());
+    matrix.multiplyWithVector(x, result);
+    reference.multiplyWithVector(x, expected);
+    for (std::size_t index = 0; index < expected.size(); ++index) {
+        EXPECT_EQ(2.0 * expected[index], result[index]);
+    }
+}
+
+TEST(CompactSparseMatrix, ConcurrentRestoration) {
+    storm::storage::SparseMatrix<double> reference = createNondeterministicMatrix();
+    storm::storage::SparseMatrix<double> matrix = reference;
+    matrix.createCompactLayout(storm::storage::kernels::SimdLevel::None);
+    ASSERT_TRUE(matrix.isStandardLayoutReleased());
+
+    // Several threads access the rows at once, but only one of them restores the standard layout.
+    storm::storage::SparseMatrix<double> const& constMatrix = matrix;
+    std::vector<double> rowSums(4 * matrix.getRowCount());
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&constMatrix, &rowSums, thread] () {
+            for (uint64_t row = 0; row < constMatrix.getRowCount(); ++row) {
+                rowSums[thread * constMatrix.getRowCount() + row] = constMatrix.getRowSum(row);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(matrix.isStandardLayoutReleased());
+    for (uint64_t index = 0; index < rowSums.size(); ++index) {
+        EXPECT_EQ(reference.getRowSum(index % reference.getRowCount()), rowSums[index]);
+    }
+}
+
+TEST(CompactSparseMatrix, VectorizedKernelsRequireCompactLayout) {
+    storm::storage::SparseMatrix<double> reference = createNondeterministicMatrix();
+    storm::storage::SparseMatrix<double> matrix = reference;
+
+    // A request alone keeps the standard layout, which is multiplied with the scalar kernels.
+    matrix.requestCompactLayout(storm::storage::kernels::SimdLevel::Avx512);
+    EXPECT_TRUE(matrix.isCompactLayoutRequested());
+    EXPECT_FALSE(matrix.hasCompactLayout());
+    std::vector<double> x = {0.2, 0.7, 1.3};
+    std::vector<double> expected(reference.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+    reference.multiplyWithVector(x, expected);
+    matrix.multiplyWithVector(x, result);
+    EXPECT_EQ(expected, result);
+
+    // The requested extension only takes effect once the entries are stored in the compact layout.
+    matrix.createRequestedCompactLayout();
+    ASSERT_TRUE(matrix.hasCompactLayout());
+    EXPECT_EQ(std::min(storm::storage::kernels::SimdLevel::Avx512, storm::storage::kernels::getSupportedSimdLevel()), matrix.getCompactLayout().getSimdLevel());
+}
+
+TEST(CompactSparseMatrix, VectorizedKernels) {
+    // Build a matrix with enough rows of varying length (including empty rows and groups) to exercise all vector lanes.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true, 0);
+    uint64_t const columnCount = 37;
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < 500; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < group % 4; ++choice, ++row) {
+            for (uint64_t column = (row * 7) % 5; column < columnCount; column += 1 + (row + column) % 6) {
+                matrixBuilder.addNextValue(row, column, 1.0 / (1 + row % 13 + column));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build(row, columnCount, 500);
+
+    std::vector<double> x(columnCount);
+    for (uint64_t column = 0; column < columnCount; ++column) {
+        x[column] = 0.1 * column + 1.0 / (column + 3);
+    }
+    std::vector<double> b(matrix.getRowCount());
+    for (uint64_t index = 0; index < b.size(); ++index) {
+        b[index] = 0.01 * (index % 17);
+    }
+
+    for (bool narrow : {true, false}) {
+        storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, narrow);
+        for (auto level : {storm::storage::kernels::SimdLevel::None, storm::storage::kernels::SimdLevel::Avx2, storm::storage::kernels::SimdLevel::Avx512}) {
+            compactMatrix.setSimdLevel(level);
+            EXPECT_LE(compactMatrix.getSimdLevel(), storm::storage::kernels::getSupportedSimdLevel());
+
+            std::vector<double> expected(matrix.getRowCount());
+            std::vector<double> result(matrix.getRowCount());
+            matrix.multiplyWithVector(x, expected, &b);
+            compactMatrix.multiplyWithVector(x, result, &b);
+            // Release builds allow the compiler to contract the scalar kernels, so only compare up to rounding.
+            for (uint64_t index = 0; index < expected.size(); ++index) {
+                EXPECT_NEAR(expected[index], result[index], 1e-12);
+            }
+
+            for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+                std::vector<double> expectedReduced(matrix.getRowGroupCount());
+                matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expectedReduced, nullptr);
+
+                std::vector<double> resultReduced(matrix.getRowGroupCount());
+                std::vector<uint_fast64_t> choices(matrix.getRowGroupCount());
+                compactMatrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, resultReduced, &choices);
+                for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+                    EXPECT_NEAR(expectedReduced[group], resultReduced[group], 1e-12);
+                    if (matrix.getRowGroupSize(group) > 0) {
+                        EXPECT_NEAR(expected[matrix.getRowGroupIndices()[group] + choices[group]], resultReduced[group], 1e-12);
+                    } else {
+                        EXPECT_EQ(0u, choices[group]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(CompactSparseMatrix, VectorizedLayout) {
+    // Groups of up to 15 rows let the backward reduction use the vectorized kernels as well.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true, 0);
+    uint64_t const groupCount = 200;
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 1 + group % 15; ++choice, ++row) {
+            for (uint64_t column = (row * 3) % 7; column < groupCount; column += 1 + (row + column) % 23) {
+                matrixBuilder.addNextValue(row, column, 1.0 / (3 + row % 11 + column % 7));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> reference = matrixBuilder.build(row, groupCount, groupCount);
+
+    std::vector<double> x(groupCount);
+    for (uint64_t column = 0; column < groupCount; ++column) {
+        x[column] = 0.01 * column + 1.0 / (column + 7);
+    }
+    std::vector<double> b(reference.getRowCount());
+    for (uint64_t index = 0; index < b.size(); ++index) {
+        b[index] = 0.02 * (index % 13);
+    }
+    std::vector<uint64_t> const& groups = reference.getRowGroupIndices();
+
+    for (auto level : {storm::storage::kernels::SimdLevel::None, storm::storage::kernels::SimdLevel::Avx2, storm::storage::kernels::SimdLevel::Avx512}) {
+        storm::storage::SparseMatrix<double> matrix = reference;
+        matrix.createCompactLayout(level);
+        ASSERT_TRUE(matrix.hasCompactLayout());
+
+        // The vectorized kernels may differ from the scalar ones in the last bits, so only compare up to rounding.
+        std::vector<double> expected(reference.getRowCount());
+        std::vector<double> result(reference.getRowCount());
+        reference.multiplyWithVector(x, expected, &b);
+        matrix.multiplyWithVector(x, result, &b);
+        for (uint64_t index = 0; index < expected.size(); ++index) {
+            EXPECT_NEAR(expected[index], result[index], 1e-12);
+        }
+        matrix.multiplyWithVectorParallel(x, result, &b);
+        for (uint64_t index = 0; index < expected.size(); ++index) {
+            EXPECT_NEAR(expected[index], result[index], 1e-12);
+        }
+
+        for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+            std::vector<double> expectedReduced(groupCount);
+            std::vector<double> resultReduced(groupCount);
+            std::vector<uint_fast64_t> choices(groupCount);
+            reference.multiplyAndReduceForward(dir, groups, x, &b, expectedReduced, nullptr);
+            matrix.multiplyAndReduceForward(dir, groups, x, &b, resultReduced, &choices);
+            for (uint64_t group = 0; group < groupCount; ++group) {
+                EXPECT_NEAR(expectedReduced[group], resultReduced[group], 1e-12);
+                EXPECT_NEAR(expected[groups[group] + choices[group]], resultReduced[group], 1e-12);
+            }
+            matrix.multiplyAndReduceParallel(dir, groups, x, &b, resultReduced, &choices);
+            for (uint64_t group = 0; group < groupCount; ++group) {
+                EXPECT_NEAR(expectedReduced[group], resultReduced[group], 1e-12);
+            }
+
+            reference.multiplyAndReduceBackward(dir, groups, x, &b, expectedReduced, nullptr);
+            matrix.multiplyAndReduceBackward(dir, groups, x, &b, resultReduced, &choices);
+            for (uint64_t group = 0; group < groupCount; ++group) {
+                EXPECT_NEAR(expectedReduced[group], resultReduced[group], 1e-12);
+                EXPECT_NEAR(expected[groups[group] + choices[group]], resultReduced[group], 1e-12);
+            }
+
+            // In place (Gauss-Seidel style), the differences could accumulate, so compare after a single sweep.
+            std::vector<double> expectedInPlace = x;
+            reference.multiplyAndReduceBackward(dir, groups, expectedInPlace, &b, expectedInPlace, nullptr);
+            std::vector<double> resultInPlace = x;
+            matrix.multiplyAndReduceBackward(dir, groups, resultInPlace, &b, resultInPlace, nullptr);
+            for (uint64_t group = 0; group < groupCount; ++group) {
+                EXPECT_NEAR(expectedInPlace[group], resultInPlace[group], 1e-10);
+                if (level == storm::storage::kernels::SimdLevel::None) {
+                    EXPECT_EQ(expectedInPlace[group], resultInPlace[group]);
+                }
+            }
+        }
+    }
+}
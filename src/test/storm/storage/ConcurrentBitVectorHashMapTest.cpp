@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+    storm::storage::BitVector createKey(uint64_t number) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, number);
+        key.setFromInt(64, 64, number * 7);
+        return key;
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 10);
+
+    // Keys get consecutive values in the order in which they are added.
+    uint64_t numberOfAddedKeys = 0;
+    for (uint64_t number = 0; number < 100; ++number) {
+        auto result = map.findOrAdd(createKey(number));
+        if (!result) {
+            EXPECT_EQ(numberOfAddedKeys, map.size());
+            map.increaseSize();
+            result = map.findOrAdd(createKey(number));
+        }
+        ASSERT_TRUE(static_cast<bool>(result));
+        EXPECT_TRUE(result.get().second);
+        EXPECT_EQ(numberOfAddedKeys, result.get().first);
+        ++numberOfAddedKeys;
+    }
+    EXPECT_EQ(100ull, map.size());
+    EXPECT_LE(128ull, map.capacity());
+
+    for (uint64_t number = 0; number < 100; ++number) {
+        auto result = map.findOrAdd(createKey(number));
+        ASSERT_TRUE(static_cast<bool>(result));
+        EXPECT_FALSE(result.get().second);
+        EXPECT_EQ(number, result.get().first);
+    }
+
+    uint64_t numberOfOccupiedBuckets = 0;
+    for (uint64_t bucket = 0; bucket < map.capacity(); ++bucket) {
+        if (map.isBucketOccupied(bucket)) {
+            ++numberOfOccupiedBuckets;
+            auto keyValuePair = map.getBucketAndValue(bucket);
+            EXPECT_EQ(createKey(keyValuePair.second), keyValuePair.first);
+        }
+    }
+    EXPECT_EQ(100ull, numberOfOccupiedBuckets);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertions) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 20000);
+    uint64_t const numberOfKeys = 10007;
+    uint64_t const numberOfThreads = 4;
+
+    // All threads insert all keys (in different orders), so every key must end up with one value.
+    std::vector<std::vector<uint32_t>> valuesPerThread(numberOfThreads, std::vector<uint32_t>(numberOfKeys));
+    std::vector<uint64_t> insertionsPerThread(numberOfThreads, 0);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread] () {
+            for (uint64_t index = 0; index < numberOfKeys; ++index) {
+                uint64_t number = (index * (2 * thread + 1)) % numberOfKeys;
+                auto result = map.findOrAdd(createKey(number));
+                ASSERT_TRUE(static_cast<bool>(result));
+                valuesPerThread[thread][number] = result.get().first;
+                if (result.get().second) {
+                    ++insertionsPerThread[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    uint64_t totalInsertions = 0;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        EXPECT_EQ(valuesPerThread[0], valuesPerThread[thread]);
+        totalInsertions += insertionsPerThread[thread];
+    }
+    EXPECT_EQ(numberOfKeys, totalInsertions);
+
+    std::vector<uint32_t> sortedValues = valuesPerThread[0];
+    std::sort(sortedValues.begin(), sortedValues.end());
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        EXPECT_EQ(index, sortedValues[index]);
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertionsIntoFullMap) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 1000);
+    uint64_t const numberOfKeys = 10007;
+    uint64_t const numberOfThreads = 4;
+    uint64_t const capacity = map.capacity();
+
+    // The insertions fail once the map is full, but the map must never take more elements than it may hold.
+    std::vector<std::thread> threads;
+    std::vector<uint64_t> failuresPerThread(numberOfThreads, 0);
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread] () {
+            for (uint64_t index = 0; index < numberOfKeys; ++index) {
+                if (!map.findOrAdd(createKey(thread * numberOfKeys + index))) {
+                    ++failuresPerThread[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(capacity, map.capacity());
+    EXPECT_LE(map.size(), static_cast<uint64_t>(capacity * 0.75));
+    EXPECT_EQ(numberOfThreads * numberOfKeys, map.size() + failuresPerThread[0] + failuresPerThread[1] + failuresPerThread[2] + failuresPerThread[3]);
+
+    // After clearing the map, the values start from zero again.
+    map.clear();
+    EXPECT_EQ(0ull, map.size());
+    auto result = map.findOrAdd(createKey(42));
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_TRUE(result.get().second);
+    EXPECT_EQ(0u, result.get().first);
+}
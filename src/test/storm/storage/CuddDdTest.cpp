@@ -5,9 +5,11 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/utility/dd.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
 
@@ -755,3 +757,65 @@ TEST(CuddDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(CuddDd, CombineBalancedTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 1, 9);
+    
+    // Check element counts that do and do not lead to a perfectly balanced tree.
+    for (uint64_t numberOfElements : {0, 1, 2, 7, 8, 9}) {
+        std::vector<storm::dd::Add<storm::dd::DdType::CUDD, double>> adds;
+        std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> bdds;
+        storm::dd::Add<storm::dd::DdType::CUDD, double> sequentialAdd = manager->template getAddZero<double>();
+        storm::dd::Bdd<storm::dd::DdType::CUDD> sequentialBdd = manager->getBddZero();
+        for (uint64_t element = 0; element < numberOfElements; ++element) {
+            storm::dd::Bdd<storm::dd::DdType::CUDD> encoding = manager->getEncoding(x.first, element + 1) && manager->getEncoding(y.first, (element * 4) % 9 + 1);
+            adds.push_back(encoding.template toAdd<double>() * manager->template getConstant<double>(static_cast<double>(element + 1)) + manager->template getConstant<double>(0.5));
+            bdds.push_back(encoding);
+            sequentialAdd += adds.back();
+            sequentialBdd |= bdds.back();
+        }
+        
+        storm::dd::Add<storm::dd::DdType::CUDD, double> balancedAdd = storm::utility::dd::combineBalanced(adds, manager->template getAddZero<double>(), std::plus<storm::dd::Add<storm::dd::DdType::CUDD, double>>());
+        EXPECT_TRUE(sequentialAdd.equalModuloPrecision(balancedAdd, 1e-12, false));
+        storm::dd::Bdd<storm::dd::DdType::CUDD> balancedBdd = storm::utility::dd::combineBalanced(bdds, manager->getBddZero(), [] (storm::dd::Bdd<storm::dd::DdType::CUDD> const& first, storm::dd::Bdd<storm::dd::DdType::CUDD> const& second) { return first || second; });
+        EXPECT_TRUE(sequentialBdd == balancedBdd);
+        EXPECT_EQ(numberOfElements, balancedBdd.getNonZeroCount());
+    }
+    
+    // The order of the elements is preserved, so the operation does not need to be commutative.
+    std::vector<std::string> words = {"a", "b", "c", "d", "e", "f", "g"};
+    EXPECT_EQ("abcdefg", storm::utility::dd::combineBalanced(words, std::string(), std::plus<std::string>()));
+}
+
+TEST(CuddDd, ParallelToMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 20000);
+    
+    // Create a matrix with enough rows to be translated in parallel, in which each row has a self-loop and a
+    // transition to the first row, which in turn has transitions to all rows.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> range = (manager->getRange(x.first) && manager->getRange(x.second)).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->getIdentity(x.first, x.second).template toAdd<double>() * (manager->template getIdentity<double>(x.first) + manager->template getConstant<double>(1));
+    dd += range * manager->getEncoding(x.second, 0).template toAdd<double>() * manager->template getConstant<double>(0.5);
+    dd += range * manager->getEncoding(x.first, 0).template toAdd<double>() * manager->template getConstant<double>(0.25);
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> nondeterministicDd = manager->getEncoding(a.first, 0).ite(dd, dd * manager->template getConstant<double>(2));
+    
+    storm::settings::mutableCoreSettings().setThreadCount(1);
+    storm::storage::SparseMatrix<double> sequentialMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    storm::storage::SparseMatrix<double> sequentialNondeterministicMatrix = nondeterministicDd.toMatrix({a.first}, rowOdd, columnOdd);
+    EXPECT_EQ(20001ul, sequentialMatrix.getRowCount());
+    EXPECT_EQ(60001ul, sequentialMatrix.getEntryCount());
+    EXPECT_EQ(20001ul, sequentialNondeterministicMatrix.getRowGroupCount());
+    
+    storm::settings::mutableCoreSettings().setThreadCount(4);
+    storm::storage::SparseMatrix<double> parallelMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    storm::storage::SparseMatrix<double> parallelNondeterministicMatrix = nondeterministicDd.toMatrix({a.first}, rowOdd, columnOdd);
+    storm::settings::mutableCoreSettings().setThreadCount(1);
+    
+    EXPECT_TRUE(sequentialMatrix == parallelMatrix);
+    EXPECT_TRUE(sequentialNondeterministicMatrix == parallelNondeterministicMatrix);
+}
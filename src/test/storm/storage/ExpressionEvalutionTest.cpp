@@ -3,6 +3,9 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
+#include "storm/generator/StateExpressionCompiler.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 TEST(ExpressionEvaluation, NaiveEvaluation) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
@@ -60,3 +63,53 @@ TEST(ExpressionEvaluation, ExprTkEvaluation) {
         EXPECT_NEAR(3 * zValue, eval.asRational(iteExpression), 1e-6);
     }
 }
+
+TEST(ExpressionEvaluation, CompiledStateEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    
+    // Pack x into the first bit and y (ranging from -2 to 5) into the three following bits.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0);
+    variableInformation.integerVariables.emplace_back(y, -2, 5, 1, 3);
+    variableInformation.totalBitOffset = 4;
+    
+    std::vector<storm::expressions::Expression> expressions;
+    expressions.push_back(storm::expressions::ite(x, y + manager->integer(2), y * manager->integer(3)) / manager->integer(2));
+    expressions.push_back((x && y > manager->integer(2)) || (!x && y <= manager->integer(1)));
+    expressions.push_back(storm::expressions::implies(y >= manager->integer(0), x) && storm::expressions::iff(x, y != manager->integer(3)));
+    expressions.push_back(storm::expressions::xclusiveor(x, y / manager->integer(3) == manager->integer(1) / manager->integer(3)));
+    expressions.push_back(storm::expressions::minimum(y, manager->integer(1)) + storm::expressions::maximum(-y, manager->integer(0)) + (y ^ manager->integer(2)));
+    expressions.push_back(storm::expressions::floor(y / manager->integer(2)) - storm::expressions::ceil(y / manager->integer(2)));
+    
+    storm::generator::StateExpressionCompiler compiler(variableInformation);
+    std::vector<storm::generator::CompiledStateExpression> compiledExpressions;
+    for (auto const& expression : expressions) {
+        ASSERT_NO_THROW(compiledExpressions.push_back(compiler.compile(expression)));
+    }
+    
+    storm::expressions::ExprtkExpressionEvaluator eval(*manager);
+    for (uint64_t xValue = 0; xValue < 2; ++xValue) {
+        for (int_fast64_t yValue = -2; yValue <= 5; ++yValue) {
+            storm::generator::CompressedState state(4);
+            state.set(0, xValue == 1);
+            state.setFromInt(1, 3, yValue + 2);
+            eval.setBooleanValue(x, xValue == 1);
+            eval.setIntegerValue(y, yValue);
+            
+            for (uint64_t i = 0; i < expressions.size(); ++i) {
+                EXPECT_EQ(eval.asRational(expressions[i]), compiledExpressions[i].evaluate(state)) << "for expression " << expressions[i] << ".";
+            }
+        }
+    }
+    
+    // Subexpressions that do not depend on the state are folded.
+    storm::generator::CompiledStateExpression constant = compiler.compile(manager->integer(2) + manager->integer(3) > manager->integer(4) || x);
+    EXPECT_TRUE(constant.isConstant());
+    EXPECT_TRUE(constant.evaluateAsBool(storm::generator::CompressedState(4)));
+    
+    storm::expressions::Variable z = manager->declareRationalVariable("z");
+    EXPECT_THROW(compiler.compile(z > manager->integer(0)), storm::exceptions::InvalidArgumentException);
+}
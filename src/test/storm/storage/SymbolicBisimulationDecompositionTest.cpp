@@ -12,6 +12,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -78,6 +79,40 @@ TEST(SymbolicModelBisimulationDecomposition, Crowds_Cudd) {
     EXPECT_TRUE(quotient->isSymbolicModel());
 }
 
+TEST(SymbolicModelBisimulationDecomposition, Crowds_SylvanMatchesCudd) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+    
+    // The refinement with CUDD is sequential while Sylvan refines with all its workers, but both have to number
+    // the blocks the same way.
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> cuddModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(smd.asPrismProgram());
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> cuddDecomposition(*cuddModel, storm::storage::BisimulationType::Strong);
+    cuddDecomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> cuddQuotient = cuddDecomposition.getQuotient();
+    
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> sylvanModel = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram());
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> sylvanDecomposition(*sylvanModel, storm::storage::BisimulationType::Strong);
+    sylvanDecomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> sylvanQuotient = sylvanDecomposition.getQuotient();
+    
+    ASSERT_EQ(storm::models::ModelType::Dtmc, cuddQuotient->getType());
+    ASSERT_EQ(storm::models::ModelType::Dtmc, sylvanQuotient->getType());
+    EXPECT_EQ(cuddQuotient->getNumberOfStates(), sylvanQuotient->getNumberOfStates());
+    EXPECT_EQ(cuddQuotient->getNumberOfTransitions(), sylvanQuotient->getNumberOfTransitions());
+    
+    storm::storage::SparseMatrix<double> cuddMatrix = cuddQuotient->as<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>()->getTransitionMatrix().toMatrix();
+    storm::storage::SparseMatrix<double> sylvanMatrix = sylvanQuotient->as<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>>()->getTransitionMatrix().toMatrix();
+    EXPECT_TRUE(cuddMatrix == sylvanMatrix);
+    
+    // Refining the same model again must reproduce the very same quotient.
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> sylvanDecomposition2(*sylvanModel, storm::storage::BisimulationType::Strong);
+    sylvanDecomposition2.compute();
+    storm::storage::SparseMatrix<double> sylvanMatrix2 = sylvanDecomposition2.getQuotient()->as<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>>()->getTransitionMatrix().toMatrix();
+    EXPECT_TRUE(sylvanMatrix == sylvanMatrix2);
+}
+
 TEST(SymbolicModelBisimulationDecomposition, TwoDice_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
 
@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <random>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/TreeBitVectorHashMap.h"
+
+TEST(TreeBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::TreeBitVectorHashMap<uint64_t> map(128, {20});
+    // The second slice is wider than 64 bits and hence split.
+    EXPECT_EQ(3ul, map.getNumberOfSlices());
+    
+    storm::storage::BitVector first(128);
+    first.set(4);
+    first.set(47);
+    first.set(100);
+    EXPECT_EQ(1ul, map.findOrAdd(first, 1));
+    
+    storm::storage::BitVector second(128);
+    second.set(4);
+    second.set(47);
+    second.set(127);
+    EXPECT_EQ(2ul, map.findOrAdd(second, 2));
+    
+    storm::storage::BitVector third(128);
+    EXPECT_EQ(3ul, map.findOrAdd(third, 3));
+    
+    EXPECT_EQ(1ul, map.findOrAdd(first, 4));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 4));
+    EXPECT_EQ(3ul, map.findOrAdd(third, 4));
+    EXPECT_EQ(3ul, map.size());
+    
+    storm::storage::BitVector fourth(128);
+    fourth.set(19);
+    EXPECT_FALSE(map.contains(fourth));
+    EXPECT_TRUE(map.contains(second));
+    EXPECT_FALSE(static_cast<bool>(map.find(fourth)));
+    EXPECT_EQ(2ul, map.find(second).get());
+    
+    EXPECT_EQ(first, map.getKey(0));
+    EXPECT_EQ(second, map.getKey(1));
+    EXPECT_EQ(third, map.getKey(2));
+    
+    map.remap([] (uint64_t const& value) { return 10 * value; });
+    EXPECT_EQ(20ul, map.findOrAdd(second, 4));
+    
+    uint64_t numberOfElements = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(map.getValue(numberOfElements), keyValuePair.second);
+        ++numberOfElements;
+    }
+    EXPECT_EQ(3ul, numberOfElements);
+}
+
+TEST(TreeBitVectorHashMapTest, AgreesWithBitVectorHashMap) {
+    std::mt19937_64 generator(42);
+    storm::storage::BitVectorHashMap<uint64_t> map(192, 100);
+    storm::storage::TreeBitVectorHashMap<uint64_t> treeMap(192, {3, 30, 31, 100});
+    
+    // Draw the slices from few distinct values such that they are shared among the keys.
+    for (uint64_t i = 0; i < 20000; ++i) {
+        storm::storage::BitVector key(192);
+        key.setFromInt(0, 3, generator() % 8);
+        key.setFromInt(3, 27, generator() % 16);
+        key.setFromInt(31, 60, generator() % 32);
+        key.setFromInt(100, 64, generator() % 5);
+        key.setFromInt(164, 28, generator() % 3);
+        EXPECT_EQ(map.findOrAdd(key, map.size()), treeMap.findOrAdd(key, treeMap.size()));
+    }
+    ASSERT_EQ(map.size(), treeMap.size());
+    
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(keyValuePair.first, treeMap.getKey(keyValuePair.second));
+    }
+}
@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+
+#include "storm/utility/ThreadPool.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+TEST(ThreadPoolTest, Partition) {
+    storm::utility::ThreadPool pool(4);
+    EXPECT_EQ(4ull, pool.getThreadCount());
+
+    // A few heavy items at the front must not end up in the same range.
+    std::vector<uint64_t> weights(1000, 1);
+    std::fill(weights.begin(), weights.begin() + 10, 100000);
+    std::vector<uint64_t> prefixWeights(weights.size() + 1);
+    std::partial_sum(weights.begin(), weights.end(), prefixWeights.begin() + 1);
+
+    std::vector<uint64_t> boundaries = pool.partition(weights.size(), [&prefixWeights] (uint64_t index) { return prefixWeights[index]; });
+    ASSERT_LE(2ull, boundaries.size());
+    EXPECT_EQ(0ull, boundaries.front());
+    EXPECT_EQ(weights.size(), boundaries.back());
+    EXPECT_TRUE(std::is_sorted(boundaries.begin(), boundaries.end()));
+    EXPECT_GT(boundaries.size(), 4ull);
+    EXPECT_LT(boundaries[1], 10ull);
+
+    // Light work is not distributed at all.
+    boundaries = pool.partition(100, [] (uint64_t index) { return index; });
+    EXPECT_EQ(std::vector<uint64_t>({0, 100}), boundaries);
+
+    EXPECT_TRUE(pool.partition(0, [] (uint64_t index) { return index; }).size() < 2);
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+    for (uint64_t threadCount : {1, 2, 4}) {
+        storm::utility::ThreadPool pool(threadCount);
+        std::vector<uint64_t> values(100000, 0);
+        pool.parallelFor(values.size(), [] (uint64_t index) { return index; }, [&values] (uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                values[index] += index;
+            }
+        }, 1000);
+        for (uint64_t index = 0; index < values.size(); ++index) {
+            ASSERT_EQ(index, values[index]);
+        }
+    }
+}
+
+TEST(ThreadPoolTest, NestedAndExceptions) {
+    storm::utility::ThreadPool pool(3);
+    std::atomic<uint64_t> count(0);
+    pool.execute({0, 1, 2, 3, 4}, [&] (uint64_t, uint64_t) {
+        pool.execute({0, 10, 20, 30}, [&] (uint64_t begin, uint64_t end) {
+            count += end - begin;
+        });
+    });
+    EXPECT_EQ(120ull, count.load());
+
+    EXPECT_THROW(pool.execute({0, 1, 2, 3}, [] (uint64_t begin, uint64_t) {
+        if (begin == 1) {
+            throw std::runtime_error("failure");
+        }
+    }), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, WaitForSlowTasks) {
+    // The submitting thread runs out of work long before the other threads finish theirs and has to wait for them.
+    storm::utility::ThreadPool pool(4);
+    std::atomic<uint64_t> count(0);
+    for (uint64_t round = 0; round < 20; ++round) {
+        pool.execute({0, 1, 2, 3, 4}, [&] (uint64_t begin, uint64_t) {
+            if (begin != 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            ++count;
+        });
+    }
+    EXPECT_EQ(80ull, count.load());
+}
+
+TEST(ThreadPoolTest, GlobalPool) {
+    storm::settings::mutableCoreSettings().setThreadCount(2);
+    storm::utility::ThreadPool& pool = storm::utility::ThreadPool::getGlobalPool();
+    EXPECT_EQ(2ull, pool.getThreadCount());
+
+    // Changing the number of threads must not invalidate the pool that is still in use.
+    storm::settings::mutableCoreSettings().setThreadCount(3);
+    storm::utility::ThreadPool& otherPool = storm::utility::ThreadPool::getGlobalPool();
+    EXPECT_EQ(3ull, otherPool.getThreadCount());
+    EXPECT_EQ(2ull, pool.getThreadCount());
+    std::atomic<uint64_t> count(0);
+    pool.execute({0, 10, 20}, [&] (uint64_t begin, uint64_t end) {
+        count += end - begin;
+    });
+    EXPECT_EQ(20ull, count.load());
+
+    storm::settings::mutableCoreSettings().setThreadCount(2);
+    EXPECT_EQ(&pool, &storm::utility::ThreadPool::getGlobalPool());
+    storm::settings::mutableCoreSettings().setThreadCount(1);
+}
+
+TEST(ThreadPoolTest, OverrideThreadCount) {
+    bool wasSet = storm::settings::getModule<storm::settings::modules::CoreSettings>().isThreadCountSet();
+    uint_fast64_t previousCount = storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount();
+    {
+        std::unique_ptr<storm::settings::SettingMemento> threadCount = storm::settings::mutableCoreSettings().overrideThreadCount(3);
+        EXPECT_EQ(3ull, storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount());
+        {
+            std::unique_ptr<storm::settings::SettingMemento> innerThreadCount = storm::settings::mutableCoreSettings().overrideThreadCount(2);
+            EXPECT_EQ(2ull, storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount());
+        }
+        // The inner memento restores the value of the outer override, not the default.
+        EXPECT_EQ(3ull, storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount());
+    }
+    EXPECT_EQ(wasSet, storm::settings::getModule<storm::settings::modules::CoreSettings>().isThreadCountSet());
+    EXPECT_EQ(previousCount, storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadCount());
+}
+
+TEST(ThreadPoolTest, SupportedValueTypes) {
+    EXPECT_TRUE(storm::utility::ThreadPool::supportsParallelComputations<double>());
+    EXPECT_TRUE(storm::utility::ThreadPool::supportsParallelComputations<uint64_t>());
+#ifdef STORM_HAVE_CARL
+    EXPECT_FALSE(storm::utility::ThreadPool::supportsParallelComputations<storm::RationalNumber>());
+    EXPECT_FALSE(storm::utility::ThreadPool::supportsParallelComputations<storm::RationalFunction>());
+#endif
+}
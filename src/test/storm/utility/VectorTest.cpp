@@ -31,3 +31,27 @@ TEST(VectorTest, min_if) {
     ASSERT_EQ(16.0, storm::utility::vector::min_if(a, f1));
     ASSERT_EQ(8.0, storm::utility::vector::min_if(a, f2));
 }
+
+TEST(VectorTest, reduceVectorMinOrMaxRange) {
+    std::vector<double> source = {3.0, 1.0, 2.0, 5.0, 4.0, 7.0, 6.0, 6.0};
+    std::vector<uint_fast64_t> rowGrouping = {0, 3, 3, 5, 8};
+
+    std::vector<double> expected(4);
+    std::vector<uint_fast64_t> expectedChoices(4);
+    storm::utility::vector::reduceVectorMinOrMax(storm::solver::OptimizationDirection::Maximize, source, expected, rowGrouping, &expectedChoices);
+    EXPECT_EQ(std::vector<double>({3.0, 0.0, 5.0, 7.0}), expected);
+    EXPECT_EQ(std::vector<uint_fast64_t>({0, 0, 0, 0}), expectedChoices);
+
+    // Reducing the groups range by range yields the same result and leaves the other entries untouched.
+    std::vector<double> target(4, -1.0);
+    std::vector<uint_fast64_t> choices(4, 42);
+    storm::utility::vector::reduceVectorMinOrMax(storm::solver::OptimizationDirection::Maximize, source, target, rowGrouping, &choices, 2, 4);
+    EXPECT_EQ(std::vector<double>({-1.0, -1.0, 5.0, 7.0}), target);
+    storm::utility::vector::reduceVectorMinOrMax(storm::solver::OptimizationDirection::Maximize, source, target, rowGrouping, &choices, 0, 2);
+    EXPECT_EQ(expected, target);
+    EXPECT_EQ(std::vector<uint_fast64_t>({0, 42, 0, 0}), choices);
+
+    storm::utility::vector::reduceVectorMinOrMax(storm::solver::OptimizationDirection::Minimize, source, target, rowGrouping, &choices, 3, 4);
+    EXPECT_EQ(6.0, target[3]);
+    EXPECT_EQ(1ull, choices[3]);
+}